@@ -0,0 +1,390 @@
+//
+// Created on 2026/10/19.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+/**
+ * SpineAnimationIndex.cpp - JSON 动画字节范围索引实现
+ * 只识别对象、数组、字符串的边界，跳过其余内容，不做完整的 JSON 校验（由运行时解析时校验）。
+ */
+
+#include "SpineAnimationIndex.h"
+#include "common/SpineMemoryTracker.h"
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+bool IsJsonSpace(char c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+const char* SkipSpace(const char* p, const char* end) {
+    while (p < end && IsJsonSpace(*p)) {
+        ++p;
+    }
+    return p;
+}
+
+// p 指向开头的引号，返回结尾引号之后的位置，未闭合时返回 nullptr
+const char* SkipString(const char* p, const char* end) {
+    const char* begin = ++p;
+    while (p < end) {
+        const char* quote = static_cast<const char*>(std::memchr(p, '"', end - p));
+        if (!quote) {
+            return nullptr;
+        }
+        // 前面有奇数个反斜杠时为转义的引号
+        const char* escape = quote;
+        while (escape > begin && escape[-1] == '\\') {
+            --escape;
+        }
+        if (((quote - escape) & 1) == 0) {
+            return quote + 1;
+        }
+        p = quote + 1;
+    }
+    return nullptr;
+}
+
+// 跳过一个值，返回值之后的位置，格式错误时返回 nullptr
+const char* SkipValue(const char* p, const char* end) {
+    if (p >= end) {
+        return nullptr;
+    }
+    if (*p == '"') {
+        return SkipString(p, end);
+    }
+    if (*p == '{' || *p == '[') {
+        // 未闭合的括号，闭合时类型必须对应（层数通常不超过短字符串的内联容量，不分配内存）
+        string open;
+        while (p < end) {
+            const char c = *p;
+            if (c == '"') {
+                p = SkipString(p, end);
+                if (!p) {
+                    return nullptr;
+                }
+                continue;
+            }
+            if (c == '{' || c == '[') {
+                open.push_back(c);
+            } else if (c == '}' || c == ']') {
+                if (open.back() != (c == '}' ? '{' : '[')) {
+                    return nullptr;
+                }
+                open.pop_back();
+                if (open.empty()) {
+                    return p + 1;
+                }
+            }
+            ++p;
+        }
+        return nullptr;
+    }
+    // 数字、true、false、null
+    const char* begin = p;
+    while (p < end && *p != ',' && *p != '}' && *p != ']' && !IsJsonSpace(*p)) {
+        ++p;
+    }
+    return p > begin ? p : nullptr;
+}
+
+int HexValue(char c) {
+    if (c >= '0' && c <= '9') {
+        return c - '0';
+    }
+    if (c >= 'a' && c <= 'f') {
+        return c - 'a' + 10;
+    }
+    if (c >= 'A' && c <= 'F') {
+        return c - 'A' + 10;
+    }
+    return -1;
+}
+
+bool ReadHex4(const char* p, const char* end, uint32_t* value) {
+    if (end - p < 4) {
+        return false;
+    }
+    *value = 0;
+    for (int i = 0; i < 4; ++i) {
+        const int digit = HexValue(p[i]);
+        if (digit < 0) {
+            return false;
+        }
+        *value = (*value << 4) | static_cast<uint32_t>(digit);
+    }
+    return true;
+}
+
+void AppendUtf8(uint32_t codePoint, string* out) {
+    if (codePoint < 0x80) {
+        out->push_back(static_cast<char>(codePoint));
+    } else if (codePoint < 0x800) {
+        out->push_back(static_cast<char>(0xC0 | (codePoint >> 6)));
+        out->push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+    } else if (codePoint < 0x10000) {
+        out->push_back(static_cast<char>(0xE0 | (codePoint >> 12)));
+        out->push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+        out->push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+    } else {
+        out->push_back(static_cast<char>(0xF0 | (codePoint >> 18)));
+        out->push_back(static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F)));
+        out->push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+        out->push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+    }
+}
+
+// 反转义字符串内容（不含两侧引号）
+bool UnescapeString(const char* p, const char* end, string* out) {
+    out->clear();
+    while (p < end) {
+        const char* escape = static_cast<const char*>(std::memchr(p, '\\', end - p));
+        if (!escape) {
+            out->append(p, end);
+            return true;
+        }
+        out->append(p, escape);
+        if (escape + 1 >= end) {
+            return false;
+        }
+        p = escape + 2;
+        switch (escape[1]) {
+            case '"': out->push_back('"'); break;
+            case '\\': out->push_back('\\'); break;
+            case '/': out->push_back('/'); break;
+            case 'b': out->push_back('\b'); break;
+            case 'f': out->push_back('\f'); break;
+            case 'n': out->push_back('\n'); break;
+            case 'r': out->push_back('\r'); break;
+            case 't': out->push_back('\t'); break;
+            case 'u': {
+                uint32_t codePoint = 0;
+                if (!ReadHex4(p, end, &codePoint)) {
+                    return false;
+                }
+                p += 4;
+                // 代理对
+                uint32_t low = 0;
+                if (codePoint >= 0xD800 && codePoint < 0xDC00 && end - p >= 6 && p[0] == '\\' && p[1] == 'u' &&
+                    ReadHex4(p + 2, end, &low) && low >= 0xDC00 && low < 0xE000) {
+                    codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (low - 0xDC00);
+                    p += 6;
+                }
+                AppendUtf8(codePoint, out);
+                break;
+            }
+            default:
+                return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+std::shared_ptr<const SpineAnimationIndex> SpineAnimationIndex::Open(const string& path) {
+    int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return nullptr;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+        close(fd);
+        return nullptr;
+    }
+
+    const size_t size = static_cast<size_t>(st.st_size);
+    void* address = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (address == MAP_FAILED) {
+        return nullptr;
+    }
+    SpineMemoryTracker::getInstance().Add(SpineMemoryCategory::kSkeletonData, size);
+
+    std::shared_ptr<void> mapping(address, [size](void* mapping) {
+        munmap(mapping, size);
+        SpineMemoryTracker::getInstance().Sub(SpineMemoryCategory::kSkeletonData, size);
+    });
+    return Build(std::move(mapping), static_cast<const char*>(address), size);
+}
+
+std::shared_ptr<const SpineAnimationIndex> SpineAnimationIndex::Build(std::shared_ptr<void> owner, const char* text,
+                                                                      size_t size) {
+    std::shared_ptr<SpineAnimationIndex> index(new SpineAnimationIndex());
+    index->owner_ = std::move(owner);
+    index->text_ = text;
+    index->size_ = size;
+    if (!index->Parse()) {
+        return nullptr;
+    }
+
+    index->lookup_.reserve(index->entries_.size());
+    for (size_t i = 0; i < index->entries_.size(); ++i) {
+        index->lookup_.emplace(index->entries_[i].name, static_cast<int32_t>(i));
+    }
+
+    index->reportedBytes_ = index->GetMemoryBytes();
+    SpineMemoryTracker::getInstance().Add(SpineMemoryCategory::kSkeletonData, index->reportedBytes_);
+    return index;
+}
+
+bool SpineAnimationIndex::IsIndexablePath(const string& path) {
+    static const char kExtension[] = ".json";
+    const size_t extLength = sizeof(kExtension) - 1;
+    return path.size() > extLength && path.compare(path.size() - extLength, extLength, kExtension) == 0;
+}
+
+SpineAnimationIndex::~SpineAnimationIndex() {
+    SpineMemoryTracker::getInstance().Sub(SpineMemoryCategory::kSkeletonData, reportedBytes_);
+}
+
+bool SpineAnimationIndex::Parse() {
+    const char* end = text_ + size_;
+    const char* p = text_;
+    if (size_ >= 3 && std::memcmp(p, "\xEF\xBB\xBF", 3) == 0) {
+        p += 3;
+    }
+
+    p = SkipSpace(p, end);
+    if (p >= end || *p != '{') {
+        return false;
+    }
+    p = SkipSpace(p + 1, end);
+    if (p < end && *p == '}') {
+        return true;
+    }
+
+    static const char kAnimationsKey[] = "\"animations\"";
+    bool foundAnimations = false;
+    while (true) {
+        if (p >= end || *p != '"') {
+            return false;
+        }
+        const char* keyEnd = SkipString(p, end);
+        if (!keyEnd) {
+            return false;
+        }
+        const bool isAnimations = static_cast<size_t>(keyEnd - p) == sizeof(kAnimationsKey) - 1 &&
+                                  std::memcmp(p, kAnimationsKey, sizeof(kAnimationsKey) - 1) == 0;
+
+        p = SkipSpace(keyEnd, end);
+        if (p >= end || *p != ':') {
+            return false;
+        }
+        p = SkipSpace(p + 1, end);
+
+        // 重复的 "animations" 以第一个为准（与运行时按名称取子节点相同）
+        const char* valueEnd = nullptr;
+        if (isAnimations && !foundAnimations && p < end && *p == '{') {
+            foundAnimations = true;
+            valueEnd = ParseAnimations(p, end);
+            animationsOffset_ = static_cast<size_t>(p - text_);
+            animationsSize_ = valueEnd ? static_cast<size_t>(valueEnd - p) : 0;
+        } else {
+            valueEnd = SkipValue(p, end);
+        }
+        if (!valueEnd) {
+            return false;
+        }
+
+        p = SkipSpace(valueEnd, end);
+        if (p < end && *p == ',') {
+            p = SkipSpace(p + 1, end);
+            continue;
+        }
+        return p < end && *p == '}';
+    }
+}
+
+const char* SpineAnimationIndex::ParseAnimations(const char* p, const char* end) {
+    p = SkipSpace(p + 1, end);
+    if (p < end && *p == '}') {
+        return p + 1;
+    }
+
+    while (true) {
+        if (p >= end || *p != '"') {
+            return nullptr;
+        }
+        const char* keyEnd = SkipString(p, end);
+        if (!keyEnd) {
+            return nullptr;
+        }
+        Entry entry;
+        if (!UnescapeString(p + 1, keyEnd - 1, &entry.name)) {
+            return nullptr;
+        }
+        entry.keyOffset = static_cast<size_t>(p - text_);
+        entry.keySize = static_cast<size_t>(keyEnd - p);
+
+        p = SkipSpace(keyEnd, end);
+        if (p >= end || *p != ':') {
+            return nullptr;
+        }
+        p = SkipSpace(p + 1, end);
+        if (p >= end || *p != '{') {
+            return nullptr;
+        }
+        const char* valueEnd = SkipValue(p, end);
+        if (!valueEnd) {
+            return nullptr;
+        }
+        entry.valueOffset = static_cast<size_t>(p - text_);
+        entry.valueSize = static_cast<size_t>(valueEnd - p);
+        entries_.push_back(std::move(entry));
+
+        p = SkipSpace(valueEnd, end);
+        if (p < end && *p == ',') {
+            p = SkipSpace(p + 1, end);
+            continue;
+        }
+        return p < end && *p == '}' ? p + 1 : nullptr;
+    }
+}
+
+int32_t SpineAnimationIndex::Find(const string& name) const {
+    auto it = lookup_.find(name);
+    return it != lookup_.end() ? it->second : -1;
+}
+
+string SpineAnimationIndex::GetSkeletonText() const {
+    if (animationsSize_ == 0) {
+        return string(text_, size_);
+    }
+    string text;
+    text.reserve(size_ - animationsSize_ + 2);
+    text.append(text_, animationsOffset_);
+    text.append("{}");
+    text.append(text_ + animationsOffset_ + animationsSize_, size_ - animationsOffset_ - animationsSize_);
+    return text;
+}
+
+string SpineAnimationIndex::GetAnimationText(size_t index) const {
+    const Entry& entry = entries_[index];
+    string text;
+    text.reserve(entry.keySize + entry.valueSize + 3);
+    text.push_back('{');
+    text.append(text_ + entry.keyOffset, entry.keySize);
+    text.push_back(':');
+    text.append(text_ + entry.valueOffset, entry.valueSize);
+    text.push_back('}');
+    return text;
+}
+
+size_t SpineAnimationIndex::GetMemoryBytes() const {
+    size_t bytes = entries_.capacity() * sizeof(Entry);
+    for (const Entry& entry : entries_) {
+        bytes += entry.name.capacity();
+    }
+    // 哈希表：桶数组加每个节点（键、值和链表指针）
+    bytes += lookup_.bucket_count() * sizeof(void*);
+    bytes += lookup_.size() * (sizeof(string) + sizeof(int32_t) + 2 * sizeof(void*));
+    return bytes;
+}
@@ -0,0 +1,119 @@
+//
+// Created on 2026/10/19.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#ifndef SPINEHM_SPINEANIMATIONINDEX_H
+#define SPINEHM_SPINEANIMATIONINDEX_H
+/**
+ * SpineAnimationIndex - JSON 骨骼数据中各动画的字节范围索引
+ * 加载时只扫描一遍文本，记录 "animations" 下每个动画对象的位置（不解析关键帧）；
+ * 骨骼数据按去掉动画的文本解析，动画在首次使用时按范围单独解码。
+ * 索引引用映射的文本，每个骨骼文件只构建一次，通过资源缓存在实例间共享。
+ *
+ * 二进制 .skel 的动画没有长度前缀，跳过一个动画必须完整解析，不支持延迟解码。
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using std::string;
+
+class SpineAnimationIndex {
+public:
+    /**
+     * 打开 .json 骨骼文件（mmap）并建立索引
+     * @param path 文件路径
+     * @return 索引，文件不存在或不是合法的 JSON 对象时返回 nullptr
+     */
+    static std::shared_ptr<const SpineAnimationIndex> Open(const string& path);
+
+    /**
+     * 由内存中的 JSON 文本建立索引
+     * @param owner 文本的持有者（如资源包），索引存活期间保持文本有效
+     * @param text 文本起始地址
+     * @param size 文本字节数
+     * @return 索引，不是合法的 JSON 对象时返回 nullptr
+     */
+    static std::shared_ptr<const SpineAnimationIndex> Build(std::shared_ptr<void> owner, const char* text,
+                                                            size_t size);
+
+    /**
+     * 是否可以建立索引（按扩展名判断，仅 .json）
+     * @param path 文件路径
+     */
+    static bool IsIndexablePath(const string& path);
+
+    ~SpineAnimationIndex();
+
+    SpineAnimationIndex(const SpineAnimationIndex&) = delete;
+    SpineAnimationIndex& operator=(const SpineAnimationIndex&) = delete;
+
+    size_t GetAnimationCount() const { return entries_.size(); }
+
+    /**
+     * 获取动画名称（按文件中的顺序）
+     */
+    const string& GetAnimationName(size_t index) const { return entries_[index].name; }
+
+    /**
+     * 查找动画
+     * @param name 动画名称
+     * @return 动画下标，不存在时返回 -1（重名时为第一个，与 findAnimation 相同）
+     */
+    int32_t Find(const string& name) const;
+
+    /**
+     * 生成去掉全部动画的骨骼文本（"animations" 的值替换为 {}），以 '\0' 结尾
+     */
+    string GetSkeletonText() const;
+
+    /**
+     * 生成只含单个动画的 JSON 文本 {"名称": {...}}，以 '\0' 结尾
+     * @param index 动画下标
+     */
+    string GetAnimationText(size_t index) const;
+
+    /**
+     * 动画在文本中占用的字节数
+     */
+    size_t GetAnimationTextSize(size_t index) const { return entries_[index].valueSize; }
+
+    size_t GetMemoryBytes() const;
+
+private:
+    // 名称为反转义后的字符串；键保留原始字节（含引号），生成单个动画的文本时原样写回
+    struct Entry {
+        string name;
+        size_t keyOffset;
+        size_t keySize;
+        size_t valueOffset;
+        size_t valueSize;
+    };
+
+    SpineAnimationIndex() = default;
+
+    bool Parse();
+
+    // 解析 "animations" 对象，返回对象之后的位置，格式错误时返回 nullptr
+    const char* ParseAnimations(const char* p, const char* end);
+
+    std::shared_ptr<void> owner_;
+    const char* text_ = nullptr;
+    size_t size_ = 0;
+
+    // "animations" 的值在文本中的范围，没有动画时大小为 0
+    size_t animationsOffset_ = 0;
+    size_t animationsSize_ = 0;
+
+    std::vector<Entry> entries_;
+    std::unordered_map<string, int32_t> lookup_;
+    size_t reportedBytes_ = 0;
+};
+
+#endif //SPINEHM_SPINEANIMATIONINDEX_H
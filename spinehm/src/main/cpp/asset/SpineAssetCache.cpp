@@ -0,0 +1,203 @@
+//
+// Created on 2026/10/19.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+/**
+ * SpineAssetCache.cpp - 资源缓存实现
+ */
+
+#include "SpineAssetCache.h"
+#include "asset/SpineAnimationIndex.h"
+#include "asset/SpineAtlasContainer.h"
+#include "asset/SpineBoundsTable.h"
+#include "asset/SpineBundle.h"
+#include "asset/SpineRegionIndex.h"
+#include "common/SpineMemoryTracker.h"
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+namespace {
+// 全局预算淘汰顺序：解压页面需要重新解压 LZ4，在位图之后淘汰
+constexpr int32_t kDecodedPageEvictPriority = 1;
+}
+
+SpineAssetCache& SpineAssetCache::getInstance() {
+    static SpineAssetCache instance;
+    return instance;
+}
+
+SpineAssetCache::SpineAssetCache() {
+    SpineMemoryTracker::getInstance().RegisterEvictor(kDecodedPageEvictPriority, [](size_t bytesToFree) {
+        return SpineAssetCache::getInstance().ReleaseDecodedPages(bytesToFree);
+    });
+}
+
+std::shared_ptr<SpineAtlasContainer> SpineAssetCache::AcquireAtlasContainer(const string& path) {
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+
+    std::shared_ptr<SpineAtlasContainer> container = atlasContainers_[path].lock();
+    if (container) {
+        return container;
+    }
+
+    container = SpineAtlasContainer::Open(path);
+    if (container) {
+        atlasContainers_[path] = container;
+    } else {
+        atlasContainers_.erase(path);
+    }
+    return container;
+}
+
+std::shared_ptr<SpineBundle> SpineAssetCache::AcquireBundle(const string& path) {
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+
+    std::shared_ptr<SpineBundle> bundle = bundles_[path].lock();
+    if (bundle) {
+        return bundle;
+    }
+
+    bundle = SpineBundle::Open(path);
+    if (bundle) {
+        bundles_[path] = bundle;
+    } else {
+        bundles_.erase(path);
+    }
+    return bundle;
+}
+
+std::shared_ptr<SpineBoundsTableSet> SpineAssetCache::AcquireBoundsTables(const string& skeletonPath, float scale) {
+    const string key = skeletonPath + ":" + std::to_string(scale);
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+
+    std::shared_ptr<SpineBoundsTableSet> tables = boundsTables_[key].lock();
+    if (!tables) {
+        tables = std::make_shared<SpineBoundsTableSet>();
+        boundsTables_[key] = tables;
+    }
+    return tables;
+}
+
+std::shared_ptr<const SpineRegionIndex> SpineAssetCache::AcquireRegionIndex(
+    const string& atlasPath, const std::shared_ptr<SpineAtlasContainer>& container) {
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex_);
+        std::shared_ptr<const SpineRegionIndex> index = regionIndices_[atlasPath].lock();
+        if (index) {
+            return index;
+        }
+    }
+
+    // 在锁外读取和构建（获取容器会再次进入缓存锁）
+    std::shared_ptr<const SpineRegionIndex> index;
+    std::vector<const char*> names;
+    const bool isBundle = SpineBundle::IsBundlePath(atlasPath);
+    if (container || isBundle || SpineAtlasContainer::IsContainerPath(atlasPath)) {
+        std::shared_ptr<SpineAtlasContainer> source = container;
+        if (!source && isBundle) {
+            std::shared_ptr<SpineBundle> bundle = AcquireBundle(atlasPath);
+            source = bundle ? bundle->GetAtlasContainer() : nullptr;
+        } else if (!source) {
+            source = AcquireAtlasContainer(atlasPath);
+        }
+        if (source) {
+            names.reserve(source->GetRegionCount());
+            for (size_t i = 0; i < source->GetRegionCount(); ++i) {
+                names.push_back(source->GetRegionName(i));
+            }
+            index = SpineRegionIndex::Build(names);
+        }
+    } else {
+        std::ifstream file(atlasPath, std::ios::binary);
+        if (file) {
+            string text((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+            std::vector<string> regionNames;
+            SpineRegionIndex::ParseAtlasRegionNames(text.data(), text.size(), &regionNames);
+            names.reserve(regionNames.size());
+            for (const string& name : regionNames) {
+                names.push_back(name.c_str());
+            }
+            index = SpineRegionIndex::Build(names);
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    if (!index) {
+        regionIndices_.erase(atlasPath);
+        return nullptr;
+    }
+    // 并发构建时使用先放入缓存的那份
+    std::shared_ptr<const SpineRegionIndex> cached = regionIndices_[atlasPath].lock();
+    if (cached) {
+        return cached;
+    }
+    regionIndices_[atlasPath] = index;
+    return index;
+}
+
+std::shared_ptr<const SpineAnimationIndex> SpineAssetCache::AcquireAnimationIndex(
+    const string& skeletonPath, const std::shared_ptr<SpineBundle>& bundle) {
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex_);
+        std::shared_ptr<const SpineAnimationIndex> index = animationIndices_[skeletonPath].lock();
+        if (index) {
+            return index;
+        }
+    }
+
+    // 在锁外扫描（获取资源包会再次进入缓存锁）；资源包中的 JSON 直接引用包的映射
+    std::shared_ptr<const SpineAnimationIndex> index;
+    if (bundle || SpineBundle::IsBundlePath(skeletonPath)) {
+        std::shared_ptr<SpineBundle> source = bundle ? bundle : AcquireBundle(skeletonPath);
+        if (source && source->IsSkeletonJson()) {
+            size_t size = 0;
+            const char* text = reinterpret_cast<const char*>(source->GetSkeletonData(&size));
+            index = SpineAnimationIndex::Build(source, text, size);
+        }
+    } else if (SpineAnimationIndex::IsIndexablePath(skeletonPath)) {
+        index = SpineAnimationIndex::Open(skeletonPath);
+    }
+
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    if (!index) {
+        animationIndices_.erase(skeletonPath);
+        return nullptr;
+    }
+    // 并发构建时使用先放入缓存的那份
+    std::shared_ptr<const SpineAnimationIndex> cached = animationIndices_[skeletonPath].lock();
+    if (cached) {
+        return cached;
+    }
+    animationIndices_[skeletonPath] = index;
+    return index;
+}
+
+size_t SpineAssetCache::ReleaseDecodedPages(size_t bytesToFree) {
+    // 在锁外释放，避免与容器的解压锁嵌套
+    std::vector<std::shared_ptr<SpineAtlasContainer>> containers;
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex_);
+        for (auto& entry : atlasContainers_) {
+            if (auto container = entry.second.lock()) {
+                containers.push_back(std::move(container));
+            }
+        }
+        for (auto& entry : bundles_) {
+            if (auto bundle = entry.second.lock()) {
+                containers.push_back(bundle->GetAtlasContainer());
+            }
+        }
+    }
+
+    size_t freed = 0;
+    for (auto& container : containers) {
+        if (freed >= bytesToFree) {
+            break;
+        }
+        freed += container->ReleaseDecodedPages();
+    }
+    return freed;
+}
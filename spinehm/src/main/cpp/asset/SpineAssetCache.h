@@ -0,0 +1,92 @@
+//
+// Created on 2026/10/19.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#ifndef SPINEHM_SPINEASSETCACHE_H
+#define SPINEHM_SPINEASSETCACHE_H
+/**
+ * SpineAssetCache - 跨实例共享的资源缓存
+ * 同一路径的资源只加载一次，最后一个使用者释放后自动卸载
+ */
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+class SpineAnimationIndex;
+class SpineAtlasContainer;
+class SpineBundle;
+class SpineBoundsTableSet;
+class SpineRegionIndex;
+
+using std::string;
+
+/**
+ * 资源缓存
+ */
+class SpineAssetCache {
+public:
+    static SpineAssetCache& getInstance();
+
+    /**
+     * 获取图集容器，未加载时 mmap 打开
+     * @param path 容器文件路径
+     * @return 容器对象，打开失败时返回 nullptr
+     */
+    std::shared_ptr<SpineAtlasContainer> AcquireAtlasContainer(const string& path);
+
+    /**
+     * 获取资源包，未加载时 mmap 打开
+     * @param path 资源包路径
+     * @return 资源包，打开失败时返回 nullptr
+     */
+    std::shared_ptr<SpineBundle> AcquireBundle(const string& path);
+
+    /**
+     * 获取骨骼数据的动画包围盒表集合，同一骨骼数据的实例共享采样结果
+     * @param skeletonPath .skel 或 .json 文件路径
+     * @param scale 加载缩放（不同缩放的骨骼坐标不同，分开缓存）
+     * @return 表集合（首次获取时为空集合）
+     */
+    std::shared_ptr<SpineBoundsTableSet> AcquireBoundsTables(const string& skeletonPath, float scale);
+
+    /**
+     * 获取图集的区域名称索引，未构建时读取区域名称构建（图集容器和资源包读区域表，.atlas 读文本）
+     * @param atlasPath 图集、图集容器或资源包路径
+     * @param container 调用方已获取的图集容器（可为空，为空时按路径获取）
+     * @return 区域索引，文件读取失败时返回 nullptr
+     */
+    std::shared_ptr<const SpineRegionIndex> AcquireRegionIndex(
+        const string& atlasPath, const std::shared_ptr<SpineAtlasContainer>& container = nullptr);
+
+    /**
+     * 获取 JSON 骨骼数据的动画字节范围索引，未构建时扫描文本构建（资源包使用包内的 JSON 段）
+     * @param skeletonPath .json 或资源包路径
+     * @param bundle 调用方已获取的资源包（可为空，为空时按路径获取）
+     * @return 动画索引，文件读取失败、格式错误或骨骼数据为二进制时返回 nullptr
+     */
+    std::shared_ptr<const SpineAnimationIndex> AcquireAnimationIndex(
+        const string& skeletonPath, const std::shared_ptr<SpineBundle>& bundle = nullptr);
+
+    /**
+     * 释放已加载容器的解压页面（正在上传纹理的容器除外）
+     * @param bytesToFree 需要释放的字节数，释放足够后停止
+     * @return 释放的字节数
+     */
+    size_t ReleaseDecodedPages(size_t bytesToFree);
+
+private:
+    SpineAssetCache();
+
+    std::unordered_map<string, std::weak_ptr<SpineAtlasContainer>> atlasContainers_;
+    std::unordered_map<string, std::weak_ptr<SpineBundle>> bundles_;
+    std::unordered_map<string, std::weak_ptr<SpineBoundsTableSet>> boundsTables_;
+    std::unordered_map<string, std::weak_ptr<const SpineRegionIndex>> regionIndices_;
+    std::unordered_map<string, std::weak_ptr<const SpineAnimationIndex>> animationIndices_;
+    std::mutex cacheMutex_;
+};
+
+#endif //SPINEHM_SPINEASSETCACHE_H
@@ -0,0 +1,260 @@
+//
+// Created on 2026/10/19.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+/**
+ * SpineAtlasContainer.cpp - 图集容器运行时加载实现
+ */
+
+#include "SpineAtlasContainer.h"
+#include "asset/SpineLz4.h"
+#include "common/SpineMemoryTracker.h"
+#include "common/SpineTrace.h"
+#include "render/SpinePixelKernels.h"
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace SpineAtlasContainerFormat;
+
+std::shared_ptr<SpineAtlasContainer> SpineAtlasContainer::Open(const string& path) {
+    int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return nullptr;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(sizeof(Header))) {
+        close(fd);
+        return nullptr;
+    }
+
+    void* mapping = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED) {
+        return nullptr;
+    }
+
+    std::shared_ptr<SpineAtlasContainer> container(new SpineAtlasContainer());
+    container->path_ = path;
+    container->mapping_ = mapping;
+    container->mappingSize_ = static_cast<size_t>(st.st_size);
+    SpineMemoryTracker::getInstance().Add(SpineMemoryCategory::kAtlas, container->mappingSize_);
+    if (!container->Validate()) {
+        return nullptr;
+    }
+
+    // 页面数据马上会被使用，提前让内核预读
+    madvise(mapping, container->mappingSize_, MADV_WILLNEED);
+    return container;
+}
+
+std::shared_ptr<SpineAtlasContainer> SpineAtlasContainer::OpenView(const string& path, std::shared_ptr<void> owner,
+                                                                   const uint8_t* data, size_t size) {
+    if (!owner || size < sizeof(Header) || reinterpret_cast<uintptr_t>(data) % alignof(Header) != 0) {
+        return nullptr;
+    }
+
+    std::shared_ptr<SpineAtlasContainer> container(new SpineAtlasContainer());
+    container->path_ = path;
+    container->owner_ = std::move(owner);
+    container->mapping_ = const_cast<uint8_t*>(data);
+    container->mappingSize_ = size;
+    if (!container->Validate()) {
+        return nullptr;
+    }
+    return container;
+}
+
+bool SpineAtlasContainer::IsContainerPath(const string& path) {
+    const size_t extLength = std::strlen(kFileExtension);
+    return path.size() > extLength && path.compare(path.size() - extLength, extLength, kFileExtension) == 0;
+}
+
+SpineAtlasContainer::~SpineAtlasContainer() {
+    if (mapping_ && !owner_) {
+        munmap(mapping_, mappingSize_);
+        SpineMemoryTracker::getInstance().Sub(SpineMemoryCategory::kAtlas, mappingSize_);
+    }
+    SpineMemoryTracker::getInstance().Sub(SpineMemoryCategory::kTexture, decodedBytes_);
+}
+
+bool SpineAtlasContainer::Validate() {
+    const uint8_t* base = static_cast<const uint8_t*>(mapping_);
+    header_ = reinterpret_cast<const Header*>(base);
+
+    if (std::memcmp(header_->magic, kMagic, sizeof(kMagic)) != 0 || header_->version != kVersion) {
+        return false;
+    }
+
+    auto inRange = [this](uint64_t offset, uint64_t size) {
+        return offset <= mappingSize_ && size <= mappingSize_ - offset;
+    };
+
+    pageCount_ = header_->pageCount;
+    regionCount_ = header_->regionCount;
+    if (!inRange(header_->pageTableOffset, static_cast<uint64_t>(pageCount_) * sizeof(Page)) ||
+        !inRange(header_->regionTableOffset, static_cast<uint64_t>(regionCount_) * sizeof(Region)) ||
+        !inRange(header_->stringTableOffset, header_->stringTableSize) ||
+        !inRange(header_->atlasTextOffset, header_->atlasTextSize) ||
+        header_->pageTableOffset % alignof(Page) != 0 ||
+        header_->regionTableOffset % alignof(Region) != 0) {
+        return false;
+    }
+
+    pages_ = reinterpret_cast<const Page*>(base + header_->pageTableOffset);
+    regions_ = reinterpret_cast<const Region*>(base + header_->regionTableOffset);
+    strings_ = reinterpret_cast<const char*>(base + header_->stringTableOffset);
+
+    // 字符串表必须以 '\0' 结尾，名称偏移不能越界
+    const uint64_t stringsSize = header_->stringTableSize;
+    if (stringsSize == 0 || strings_[stringsSize - 1] != '\0') {
+        return false;
+    }
+
+    for (size_t i = 0; i < pageCount_; ++i) {
+        const Page& page = pages_[i];
+        uint64_t rawSize = static_cast<uint64_t>(page.width) * page.height * 4;
+        if (page.nameOffset >= stringsSize || page.rawSize != rawSize ||
+            !inRange(page.dataOffset, page.dataSize) ||
+            (page.compression == kCompressionNone && page.dataSize != rawSize) ||
+            page.compression > kCompressionLz4) {
+            return false;
+        }
+    }
+
+    for (size_t i = 0; i < regionCount_; ++i) {
+        if (regions_[i].nameOffset >= stringsSize || regions_[i].pageIndex >= pageCount_) {
+            return false;
+        }
+    }
+
+    decodedPages_.resize(pageCount_);
+    premultipliedPages_.resize(pageCount_);
+    return true;
+}
+
+bool SpineAtlasContainer::IsPremultiplied() const {
+    return (header_->flags & kFlagPremultipliedAlpha) != 0;
+}
+
+const char* SpineAtlasContainer::GetAtlasText(size_t* size) const {
+    *size = static_cast<size_t>(header_->atlasTextSize);
+    return static_cast<const char*>(mapping_) + header_->atlasTextOffset;
+}
+
+const char* SpineAtlasContainer::GetPageName(size_t index) const {
+    return strings_ + pages_[index].nameOffset;
+}
+
+int32_t SpineAtlasContainer::FindPage(const string& name) const {
+    for (size_t i = 0; i < pageCount_; ++i) {
+        if (name == GetPageName(i)) {
+            return static_cast<int32_t>(i);
+        }
+    }
+    return -1;
+}
+
+const uint8_t* SpineAtlasContainer::GetPagePixels(size_t index) {
+    if (index >= pageCount_) {
+        return nullptr;
+    }
+
+    const Page& page = pages_[index];
+    if (page.compression == kCompressionNone) {
+        return static_cast<const uint8_t*>(mapping_) + page.dataOffset;
+    }
+
+    std::lock_guard<std::mutex> lock(decodeMutex_);
+    return GetPagePixelsLocked(index);
+}
+
+const uint8_t* SpineAtlasContainer::GetPremultipliedPagePixels(size_t index) {
+    if (IsPremultiplied()) {
+        return GetPagePixels(index);
+    }
+    if (index >= pageCount_) {
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(decodeMutex_);
+
+    std::vector<uint8_t>& converted = premultipliedPages_[index];
+    if (converted.empty()) {
+        const uint8_t* pixels = GetPagePixelsLocked(index);
+        if (!pixels) {
+            return nullptr;
+        }
+        SPINE_TRACE_SCOPE("AtlasContainer.premultiply", -1);
+        converted.resize(static_cast<size_t>(pages_[index].rawSize));
+        SpinePixelKernels::PremultiplyRgba(pixels, converted.data(), converted.size() / 4);
+        decodedBytes_ += converted.size();
+        SpineMemoryTracker::getInstance().Add(SpineMemoryCategory::kTexture, converted.size());
+    }
+    return converted.data();
+}
+
+const uint8_t* SpineAtlasContainer::GetPagePixelsLocked(size_t index) {
+    const Page& page = pages_[index];
+    const uint8_t* data = static_cast<const uint8_t*>(mapping_) + page.dataOffset;
+    if (page.compression == kCompressionNone) {
+        return data;
+    }
+
+    std::vector<uint8_t>& decoded = decodedPages_[index];
+    if (decoded.empty()) {
+        decoded.resize(static_cast<size_t>(page.rawSize));
+        if (!SpineLz4::Decompress(data, static_cast<size_t>(page.dataSize), decoded.data(), decoded.size())) {
+            std::vector<uint8_t>().swap(decoded);
+            return nullptr;
+        }
+        decodedBytes_ += decoded.size();
+        SpineMemoryTracker::getInstance().Add(SpineMemoryCategory::kTexture, decoded.size());
+    }
+    return decoded.data();
+}
+
+size_t SpineAtlasContainer::ReleaseDecodedPages() {
+    std::lock_guard<std::mutex> lock(decodeMutex_);
+
+    if (pinCount_ > 0) {
+        return 0;
+    }
+
+    size_t freed = decodedBytes_;
+    for (auto& decoded : decodedPages_) {
+        std::vector<uint8_t>().swap(decoded);
+    }
+    for (auto& converted : premultipliedPages_) {
+        std::vector<uint8_t>().swap(converted);
+    }
+    decodedBytes_ = 0;
+    SpineMemoryTracker::getInstance().Sub(SpineMemoryCategory::kTexture, freed);
+    return freed;
+}
+
+void SpineAtlasContainer::PinDecodedPages() {
+    std::lock_guard<std::mutex> lock(decodeMutex_);
+    pinCount_++;
+}
+
+void SpineAtlasContainer::UnpinDecodedPages() {
+    std::lock_guard<std::mutex> lock(decodeMutex_);
+    if (pinCount_ > 0) {
+        pinCount_--;
+    }
+}
+
+size_t SpineAtlasContainer::GetDecodedBytes() const {
+    std::lock_guard<std::mutex> lock(decodeMutex_);
+    return decodedBytes_;
+}
+
+const char* SpineAtlasContainer::GetRegionName(size_t index) const {
+    return strings_ + regions_[index].nameOffset;
+}
@@ -0,0 +1,160 @@
+//
+// Created on 2026/10/19.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#ifndef SPINEHM_SPINEATLASCONTAINER_H
+#define SPINEHM_SPINEATLASCONTAINER_H
+/**
+ * SpineAtlasContainer - 图集容器运行时加载
+ * mmap 容器文件，直接提供区域表和 RGBA 页面；LZ4 页面在首次使用时解压一次
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "asset/SpineAtlasContainerFormat.h"
+
+using std::string;
+
+/**
+ * 图集容器
+ */
+class SpineAtlasContainer {
+public:
+    /**
+     * 打开图集容器
+     * @param path 容器文件路径
+     * @return 容器对象，文件不存在或格式错误时返回 nullptr
+     */
+    static std::shared_ptr<SpineAtlasContainer> Open(const string& path);
+
+    /**
+     * 在已映射的内存上打开图集容器（资源包内的图集段）
+     * @param path 标识路径（资源包路径）
+     * @param owner 映射的持有者，容器存在期间保持映射有效；映射内存由持有者统计
+     * @param data 容器起始地址（至少按 8 字节对齐）
+     * @param size 容器字节数
+     * @return 容器对象，格式错误时返回 nullptr
+     */
+    static std::shared_ptr<SpineAtlasContainer> OpenView(const string& path, std::shared_ptr<void> owner,
+                                                         const uint8_t* data, size_t size);
+
+    /**
+     * 是否为图集容器路径（按扩展名判断）
+     * @param path 文件路径
+     */
+    static bool IsContainerPath(const string& path);
+
+    ~SpineAtlasContainer();
+
+    SpineAtlasContainer(const SpineAtlasContainer&) = delete;
+    SpineAtlasContainer& operator=(const SpineAtlasContainer&) = delete;
+
+    const string& GetPath() const { return path_; }
+
+    /**
+     * 页面像素是否已预乘 Alpha
+     */
+    bool IsPremultiplied() const;
+
+    /**
+     * 获取原始 .atlas 文本（供 Spine 运行时解析）
+     * @param size 输出文本字节数
+     * @return 文本起始地址，指向映射内存
+     */
+    const char* GetAtlasText(size_t* size) const;
+
+    // ==================== 页面 ====================
+
+    size_t GetPageCount() const { return pageCount_; }
+    const SpineAtlasContainerFormat::Page& GetPage(size_t index) const { return pages_[index]; }
+    const char* GetPageName(size_t index) const;
+
+    /**
+     * 按名称查找页面
+     * @param name 页面名称（.atlas 中的图片文件名）
+     * @return 页面下标，不存在时返回 -1
+     */
+    int32_t FindPage(const string& name) const;
+
+    /**
+     * 获取页面的 RGBA8888 像素
+     * 未压缩页面直接指向映射内存；LZ4 页面首次调用时解压并缓存
+     * @param index 页面下标
+     * @return 像素地址，解压失败时返回 nullptr
+     */
+    const uint8_t* GetPagePixels(size_t index);
+
+    /**
+     * 获取预乘 Alpha 的页面像素
+     * 已预乘的容器同 GetPagePixels；未预乘的页面首次调用时用 SIMD 转换一次并缓存，
+     * 与原始像素同时保留，切换预乘方式时不需要重新解压
+     * @param index 页面下标
+     * @return 像素地址，解压失败时返回 nullptr
+     */
+    const uint8_t* GetPremultipliedPagePixels(size_t index);
+
+    /**
+     * 释放已解压和已预乘的页面（下次使用时重新解压、转换）
+     * 之前返回的 LZ4 页面像素地址随之失效，调用方需已完成纹理上传
+     * @return 释放的字节数
+     */
+    size_t ReleaseDecodedPages();
+
+    /**
+     * 固定已解压的页面，在纹理上传期间阻止 ReleaseDecodedPages 释放（可嵌套）
+     */
+    void PinDecodedPages();
+    void UnpinDecodedPages();
+
+    /**
+     * 获取已解压和已预乘页面占用的字节数
+     */
+    size_t GetDecodedBytes() const;
+
+    // ==================== 区域 ====================
+
+    size_t GetRegionCount() const { return regionCount_; }
+    const SpineAtlasContainerFormat::Region& GetRegion(size_t index) const { return regions_[index]; }
+    const char* GetRegionName(size_t index) const;
+
+private:
+    SpineAtlasContainer() = default;
+
+    /**
+     * 校验文件头和各个表的范围
+     * @return 是否为有效容器
+     */
+    bool Validate();
+
+    /**
+     * 获取页面像素（调用方需持有 decodeMutex_）
+     */
+    const uint8_t* GetPagePixelsLocked(size_t index);
+
+    string path_;
+    void* mapping_ = nullptr;
+    size_t mappingSize_ = 0;
+    std::shared_ptr<void> owner_;  // 非空时 mapping_ 属于外部映射，不由本对象解除
+
+    const SpineAtlasContainerFormat::Header* header_ = nullptr;
+    const SpineAtlasContainerFormat::Page* pages_ = nullptr;
+    const SpineAtlasContainerFormat::Region* regions_ = nullptr;
+    const char* strings_ = nullptr;
+    size_t pageCount_ = 0;
+    size_t regionCount_ = 0;
+
+    // 已解压的 LZ4 页面、转换后的预乘页面（都计入 decodedBytes_）
+    std::vector<std::vector<uint8_t>> decodedPages_;
+    std::vector<std::vector<uint8_t>> premultipliedPages_;
+    size_t decodedBytes_ = 0;
+    int32_t pinCount_ = 0;
+    mutable std::mutex decodeMutex_;
+};
+
+#endif //SPINEHM_SPINEATLASCONTAINER_H
@@ -0,0 +1,97 @@
+//
+// Created on 2026/10/19.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#ifndef SPINEHM_SPINEATLASCONTAINERFORMAT_H
+#define SPINEHM_SPINEATLASCONTAINERFORMAT_H
+/**
+ * 图集容器文件格式（.satlas）
+ * 由离线工具 tools/spine_atlas_pack 生成，运行时 mmap 后直接使用，无需 PNG 解码。
+ *
+ * 文件布局（小端）：
+ *   Header | 页面表 | 区域表 | 字符串表 | 原始 .atlas 文本 | 页面数据...
+ * 每个页面数据按 alignment（4096）对齐，可直接映射或作为 LZ4 解压源。
+ */
+
+#include <cstdint>
+
+namespace SpineAtlasContainerFormat {
+
+constexpr char kMagic[4] = {'S', 'P', 'A', 'C'};
+constexpr uint32_t kVersion = 1;
+constexpr uint32_t kPageAlignment = 4096;
+constexpr const char* kFileExtension = ".satlas";
+
+/**
+ * 容器标志位
+ */
+enum Flags : uint32_t {
+    kFlagPremultipliedAlpha = 1u << 0,  // 页面像素已预乘 Alpha
+};
+
+/**
+ * 页面压缩方式
+ */
+enum Compression : uint32_t {
+    kCompressionNone = 0,  // 原始 RGBA8888
+    kCompressionLz4 = 1,   // LZ4 块格式
+};
+
+/**
+ * 文件头
+ */
+struct Header {
+    char magic[4];
+    uint32_t version;
+    uint32_t flags;
+    uint32_t alignment;
+    uint32_t pageCount;
+    uint32_t regionCount;
+    uint64_t pageTableOffset;
+    uint64_t regionTableOffset;
+    uint64_t stringTableOffset;
+    uint64_t stringTableSize;
+    uint64_t atlasTextOffset;   // 原始 .atlas 文本，供 Spine 运行时解析
+    uint64_t atlasTextSize;
+};
+
+/**
+ * 页面表项
+ */
+struct Page {
+    uint32_t nameOffset;        // 字符串表偏移（以 '\0' 结尾）
+    uint32_t width;
+    uint32_t height;
+    uint32_t compression;
+    uint64_t dataOffset;        // 按 alignment 对齐
+    uint64_t dataSize;          // 存储字节数
+    uint64_t rawSize;           // 解压后字节数（width * height * 4）
+};
+
+/**
+ * 区域表项
+ */
+struct Region {
+    uint32_t nameOffset;
+    uint32_t pageIndex;
+    int32_t x;
+    int32_t y;
+    int32_t width;
+    int32_t height;
+    float offsetX;
+    float offsetY;
+    int32_t originalWidth;
+    int32_t originalHeight;
+    int32_t degrees;
+    int32_t index;
+};
+
+static_assert(sizeof(Header) == 72, "SpineAtlasContainerFormat::Header layout changed");
+static_assert(sizeof(Page) == 40, "SpineAtlasContainerFormat::Page layout changed");
+static_assert(sizeof(Region) == 48, "SpineAtlasContainerFormat::Region layout changed");
+
+} // namespace SpineAtlasContainerFormat
+
+#endif //SPINEHM_SPINEATLASCONTAINERFORMAT_H
@@ -0,0 +1,140 @@
+//
+// Created on 2026/10/19.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+/**
+ * SpineAtlasVariant.cpp - 图集变体选择与后台切换实现
+ */
+
+#include "SpineAtlasVariant.h"
+#include "asset/SpineAssetCache.h"
+#include "asset/SpineAtlasContainer.h"
+#include "asset/SpineBundle.h"
+#include "asset/SpineRegionIndex.h"
+#include "common/SpineTrace.h"
+#include "common/SpineWorkerPool.h"
+#include <cmath>
+
+namespace SpineAtlasVariants {
+
+std::vector<SpineAtlasVariant> Normalize(const string& baseAtlasPath, const std::vector<SpineAtlasVariant>& variants) {
+    std::vector<SpineAtlasVariant> result;
+    result.push_back(SpineAtlasVariant{baseAtlasPath, 1.0f});
+    for (const SpineAtlasVariant& variant : variants) {
+        if (!variant.atlasPath.empty() && variant.scale > 0.0f && variant.scale < 1.0f) {
+            result.push_back(variant);
+        }
+    }
+
+    // 分辨率从高到低，相同分辨率保留先给出的
+    std::stable_sort(result.begin() + 1, result.end(), [](const SpineAtlasVariant& a, const SpineAtlasVariant& b) {
+        return a.scale > b.scale;
+    });
+    result.erase(std::unique(result.begin(), result.end(),
+                             [](const SpineAtlasVariant& a, const SpineAtlasVariant& b) { return a.scale == b.scale; }),
+                 result.end());
+    return result;
+}
+
+size_t Select(const std::vector<SpineAtlasVariant>& variants, float requiredScale, size_t current) {
+    if (current >= variants.size()) {
+        current = 0;
+    }
+    if (!std::isfinite(requiredScale) || requiredScale <= 0.0f) {
+        return current;
+    }
+
+    size_t target = 0;
+    while (target + 1 < variants.size() && variants[target + 1].scale >= requiredScale) {
+        ++target;
+    }
+    // 提高分辨率立即切换；降低分辨率要求所需密度明显低于目标变体
+    while (target > current && requiredScale > variants[target].scale * kDownswitchRatio) {
+        --target;
+    }
+    return target;
+}
+
+} // namespace SpineAtlasVariants
+
+std::shared_ptr<SpineAtlasVariantLoad> SpineAtlasVariantLoad::Start(size_t variantIndex, const string& atlasPath,
+                                                                    bool premultipliedAlpha) {
+    std::shared_ptr<SpineAtlasVariantLoad> load(new SpineAtlasVariantLoad());
+    load->variantIndex_ = variantIndex;
+    load->atlasPath_ = atlasPath;
+    load->premultipliedAlpha_ = premultipliedAlpha;
+    SpineWorkerPool::getInstance().Post([load]() { load->Run(); });
+    return load;
+}
+
+SpineAtlasVariantLoad::~SpineAtlasVariantLoad() {
+    // 暂时注释掉 Spine 4.2 接入
+    /*
+    // 结果未被实例取走（实例已释放或切换被取消）
+    delete atlas_;
+    delete containerTextureLoader_;
+    */
+}
+
+void SpineAtlasVariantLoad::Run() {
+    SPINE_TRACE_SCOPE("AtlasVariant.load", -1);
+    SpineAssetCache& cache = SpineAssetCache::getInstance();
+
+    bool ok = true;
+    if (SpineBundle::IsBundlePath(atlasPath_)) {
+        std::shared_ptr<SpineBundle> bundle = cache.AcquireBundle(atlasPath_);
+        atlasContainer_ = bundle ? bundle->GetAtlasContainer() : nullptr;
+        ok = atlasContainer_ != nullptr;
+    } else if (SpineAtlasContainer::IsContainerPath(atlasPath_)) {
+        atlasContainer_ = cache.AcquireAtlasContainer(atlasPath_);
+        ok = atlasContainer_ != nullptr;
+    }
+    if (ok) {
+        regionIndex_ = cache.AcquireRegionIndex(atlasPath_, atlasContainer_);
+        ok = regionIndex_ != nullptr;
+    }
+
+    // 解压页面并创建纹理，渲染线程替换时不再等待
+    if (ok && atlasContainer_) {
+        const bool premultiply = premultipliedAlpha_ && !atlasContainer_->IsPremultiplied();
+        atlasContainer_->PinDecodedPages();
+        for (size_t i = 0; i < atlasContainer_->GetPageCount() && ok; ++i) {
+            const uint8_t* pixels = premultiply ? atlasContainer_->GetPremultipliedPagePixels(i)
+                                                : atlasContainer_->GetPagePixels(i);
+            ok = pixels != nullptr;
+        }
+        // 暂时注释掉 Spine 4.2 接入
+        /*
+        if (ok) {
+            size_t atlasTextSize = 0;
+            const char* atlasText = atlasContainer_->GetAtlasText(&atlasTextSize);
+            containerTextureLoader_ = new SpineContainerTextureLoader(atlasContainer_, premultipliedAlpha_);
+            atlas_ = new spine::Atlas(atlasText, static_cast<int>(atlasTextSize), "", containerTextureLoader_);
+        }
+        */
+        atlasContainer_->UnpinDecodedPages();
+    }
+    // 暂时注释掉 Spine 4.2 接入
+    /*
+    else if (ok) {
+        atlas_ = new spine::Atlas(atlasPath_.c_str(), nullptr);
+        ok = atlas_->getPages().size() > 0;
+    }
+    */
+
+    succeeded_ = ok;
+    ready_.store(true, std::memory_order_release);
+}
+
+// 暂时注释掉 Spine 4.2 接入
+/*
+spine::Atlas* SpineAtlasVariantLoad::TakeAtlas(spine::TextureLoader** containerTextureLoader) {
+    spine::Atlas* atlas = atlas_;
+    *containerTextureLoader = containerTextureLoader_;
+    atlas_ = nullptr;
+    containerTextureLoader_ = nullptr;
+    return atlas;
+}
+*/
@@ -0,0 +1,117 @@
+//
+// Created on 2026/10/19.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#ifndef SPINEHM_SPINEATLASVARIANT_H
+#define SPINEHM_SPINEATLASVARIANT_H
+/**
+ * SpineAtlasVariant - 按显示缩放选择图集变体
+ * 同一角色可能以 48px 头像或全屏显示，按屏幕上每个骨骼单位的像素数选择分辨率最低、又不低于该密度的变体，
+ * 缩小显示时只解压和上传小图集的页面。变体的容器和区域索引通过资源缓存在实例间共享。
+ * 切换在工作线程上准备（打开容器、解压页面、构建区域索引），完成后由实例在渲染线程上替换。
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+#include "common/common.h"
+
+using std::string;
+
+class SpineAtlasContainer;
+class SpineRegionIndex;
+
+namespace SpineAtlasVariants {
+
+// 降低分辨率的滞后：所需密度低于变体分辨率的该比例才切换到该变体，避免在阈值附近来回切换
+constexpr float kDownswitchRatio = 0.85f;
+
+/**
+ * 整理变体列表：原图集作为 1x 变体，其余按分辨率从高到低排列，忽略路径为空、分辨率不在 (0, 1) 内的变体
+ * @param baseAtlasPath 原图集路径
+ * @param variants 加载选项中的变体
+ * @return 变体列表，第 0 个为原图集
+ */
+std::vector<SpineAtlasVariant> Normalize(const string& baseAtlasPath, const std::vector<SpineAtlasVariant>& variants);
+
+/**
+ * 选择变体
+ * @param variants 整理后的变体列表
+ * @param requiredScale 所需分辨率（屏幕像素 / 原图集像素）
+ * @param current 当前变体下标
+ * @return 分辨率不低于所需分辨率的最小变体；都低于时为原图集
+ */
+size_t Select(const std::vector<SpineAtlasVariant>& variants, float requiredScale, size_t current);
+
+} // namespace SpineAtlasVariants
+
+/**
+ * 一次后台变体切换：在工作线程上准备变体的容器和区域索引，实例在渲染前取走结果
+ * 任务只持有本对象，实例在切换完成前释放时结果随任务一起丢弃
+ */
+class SpineAtlasVariantLoad {
+public:
+    /**
+     * 提交到工作线程
+     * @param variantIndex 变体下标
+     * @param atlasPath 变体路径（原图集可为资源包路径）
+     * @param premultipliedAlpha 未预乘的容器是否准备预乘页面
+     */
+    static std::shared_ptr<SpineAtlasVariantLoad> Start(size_t variantIndex, const string& atlasPath,
+                                                        bool premultipliedAlpha);
+
+    ~SpineAtlasVariantLoad();
+
+    SpineAtlasVariantLoad(const SpineAtlasVariantLoad&) = delete;
+    SpineAtlasVariantLoad& operator=(const SpineAtlasVariantLoad&) = delete;
+
+    /**
+     * 是否已准备完成（成功或失败）
+     */
+    bool IsReady() const { return ready_.load(std::memory_order_acquire); }
+
+    /**
+     * 是否准备成功，须在 IsReady 之后调用
+     */
+    bool Succeeded() const { return succeeded_; }
+
+    size_t GetVariantIndex() const { return variantIndex_; }
+
+    const string& GetAtlasPath() const { return atlasPath_; }
+
+    /**
+     * 变体的图集容器（.atlas 变体为空），须在 IsReady 之后调用
+     */
+    const std::shared_ptr<SpineAtlasContainer>& GetAtlasContainer() const { return atlasContainer_; }
+
+    /**
+     * 变体的区域索引，须在 IsReady 之后调用
+     */
+    const std::shared_ptr<const SpineRegionIndex>& GetRegionIndex() const { return regionIndex_; }
+
+    // 暂时注释掉 Spine 4.2 接入
+    // 取走变体的图集和纹理加载器（之后由实例释放），须在 IsReady 之后调用
+    // spine::Atlas* TakeAtlas(spine::TextureLoader** containerTextureLoader);
+
+private:
+    SpineAtlasVariantLoad() = default;
+
+    void Run();
+
+    size_t variantIndex_ = 0;
+    string atlasPath_;
+    bool premultipliedAlpha_ = true;
+
+    std::shared_ptr<SpineAtlasContainer> atlasContainer_;
+    std::shared_ptr<const SpineRegionIndex> regionIndex_;
+    // spine::Atlas* atlas_;                           // 变体的图集（页面纹理已创建）
+    // spine::TextureLoader* containerTextureLoader_;  // 从变体容器提供页面纹理
+    bool succeeded_ = false;
+    std::atomic<bool> ready_{false};
+};
+
+#endif //SPINEHM_SPINEATLASVARIANT_H
@@ -0,0 +1,94 @@
+//
+// Created on 2026/10/19.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+/**
+ * SpineBoundsTable.cpp - 动画包围盒表实现
+ */
+
+#include "SpineBoundsTable.h"
+#include "common/SpineMemoryTracker.h"
+#include <algorithm>
+#include <cmath>
+
+// ==================== SpineBoundsTable ====================
+
+size_t SpineBoundsTable::SampleCount(float duration) {
+    if (!(duration > 0.0f)) {
+        return 2;
+    }
+    size_t intervals = static_cast<size_t>(std::ceil(duration / kSampleInterval));
+    return std::max<size_t>(intervals, 1) + 1;
+}
+
+float SpineBoundsTable::SampleTime(float duration, size_t index) {
+    return std::min(static_cast<float>(index) * kSampleInterval, std::max(duration, 0.0f));
+}
+
+std::shared_ptr<const SpineBoundsTable> SpineBoundsTable::Build(float duration, const std::vector<SpineRect>& samples) {
+    if (samples.size() != SampleCount(duration)) {
+        return nullptr;
+    }
+
+    std::vector<SpineRect> intervals(samples.size() - 1);
+    for (size_t i = 0; i < intervals.size(); ++i) {
+        SpineRect rect = samples[i];
+        rect.Union(samples[i + 1]);
+        if (!rect.IsEmpty()) {
+            float padding = std::max(rect.right - rect.left, rect.bottom - rect.top) * kPaddingRatio;
+            rect.left -= padding;
+            rect.top -= padding;
+            rect.right += padding;
+            rect.bottom += padding;
+        }
+        intervals[i] = rect;
+    }
+    return std::shared_ptr<const SpineBoundsTable>(new SpineBoundsTable(std::max(duration, 0.0f), std::move(intervals)));
+}
+
+const SpineRect& SpineBoundsTable::Lookup(float time) const {
+    size_t index = 0;
+    if (time > 0.0f) {
+        index = std::min(static_cast<size_t>(time / kSampleInterval), intervals_.size() - 1);
+    }
+    return intervals_[index];
+}
+
+// ==================== SpineBoundsTableSet ====================
+
+SpineBoundsTableSet::~SpineBoundsTableSet() {
+    SpineMemoryTracker::getInstance().Sub(SpineMemoryCategory::kSkeletonData, memoryBytes_);
+}
+
+string SpineBoundsTableSet::MakeKey(const string& skinName, const string& animationName) {
+    return skinName + '\n' + animationName;
+}
+
+std::shared_ptr<const SpineBoundsTable> SpineBoundsTableSet::Find(const string& key) const {
+    std::lock_guard<std::mutex> lock(tablesMutex_);
+    auto it = tables_.find(key);
+    return it != tables_.end() ? it->second : nullptr;
+}
+
+std::shared_ptr<const SpineBoundsTable> SpineBoundsTableSet::Insert(const string& key,
+                                                                    std::shared_ptr<const SpineBoundsTable> table) {
+    if (!table) {
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(tablesMutex_);
+    auto result = tables_.emplace(key, std::move(table));
+    if (result.second) {
+        size_t bytes = result.first->second->GetMemoryBytes() + key.capacity();
+        memoryBytes_ += bytes;
+        SpineMemoryTracker::getInstance().Add(SpineMemoryCategory::kSkeletonData, bytes);
+    }
+    return result.first->second;
+}
+
+size_t SpineBoundsTableSet::GetMemoryBytes() const {
+    std::lock_guard<std::mutex> lock(tablesMutex_);
+    return memoryBytes_;
+}
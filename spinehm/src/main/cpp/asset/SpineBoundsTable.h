@@ -0,0 +1,113 @@
+//
+// Created on 2026/10/19.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#ifndef SPINEHM_SPINEBOUNDSTABLE_H
+#define SPINEHM_SPINEBOUNDSTABLE_H
+/**
+ * SpineBoundsTable - 动画包围盒表
+ * 按固定间隔采样动画在骨骼坐标下的包围盒，每个采样区间保存相邻两次采样的并集并外扩，
+ * 只凭轨道时间即可得到保守的包围盒，不需要先计算姿态。
+ * 同一骨骼数据的表通过资源缓存在实例间共享，首次用到某个动画时才采样。
+ */
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "common/common.h"
+
+using std::string;
+
+class SpineBoundsTable {
+public:
+    // 采样间隔（秒）
+    static constexpr float kSampleInterval = 1.0f / 30.0f;
+    // 区间包围盒按边长外扩的比例，覆盖采样点之间的运动
+    static constexpr float kPaddingRatio = 0.05f;
+
+    /**
+     * 采样点个数
+     * @param duration 动画时长（秒）
+     */
+    static size_t SampleCount(float duration);
+
+    /**
+     * 第 index 个采样点的动画时间（最后一个采样点为动画结尾）
+     */
+    static float SampleTime(float duration, size_t index);
+
+    /**
+     * 由采样结果构建包围盒表
+     * @param duration 动画时长（秒）
+     * @param samples 各采样点的骨骼包围盒（骨骼坐标），个数必须为 SampleCount(duration)
+     * @return 包围盒表，采样个数不符时返回 nullptr
+     */
+    static std::shared_ptr<const SpineBoundsTable> Build(float duration, const std::vector<SpineRect>& samples);
+
+    /**
+     * 查询动画时间所在区间的保守包围盒
+     * @param time 动画时间（秒），超出范围时取首尾区间
+     * @return 骨骼坐标下的包围盒，该区间没有可见附件时为空
+     */
+    const SpineRect& Lookup(float time) const;
+
+    float GetDuration() const { return duration_; }
+
+    size_t GetMemoryBytes() const { return sizeof(*this) + intervals_.capacity() * sizeof(SpineRect); }
+
+private:
+    SpineBoundsTable(float duration, std::vector<SpineRect> intervals)
+        : duration_(duration), intervals_(std::move(intervals)) {}
+
+    float duration_;
+    std::vector<SpineRect> intervals_;
+};
+
+/**
+ * 一份骨骼数据的所有包围盒表（按皮肤和动画名称索引）
+ */
+class SpineBoundsTableSet {
+public:
+    SpineBoundsTableSet() = default;
+    ~SpineBoundsTableSet();
+
+    SpineBoundsTableSet(const SpineBoundsTableSet&) = delete;
+    SpineBoundsTableSet& operator=(const SpineBoundsTableSet&) = delete;
+
+    /**
+     * 生成表的索引键
+     * @param skinName 皮肤名称
+     * @param animationName 动画名称
+     */
+    static string MakeKey(const string& skinName, const string& animationName);
+
+    /**
+     * 查找已采样的表
+     * @return 包围盒表，尚未采样时返回 nullptr
+     */
+    std::shared_ptr<const SpineBoundsTable> Find(const string& key) const;
+
+    /**
+     * 保存采样结果，其他实例已先保存时沿用已有的表
+     * @return 保存后的表
+     */
+    std::shared_ptr<const SpineBoundsTable> Insert(const string& key, std::shared_ptr<const SpineBoundsTable> table);
+
+    /**
+     * 已采样表占用的字节数
+     */
+    size_t GetMemoryBytes() const;
+
+private:
+    std::unordered_map<string, std::shared_ptr<const SpineBoundsTable>> tables_;
+    size_t memoryBytes_ = 0;
+    mutable std::mutex tablesMutex_;
+};
+
+#endif //SPINEHM_SPINEBOUNDSTABLE_H
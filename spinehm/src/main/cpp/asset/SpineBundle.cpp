@@ -0,0 +1,112 @@
+//
+// Created on 2026/10/19.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+/**
+ * SpineBundle.cpp - 资源包运行时加载实现
+ */
+
+#include "SpineBundle.h"
+#include "asset/SpineAtlasContainer.h"
+#include "asset/SpineBundleFormat.h"
+#include "common/SpineMemoryTracker.h"
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace SpineBundleFormat;
+
+std::shared_ptr<SpineBundle> SpineBundle::Open(const string& path) {
+    int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return nullptr;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(sizeof(Header))) {
+        close(fd);
+        return nullptr;
+    }
+
+    const size_t size = static_cast<size_t>(st.st_size);
+    void* address = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (address == MAP_FAILED) {
+        return nullptr;
+    }
+    SpineMemoryTracker::getInstance().Add(SpineMemoryCategory::kAtlas, size);
+
+    std::shared_ptr<SpineBundle> bundle(new SpineBundle());
+    bundle->path_ = path;
+    bundle->mapping_ = std::shared_ptr<void>(address, [size](void* mapping) {
+        munmap(mapping, size);
+        SpineMemoryTracker::getInstance().Sub(SpineMemoryCategory::kAtlas, size);
+    });
+
+    // 校验文件头和段表
+    const uint8_t* base = static_cast<const uint8_t*>(address);
+    const Header* header = reinterpret_cast<const Header*>(base);
+    if (std::memcmp(header->magic, kMagic, sizeof(kMagic)) != 0 || header->version != kVersion ||
+        header->sectionTableOffset % alignof(Section) != 0 || header->sectionTableOffset > size ||
+        static_cast<uint64_t>(header->sectionCount) * sizeof(Section) > size - header->sectionTableOffset) {
+        return nullptr;
+    }
+
+    const Section* sections = reinterpret_cast<const Section*>(base + header->sectionTableOffset);
+    const Section* atlasSection = nullptr;
+    for (uint32_t i = 0; i < header->sectionCount; ++i) {
+        const Section& section = sections[i];
+        if (section.offset % kSectionAlignment != 0 || section.offset > size || section.size > size - section.offset) {
+            return nullptr;
+        }
+        switch (section.type) {
+            case kSectionSkeletonJson:
+                // 结尾的 '\0' 必须在文件内
+                if (section.size >= size - section.offset || base[section.offset + section.size] != '\0') {
+                    return nullptr;
+                }
+                bundle->skeletonJson_ = true;
+                bundle->skeletonData_ = base + section.offset;
+                bundle->skeletonSize_ = static_cast<size_t>(section.size);
+                break;
+            case kSectionSkeletonBinary:
+                bundle->skeletonJson_ = false;
+                bundle->skeletonData_ = base + section.offset;
+                bundle->skeletonSize_ = static_cast<size_t>(section.size);
+                break;
+            case kSectionAtlasContainer:
+                atlasSection = &section;
+                break;
+            default:
+                // 未知段跳过，便于以后追加
+                break;
+        }
+    }
+    if (!bundle->skeletonData_ || !atlasSection) {
+        return nullptr;
+    }
+
+    bundle->atlasContainer_ = SpineAtlasContainer::OpenView(path, bundle->mapping_, base + atlasSection->offset,
+                                                            static_cast<size_t>(atlasSection->size));
+    if (!bundle->atlasContainer_) {
+        return nullptr;
+    }
+
+    // 骨骼数据和页面马上会被使用，提前让内核预读
+    madvise(address, size, MADV_WILLNEED);
+    return bundle;
+}
+
+bool SpineBundle::IsBundlePath(const string& path) {
+    const size_t extLength = std::strlen(kFileExtension);
+    return path.size() > extLength && path.compare(path.size() - extLength, extLength, kFileExtension) == 0;
+}
+
+const uint8_t* SpineBundle::GetSkeletonData(size_t* size) const {
+    *size = skeletonSize_;
+    return skeletonData_;
+}
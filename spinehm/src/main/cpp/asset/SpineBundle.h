@@ -0,0 +1,72 @@
+//
+// Created on 2026/10/19.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#ifndef SPINEHM_SPINEBUNDLE_H
+#define SPINEHM_SPINEBUNDLE_H
+/**
+ * SpineBundle - 资源包运行时加载
+ * 一次 open + mmap 得到骨骼数据和图集容器，替代分别打开骨骼、.atlas 和各页面图片。
+ * 图集容器直接引用包内的映射，共享同一份映射内存。
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+using std::string;
+
+class SpineAtlasContainer;
+
+class SpineBundle {
+public:
+    /**
+     * 打开资源包
+     * @param path 资源包路径
+     * @return 资源包，文件不存在、格式错误或缺少骨骼数据、图集容器时返回 nullptr
+     */
+    static std::shared_ptr<SpineBundle> Open(const string& path);
+
+    /**
+     * 是否为资源包路径（按扩展名判断）
+     * @param path 文件路径
+     */
+    static bool IsBundlePath(const string& path);
+
+    SpineBundle(const SpineBundle&) = delete;
+    SpineBundle& operator=(const SpineBundle&) = delete;
+
+    const string& GetPath() const { return path_; }
+
+    /**
+     * 获取骨骼数据，指向映射内存
+     * @param size 输出字节数（JSON 不含结尾的 '\0'）
+     */
+    const uint8_t* GetSkeletonData(size_t* size) const;
+
+    /**
+     * 骨骼数据是否为 JSON（否则为二进制 .skel）
+     */
+    bool IsSkeletonJson() const { return skeletonJson_; }
+
+    /**
+     * 获取包内的图集容器（与资源包共享映射）
+     */
+    const std::shared_ptr<SpineAtlasContainer>& GetAtlasContainer() const { return atlasContainer_; }
+
+private:
+    SpineBundle() = default;
+
+    string path_;
+    std::shared_ptr<void> mapping_;  // 释放时解除映射，图集容器持有同一引用
+
+    const uint8_t* skeletonData_ = nullptr;
+    size_t skeletonSize_ = 0;
+    bool skeletonJson_ = false;
+    std::shared_ptr<SpineAtlasContainer> atlasContainer_;
+};
+
+#endif //SPINEHM_SPINEBUNDLE_H
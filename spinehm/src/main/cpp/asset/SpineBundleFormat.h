@@ -0,0 +1,64 @@
+//
+// Created on 2026/10/19.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#ifndef SPINEHM_SPINEBUNDLEFORMAT_H
+#define SPINEHM_SPINEBUNDLEFORMAT_H
+/**
+ * 资源包文件格式（.sbundle）
+ * 一个角色的骨骼数据和图集容器打包为单个文件，由离线工具 tools/spine_bundle_pack 生成，
+ * 运行时只打开、mmap 一次。
+ *
+ * 文件布局（小端）：
+ *   Header | 段表 | 段数据...
+ * 每个段按 kSectionAlignment（4096）对齐，图集容器段内的页面数据因此仍按页对齐。
+ * JSON 骨骼段之后紧跟一个 '\0'（不计入段大小），可直接作为字符串交给运行时解析。
+ */
+
+#include <cstdint>
+
+namespace SpineBundleFormat {
+
+constexpr char kMagic[4] = {'S', 'P', 'B', 'N'};
+constexpr uint32_t kVersion = 1;
+constexpr uint32_t kSectionAlignment = 4096;
+constexpr const char* kFileExtension = ".sbundle";
+
+/**
+ * 段类型（各类型最多一个）
+ */
+enum SectionType : uint32_t {
+    kSectionSkeletonJson = 1,    // .json 骨骼数据
+    kSectionSkeletonBinary = 2,  // .skel 骨骼数据
+    kSectionAtlasContainer = 3,  // 完整的 .satlas 图集容器
+};
+
+/**
+ * 文件头
+ */
+struct Header {
+    char magic[4];
+    uint32_t version;
+    uint32_t flags;             // 保留，为 0
+    uint32_t sectionCount;
+    uint64_t sectionTableOffset;
+};
+
+/**
+ * 段表项
+ */
+struct Section {
+    uint32_t type;
+    uint32_t reserved;
+    uint64_t offset;            // 按 kSectionAlignment 对齐
+    uint64_t size;
+};
+
+static_assert(sizeof(Header) == 24, "SpineBundleFormat::Header layout changed");
+static_assert(sizeof(Section) == 24, "SpineBundleFormat::Section layout changed");
+
+} // namespace SpineBundleFormat
+
+#endif //SPINEHM_SPINEBUNDLEFORMAT_H
@@ -0,0 +1,181 @@
+//
+// Created on 2026/10/19.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+/**
+ * SpineLz4.cpp - LZ4 块格式编解码实现
+ * 格式说明：https://github.com/lz4/lz4/blob/dev/doc/lz4_Block_format.md
+ */
+
+#include "SpineLz4.h"
+#include <cstring>
+
+namespace SpineLz4 {
+
+namespace {
+
+constexpr size_t kMinMatch = 4;
+constexpr size_t kLastLiterals = 5;   // 块末尾至少 5 字节为字面量
+constexpr size_t kMatchFindLimit = 12; // 最后一个匹配必须在块末尾 12 字节之前开始
+constexpr size_t kMaxOffset = 65535;
+constexpr int kHashBits = 16;
+
+inline uint32_t Read32(const uint8_t* p) {
+    uint32_t value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+inline uint32_t Hash(uint32_t sequence) {
+    return (sequence * 2654435761u) >> (32 - kHashBits);
+}
+
+inline void WriteLength(size_t length, std::vector<uint8_t>* dst) {
+    while (length >= 255) {
+        dst->push_back(255);
+        length -= 255;
+    }
+    dst->push_back(static_cast<uint8_t>(length));
+}
+
+inline bool ReadLength(const uint8_t** ip, const uint8_t* end, size_t* length) {
+    uint8_t byte;
+    do {
+        if (*ip >= end) {
+            return false;
+        }
+        byte = *(*ip)++;
+        *length += byte;
+    } while (byte == 255);
+    return true;
+}
+
+void EmitSequence(const uint8_t* literals, size_t literalLength, size_t offset, size_t matchLength,
+                  std::vector<uint8_t>* dst) {
+    size_t tokenPos = dst->size();
+    dst->push_back(0);
+
+    uint8_t token = static_cast<uint8_t>((literalLength >= 15 ? 15 : literalLength) << 4);
+    if (literalLength >= 15) {
+        WriteLength(literalLength - 15, dst);
+    }
+    dst->insert(dst->end(), literals, literals + literalLength);
+
+    // 只有字面量的最后一个序列
+    if (matchLength == 0) {
+        (*dst)[tokenPos] = token;
+        return;
+    }
+
+    dst->push_back(static_cast<uint8_t>(offset & 0xff));
+    dst->push_back(static_cast<uint8_t>(offset >> 8));
+
+    size_t extraMatch = matchLength - kMinMatch;
+    token |= static_cast<uint8_t>(extraMatch >= 15 ? 15 : extraMatch);
+    if (extraMatch >= 15) {
+        WriteLength(extraMatch - 15, dst);
+    }
+    (*dst)[tokenPos] = token;
+}
+
+} // namespace
+
+bool Decompress(const uint8_t* src, size_t srcSize, uint8_t* dst, size_t dstSize) {
+    const uint8_t* ip = src;
+    const uint8_t* const srcEnd = src + srcSize;
+    uint8_t* op = dst;
+    uint8_t* const dstEnd = dst + dstSize;
+
+    while (ip < srcEnd) {
+        const uint8_t token = *ip++;
+
+        // 字面量
+        size_t literalLength = token >> 4;
+        if (literalLength == 15 && !ReadLength(&ip, srcEnd, &literalLength)) {
+            return false;
+        }
+        if (literalLength > static_cast<size_t>(srcEnd - ip) || literalLength > static_cast<size_t>(dstEnd - op)) {
+            return false;
+        }
+        std::memcpy(op, ip, literalLength);
+        ip += literalLength;
+        op += literalLength;
+
+        // 最后一个序列没有匹配部分
+        if (ip == srcEnd) {
+            break;
+        }
+
+        // 匹配
+        if (srcEnd - ip < 2) {
+            return false;
+        }
+        size_t offset = static_cast<size_t>(ip[0]) | (static_cast<size_t>(ip[1]) << 8);
+        ip += 2;
+        if (offset == 0 || offset > static_cast<size_t>(op - dst)) {
+            return false;
+        }
+
+        size_t matchLength = token & 0x0f;
+        if (matchLength == 15 && !ReadLength(&ip, srcEnd, &matchLength)) {
+            return false;
+        }
+        matchLength += kMinMatch;
+        if (matchLength > static_cast<size_t>(dstEnd - op)) {
+            return false;
+        }
+
+        const uint8_t* match = op - offset;
+        if (offset >= matchLength) {
+            std::memcpy(op, match, matchLength);
+            op += matchLength;
+        } else {
+            // 重叠复制（重复模式）必须逐字节进行
+            for (size_t i = 0; i < matchLength; ++i) {
+                *op++ = *match++;
+            }
+        }
+    }
+
+    return op == dstEnd;
+}
+
+void Compress(const uint8_t* src, size_t srcSize, std::vector<uint8_t>* dst) {
+    dst->clear();
+    dst->reserve(srcSize + srcSize / 255 + 16);
+
+    size_t anchor = 0;
+    if (srcSize > kMatchFindLimit) {
+        std::vector<int64_t> table(static_cast<size_t>(1) << kHashBits, -1);
+        const size_t matchFindEnd = srcSize - kMatchFindLimit;
+        const size_t matchEnd = srcSize - kLastLiterals;
+
+        size_t ip = 0;
+        while (ip <= matchFindEnd) {
+            const uint32_t sequence = Read32(src + ip);
+            const uint32_t h = Hash(sequence);
+            const int64_t ref = table[h];
+            table[h] = static_cast<int64_t>(ip);
+
+            if (ref < 0 || ip - static_cast<size_t>(ref) > kMaxOffset || Read32(src + ref) != sequence) {
+                ++ip;
+                continue;
+            }
+
+            size_t matchLength = kMinMatch;
+            while (ip + matchLength < matchEnd && src[ref + matchLength] == src[ip + matchLength]) {
+                ++matchLength;
+            }
+
+            EmitSequence(src + anchor, ip - anchor, ip - static_cast<size_t>(ref), matchLength, dst);
+            ip += matchLength;
+            anchor = ip;
+        }
+    }
+
+    EmitSequence(src + anchor, srcSize - anchor, 0, 0, dst);
+}
+
+} // namespace SpineLz4
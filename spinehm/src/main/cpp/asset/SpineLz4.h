@@ -0,0 +1,40 @@
+//
+// Created on 2026/10/19.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#ifndef SPINEHM_SPINELZ4_H
+#define SPINEHM_SPINELZ4_H
+/**
+ * SpineLz4 - LZ4 块格式编解码
+ * 运行时只用解压；压缩供离线工具生成图集容器
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace SpineLz4 {
+
+/**
+ * 解压 LZ4 块
+ * @param src 压缩数据
+ * @param srcSize 压缩数据字节数
+ * @param dst 输出缓冲
+ * @param dstSize 解压后的字节数（必须与原始大小一致）
+ * @return 是否解压成功（数据损坏或大小不符时返回 false）
+ */
+bool Decompress(const uint8_t* src, size_t srcSize, uint8_t* dst, size_t dstSize);
+
+/**
+ * 压缩为 LZ4 块（贪心匹配，64KB 窗口）
+ * @param src 原始数据
+ * @param srcSize 原始数据字节数
+ * @param dst 输出缓冲
+ */
+void Compress(const uint8_t* src, size_t srcSize, std::vector<uint8_t>* dst);
+
+} // namespace SpineLz4
+
+#endif //SPINEHM_SPINELZ4_H
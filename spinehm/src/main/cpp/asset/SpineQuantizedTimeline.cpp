@@ -0,0 +1,289 @@
+//
+// Created on 2026/10/19.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+/**
+ * SpineQuantizedTimeline.cpp - 关键帧量化存储实现
+ */
+
+#include "SpineQuantizedTimeline.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+
+namespace {
+std::atomic<uint64_t> g_quantizedArrays{0};
+std::atomic<uint64_t> g_rejectedArrays{0};
+std::atomic<uint64_t> g_floatBytes{0};
+std::atomic<uint64_t> g_quantizedBytes{0};
+
+void CountRejected(size_t count) {
+    g_rejectedArrays.fetch_add(1, std::memory_order_relaxed);
+    g_floatBytes.fetch_add(count * sizeof(float), std::memory_order_relaxed);
+    g_quantizedBytes.fetch_add(count * sizeof(float), std::memory_order_relaxed);
+}
+}
+
+bool SpineQuantizedFrames::Encode(const float* values, size_t count, size_t stride, const float* tolerances) {
+    stride_ = 0;
+    offsets_.clear();
+    steps_.clear();
+    codes_.clear();
+    if (stride == 0 || count == 0 || count % stride != 0) {
+        return false;
+    }
+
+    const size_t rows = count / stride;
+    std::vector<float> offsets(stride);
+    std::vector<float> steps(stride);
+    for (size_t column = 0; column < stride; ++column) {
+        float minValue = values[column];
+        float maxValue = values[column];
+        for (size_t row = 0; row < rows; ++row) {
+            float value = values[row * stride + column];
+            if (!std::isfinite(value)) {
+                CountRejected(count);
+                return false;
+            }
+            minValue = std::min(minValue, value);
+            maxValue = std::max(maxValue, value);
+        }
+
+        // 误差最大为步长的一半
+        double step = (static_cast<double>(maxValue) - minValue) / kMaxCode;
+        if (!(tolerances[column] > 0.0f) || step > 2.0 * tolerances[column]) {
+            CountRejected(count);
+            return false;
+        }
+        offsets[column] = minValue;
+        steps[column] = static_cast<float>(step);
+    }
+
+    std::vector<uint16_t> codes(count);
+    for (size_t row = 0; row < rows; ++row) {
+        for (size_t column = 0; column < stride; ++column) {
+            const size_t index = row * stride + column;
+            uint32_t code = 0;
+            if (steps[column] > 0.0f) {
+                double scaled = (static_cast<double>(values[index]) - offsets[column]) / steps[column];
+                code = static_cast<uint32_t>(std::min<double>(std::lround(scaled), kMaxCode));
+            }
+            codes[index] = static_cast<uint16_t>(code);
+
+            // 按实际解码结果校验，单精度的舍入也计入误差
+            float decoded = offsets[column] + steps[column] * static_cast<float>(code);
+            if (std::fabs(decoded - values[index]) > tolerances[column]) {
+                CountRejected(count);
+                return false;
+            }
+        }
+    }
+
+    stride_ = stride;
+    offsets_ = std::move(offsets);
+    steps_ = std::move(steps);
+    codes_ = std::move(codes);
+
+    g_quantizedArrays.fetch_add(1, std::memory_order_relaxed);
+    g_floatBytes.fetch_add(count * sizeof(float), std::memory_order_relaxed);
+    g_quantizedBytes.fetch_add(GetMemoryBytes(), std::memory_order_relaxed);
+    return true;
+}
+
+void SpineQuantizedFrames::DecodeRow(size_t row, float* out) const {
+    const uint16_t* codes = codes_.data() + row * stride_;
+    for (size_t column = 0; column < stride_; ++column) {
+        out[column] = offsets_[column] + steps_[column] * static_cast<float>(codes[column]);
+    }
+}
+
+size_t SpineQuantizedFrames::SearchRow(float time) const {
+    // 时间单调不减，量化后仍单调不减
+    size_t low = 0;
+    size_t high = GetRowCount();
+    while (low < high) {
+        size_t mid = (low + high) / 2;
+        if (Get(mid, 0) <= time) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low > 0 ? low - 1 : 0;
+}
+
+SpineQuantizeStats SpineQuantizedFrames::GetStats() {
+    SpineQuantizeStats stats;
+    stats.arrays = g_quantizedArrays.load(std::memory_order_relaxed);
+    stats.rejected = g_rejectedArrays.load(std::memory_order_relaxed);
+    stats.floatBytes = g_floatBytes.load(std::memory_order_relaxed);
+    stats.quantizedBytes = g_quantizedBytes.load(std::memory_order_relaxed);
+    return stats;
+}
+
+// ==================== 运行时接入 ====================
+
+// 暂时注释掉 Spine 4.2 接入
+/*
+namespace {
+// 运行时的曲线类型和贝塞尔段长度（与 spine::CurveTimeline 一致）
+constexpr int kCurveStepped = 1;
+constexpr int kCurveBezier = 2;
+constexpr size_t kBezierSize = 18;
+
+// 时间轴各值通道的允许误差；返回 0 表示不处理（含整数通道的 IK 时间轴和只有时间的时间轴）
+float ValueTolerance(spine::Timeline* timeline, const SpineQuantizeTolerance& tolerance) {
+    const spine::RTTI& rtti = timeline->getRTTI();
+    if (!rtti.instanceOf(spine::CurveTimeline::rtti) || rtti.isExactly(spine::IkConstraintTimeline::rtti)) {
+        return 0.0f;
+    }
+    if (rtti.isExactly(spine::RotateTimeline::rtti)) {
+        return tolerance.rotate;
+    }
+    if (rtti.isExactly(spine::TranslateTimeline::rtti) || rtti.isExactly(spine::TranslateXTimeline::rtti) ||
+        rtti.isExactly(spine::TranslateYTimeline::rtti)) {
+        return tolerance.translate;
+    }
+    if (rtti.isExactly(spine::ScaleTimeline::rtti) || rtti.isExactly(spine::ScaleXTimeline::rtti) ||
+        rtti.isExactly(spine::ScaleYTimeline::rtti)) {
+        return tolerance.scale;
+    }
+    if (rtti.isExactly(spine::ShearTimeline::rtti) || rtti.isExactly(spine::ShearXTimeline::rtti) ||
+        rtti.isExactly(spine::ShearYTimeline::rtti)) {
+        return tolerance.shear;
+    }
+    if (rtti.isExactly(spine::RGBATimeline::rtti) || rtti.isExactly(spine::RGBTimeline::rtti) ||
+        rtti.isExactly(spine::AlphaTimeline::rtti) || rtti.isExactly(spine::RGBA2Timeline::rtti) ||
+        rtti.isExactly(spine::RGB2Timeline::rtti)) {
+        return tolerance.color;
+    }
+    // 变形时间轴的曲线值是 0~1 的进度，顶点偏移单独量化
+    return tolerance.constraint;
+}
+}
+
+void SpineQuantizedAnimation::Build(spine::Animation* animation, const SpineQuantizeTolerance& tolerance) {
+    spine::Vector<spine::Timeline*>& timelines = animation->getTimelines();
+    for (size_t i = 0; i < timelines.size(); ++i) {
+        float valueTolerance = ValueTolerance(timelines[i], tolerance);
+        if (valueTolerance <= 0.0f) {
+            continue;
+        }
+        auto* timeline = static_cast<spine::CurveTimeline*>(timelines[i]);
+        SpineQuantizedTimelineEntry entry;
+        entry.timeline = timeline;
+        entry.frameEntries = timeline->getFrameEntries();
+        entry.frameCount = timeline->getFrameCount();
+        entry.valueCount = entry.frameEntries - 1;
+        if (entry.frameCount < 3) {
+            continue;
+        }
+
+        spine::Vector<float>& frames = timeline->getFrames();
+        std::vector<float> frameTolerances(entry.frameEntries, valueTolerance);
+        frameTolerances[0] = tolerance.time;
+        if (!entry.frames.Encode(frames.buffer(), frames.size(), entry.frameEntries, frameTolerances.data())) {
+            continue;
+        }
+
+        spine::Vector<float>& curves = timeline->getCurves();
+        const float bezierTolerances[2] = {tolerance.time, valueTolerance};
+        if (curves.size() > entry.frameCount &&
+            !entry.bezier.Encode(curves.buffer() + entry.frameCount, curves.size() - entry.frameCount, 2,
+                                 bezierTolerances)) {
+            continue;
+        }
+        entry.curveTypes.resize(entry.frameCount);
+        for (size_t frame = 0; frame < entry.frameCount; ++frame) {
+            int type = static_cast<int>(curves[frame]);
+            entry.curveTypes[frame] = type < kCurveBezier
+                ? static_cast<uint32_t>(type)
+                : static_cast<uint32_t>((type - kCurveBezier - entry.frameCount) / 2 + kCurveBezier);
+        }
+
+        if (timeline->getRTTI().isExactly(spine::DeformTimeline::rtti)) {
+            auto* deformTimeline = static_cast<spine::DeformTimeline*>(timeline);
+            spine::Vector<spine::Vector<float>>& vertices = deformTimeline->getVertices();
+            entry.deformSize = vertices[0].size();
+            std::vector<float> flat;
+            flat.reserve(entry.deformSize * entry.frameCount);
+            for (size_t frame = 0; frame < entry.frameCount; ++frame) {
+                if (vertices[frame].size() != entry.deformSize) {
+                    flat.clear();
+                    break;
+                }
+                flat.insert(flat.end(), vertices[frame].buffer(), vertices[frame].buffer() + entry.deformSize);
+            }
+            if (flat.empty() || !entry.deform.Encode(flat.data(), flat.size(), 1, &tolerance.deform)) {
+                continue;
+            }
+            vertices = spine::Vector<spine::Vector<float>>();
+        }
+
+        // 运行时的 Vector 不会缩容，换成空数组释放原数据，再填入开头的窗口
+        frames = spine::Vector<float>();
+        curves = spine::Vector<float>();
+        FillWindow(entry, 0, 1);
+
+        memoryBytes_ += entry.frames.GetMemoryBytes() + entry.bezier.GetMemoryBytes() + entry.deform.GetMemoryBytes() +
+                        entry.curveTypes.capacity() * sizeof(uint32_t);
+        entries_.push_back(std::move(entry));
+    }
+}
+
+void SpineQuantizedAnimation::Seek(float minTime, float maxTime) {
+    for (SpineQuantizedTimelineEntry& entry : entries_) {
+        size_t firstRow = entry.frames.SearchRow(minTime);
+        size_t lastRow = std::min(entry.frames.SearchRow(maxTime) + 1, entry.frameCount - 1);
+        if (firstRow != entry.windowFirst || lastRow != entry.windowLast) {
+            FillWindow(entry, firstRow, lastRow);
+        }
+    }
+}
+
+void SpineQuantizedAnimation::FillWindow(SpineQuantizedTimelineEntry& entry, size_t firstRow, size_t lastRow) {
+    entry.windowFirst = firstRow;
+    entry.windowLast = lastRow;
+    const size_t rowCount = lastRow - firstRow + 1;
+    spine::Vector<float>& frames = entry.timeline->getFrames();
+    spine::Vector<float>& curves = entry.timeline->getCurves();
+
+    frames.setSize(entry.frameEntries * rowCount, 0.0f);
+    for (size_t i = 0; i < rowCount; ++i) {
+        entry.frames.DecodeRow(firstRow + i, frames.buffer() + i * entry.frameEntries);
+    }
+
+    // 曲线头部每帧一项，贝塞尔采样点按窗口重新排在头部之后；窗口最后一帧与运行时一致为阶梯
+    curves.setSize(rowCount, 0.0f);
+    float point[2];
+    for (size_t i = 0; i < rowCount; ++i) {
+        uint32_t type = i + 1 == rowCount ? kCurveStepped : entry.curveTypes[firstRow + i];
+        if (type < kCurveBezier) {
+            curves[i] = static_cast<float>(type);
+            continue;
+        }
+        curves[i] = static_cast<float>(kCurveBezier + curves.size());
+        size_t firstPoint = type - kCurveBezier;
+        for (size_t j = 0; j < entry.valueCount * kBezierSize / 2; ++j) {
+            entry.bezier.DecodeRow(firstPoint + j, point);
+            curves.add(point[0]);
+            curves.add(point[1]);
+        }
+    }
+
+    if (entry.deformSize > 0) {
+        auto* deformTimeline = static_cast<spine::DeformTimeline*>(entry.timeline);
+        spine::Vector<spine::Vector<float>>& vertices = deformTimeline->getVertices();
+        vertices.setSize(rowCount, spine::Vector<float>());
+        for (size_t i = 0; i < rowCount; ++i) {
+            vertices[i].setSize(entry.deformSize, 0.0f);
+            size_t base = (firstRow + i) * entry.deformSize;
+            for (size_t j = 0; j < entry.deformSize; ++j) {
+                vertices[i][j] = entry.deform.Get(base + j, 0);
+            }
+        }
+    }
+}
+*/
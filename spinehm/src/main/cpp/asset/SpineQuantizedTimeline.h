@@ -0,0 +1,128 @@
+//
+// Created on 2026/10/19.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#ifndef SPINEHM_SPINEQUANTIZEDTIMELINE_H
+#define SPINEHM_SPINEQUANTIZEDTIMELINE_H
+/**
+ * SpineQuantizedTimeline - 时间轴关键帧的 16 位量化存储
+ * 关键帧按行存放（每行为时间加各通道值），每列单独记录偏移和步长，
+ * 步长取列的取值范围 / 65535，列的误差不超过步长的一半；超出该列允许误差时整个数组保留浮点。
+ * 采样时只解码当前时间两侧的关键帧。
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "common/common.h"
+
+/**
+ * 量化统计（进程内累计）
+ */
+struct SpineQuantizeStats {
+    uint64_t arrays = 0;          // 已量化的数组数
+    uint64_t rejected = 0;        // 误差超限、保留浮点的数组数
+    uint64_t floatBytes = 0;      // 量化前的字节数（含保留浮点的数组）
+    uint64_t quantizedBytes = 0;  // 量化后的字节数（含保留浮点的数组）
+};
+
+class SpineQuantizedFrames {
+public:
+    // 每个值的最大编码
+    static constexpr uint32_t kMaxCode = 0xFFFF;
+
+    /**
+     * 量化关键帧数组
+     * @param values 原始数组，按行存放，每行 stride 个值
+     * @param count 值个数（stride 的整数倍）
+     * @param stride 每行的值个数
+     * @param tolerances 各列允许的最大误差（stride 个，须大于 0）
+     * @return 是否成功；有列的取值范围过大或含非有限值时返回 false，调用方保留浮点数据
+     */
+    bool Encode(const float* values, size_t count, size_t stride, const float* tolerances);
+
+    size_t GetRowCount() const { return stride_ ? codes_.size() / stride_ : 0; }
+
+    size_t GetStride() const { return stride_; }
+
+    /**
+     * 解码单个值
+     */
+    float Get(size_t row, size_t column) const {
+        return offsets_[column] + steps_[column] * static_cast<float>(codes_[row * stride_ + column]);
+    }
+
+    /**
+     * 解码一行
+     * @param row 行号
+     * @param out 输出（stride 个值）
+     */
+    void DecodeRow(size_t row, float* out) const;
+
+    /**
+     * 按第 0 列（时间）查找最后一个不晚于 time 的行
+     * @return 行号，time 早于首行时返回 0
+     */
+    size_t SearchRow(float time) const;
+
+    size_t GetMemoryBytes() const {
+        return codes_.capacity() * sizeof(uint16_t) + (offsets_.capacity() + steps_.capacity()) * sizeof(float);
+    }
+
+    /**
+     * 获取进程内累计的量化统计
+     */
+    static SpineQuantizeStats GetStats();
+
+private:
+    size_t stride_ = 0;
+    std::vector<float> offsets_;
+    std::vector<float> steps_;
+    std::vector<uint16_t> codes_;
+};
+
+// 暂时注释掉 Spine 4.2 接入
+/*
+// 单个曲线时间轴：关键帧、贝塞尔采样点（和变形顶点）量化保存。
+// 原时间轴对象保留在动画中（AnimationState 按类型识别旋转等时间轴），帧数组只保留采样时间两侧的两帧
+struct SpineQuantizedTimelineEntry {
+    spine::CurveTimeline* timeline = nullptr;
+    size_t frameEntries = 0;
+    size_t frameCount = 0;
+    size_t valueCount = 0;                // 每帧的值通道数（贝塞尔段数）
+    SpineQuantizedFrames frames;          // 每行：时间 + 各通道值
+    std::vector<uint32_t> curveTypes;     // 每帧的曲线类型，贝塞尔时为采样点起始行 + 2
+    SpineQuantizedFrames bezier;          // 每行一个采样点：时间、值
+    SpineQuantizedFrames deform;          // 变形顶点，每帧 deformSize 个值
+    size_t deformSize = 0;
+    size_t windowFirst = SIZE_MAX;        // 当前窗口的首帧和末帧
+    size_t windowLast = SIZE_MAX;
+};
+
+// 一个动画的量化时间轴
+class SpineQuantizedAnimation {
+public:
+    // 量化动画的所有曲线时间轴（加载后、首次应用前调用），误差超限的时间轴保留浮点
+    // 只有时间的时间轴（附件、绘制顺序、事件）和含整数通道的 IK 时间轴不处理
+    void Build(spine::Animation* animation, const SpineQuantizeTolerance& tolerance);
+
+    // 解码覆盖 [minTime, maxTime] 的关键帧窗口（AnimationState::apply 之前调用）
+    // 同一动画在多条轨道或混合中以不同时间出现时传入最早和最晚的时间
+    void Seek(float minTime, float maxTime);
+
+    bool IsEmpty() const { return entries_.empty(); }
+
+    // 量化数据占用的字节数（不在运行时的分配器统计内）
+    size_t GetMemoryBytes() const { return memoryBytes_; }
+
+private:
+    static void FillWindow(SpineQuantizedTimelineEntry& entry, size_t firstRow, size_t lastRow);
+
+    std::vector<SpineQuantizedTimelineEntry> entries_;
+    size_t memoryBytes_ = 0;
+};
+*/
+
+#endif //SPINEHM_SPINEQUANTIZEDTIMELINE_H
@@ -0,0 +1,228 @@
+//
+// Created on 2026/10/19.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+/**
+ * SpineRegionIndex.cpp - 图集区域名称哈希索引实现
+ */
+
+#include "SpineRegionIndex.h"
+#include "common/SpineMemoryTracker.h"
+#include <cstring>
+
+namespace {
+// 行首尾的空白（与运行时的 .atlas 解析相同）
+bool IsAtlasSpace(char c) {
+    return c == ' ' || c == '\t' || c == '\r';
+}
+}
+
+std::shared_ptr<const SpineRegionIndex> SpineRegionIndex::Build(const std::vector<const char*>& names) {
+    std::shared_ptr<SpineRegionIndex> index(new SpineRegionIndex());
+    index->regionCount_ = names.size();
+
+    size_t capacity = 16;
+    while (capacity < names.size() * 2) {
+        capacity <<= 1;
+    }
+    index->slots_.assign(capacity, Slot{0, 0, 0, -1});
+
+    size_t poolSize = 0;
+    for (const char* name : names) {
+        poolSize += std::strlen(name);
+    }
+    index->names_.reserve(poolSize);
+
+    const size_t mask = capacity - 1;
+    for (size_t i = 0; i < names.size(); ++i) {
+        const size_t length = std::strlen(names[i]);
+        const uint32_t hash = Hash(names[i], length);
+        size_t slot = hash & mask;
+        bool duplicate = false;
+        while (index->slots_[slot].regionIndex >= 0) {
+            const Slot& existing = index->slots_[slot];
+            if (existing.hash == hash && existing.nameLength == length &&
+                std::memcmp(index->names_.data() + existing.nameOffset, names[i], length) == 0) {
+                duplicate = true;
+                break;
+            }
+            slot = (slot + 1) & mask;
+        }
+        if (duplicate) {
+            continue;
+        }
+
+        Slot& entry = index->slots_[slot];
+        entry.hash = hash;
+        entry.nameOffset = static_cast<uint32_t>(index->names_.size());
+        entry.nameLength = static_cast<uint32_t>(length);
+        entry.regionIndex = static_cast<int32_t>(i);
+        index->names_.insert(index->names_.end(), names[i], names[i] + length);
+    }
+
+    index->reportedBytes_ = index->GetMemoryBytes();
+    SpineMemoryTracker::getInstance().Add(SpineMemoryCategory::kAtlas, index->reportedBytes_);
+    return index;
+}
+
+void SpineRegionIndex::ParseAtlasRegionNames(const char* text, size_t size, std::vector<string>* names) {
+    names->clear();
+    bool inPage = false;
+    const char* end = text + size;
+    const char* lineStart = text;
+    while (lineStart < end) {
+        const char* lineEnd = static_cast<const char*>(std::memchr(lineStart, '\n', end - lineStart));
+        if (!lineEnd) {
+            lineEnd = end;
+        }
+        const char* begin = lineStart;
+        const char* last = lineEnd;
+        while (begin < last && IsAtlasSpace(*begin)) {
+            ++begin;
+        }
+        while (last > begin && IsAtlasSpace(last[-1])) {
+            --last;
+        }
+        lineStart = lineEnd + 1;
+
+        if (begin == last) {
+            // 空行结束当前页面
+            inPage = false;
+            continue;
+        }
+        if (!inPage) {
+            // 页面名称行
+            inPage = true;
+            continue;
+        }
+        // 不含冒号的行是区域名称，其余为页面或区域的属性
+        if (!std::memchr(begin, ':', last - begin)) {
+            names->emplace_back(begin, last - begin);
+        }
+    }
+}
+
+SpineRegionIndex::~SpineRegionIndex() {
+    SpineMemoryTracker::getInstance().Sub(SpineMemoryCategory::kAtlas, reportedBytes_);
+}
+
+int32_t SpineRegionIndex::Find(const char* name, size_t length) const {
+    const uint32_t hash = Hash(name, length);
+    const size_t mask = slots_.size() - 1;
+    for (size_t slot = hash & mask;; slot = (slot + 1) & mask) {
+        const Slot& entry = slots_[slot];
+        if (entry.regionIndex < 0) {
+            return -1;
+        }
+        if (entry.hash == hash && entry.nameLength == length &&
+            std::memcmp(names_.data() + entry.nameOffset, name, length) == 0) {
+            return entry.regionIndex;
+        }
+    }
+}
+
+size_t SpineRegionIndex::GetMemoryBytes() const {
+    return sizeof(*this) + slots_.capacity() * sizeof(Slot) + names_.capacity();
+}
+
+uint32_t SpineRegionIndex::Hash(const char* name, size_t length) {
+    // FNV-1a
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < length; ++i) {
+        hash ^= static_cast<uint8_t>(name[i]);
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+// 暂时注释掉 Spine 4.2 接入
+/*
+// ==================== SpineIndexedAttachmentLoader ====================
+
+spine::AtlasRegion* SpineIndexedAttachmentLoader::FindRegion(const spine::String& name) {
+    if (!index_) {
+        return atlas_->findRegion(name);
+    }
+    spine::Vector<spine::AtlasRegion*>& regions = atlas_->getRegions();
+    int32_t regionIndex = index_->Find(name.buffer(), name.length());
+    if (regionIndex >= 0 && static_cast<size_t>(regionIndex) < regions.size() && regions[regionIndex]->name == name) {
+        return regions[regionIndex];
+    }
+    if (regionIndex < 0 && regions.size() == index_->GetRegionCount()) {
+        return nullptr;
+    }
+    return atlas_->findRegion(name);
+}
+
+bool SpineIndexedAttachmentLoader::LoadSequence(const spine::String& basePath, spine::Sequence* sequence) {
+    spine::Vector<spine::TextureRegion*>& regions = sequence->getRegions();
+    for (size_t i = 0; i < regions.size(); ++i) {
+        spine::String path = sequence->getPath(basePath, static_cast<int>(i));
+        regions[i] = FindRegion(path);
+        if (!regions[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+spine::RegionAttachment* SpineIndexedAttachmentLoader::newRegionAttachment(spine::Skin& skin, const spine::String& name,
+                                                                          const spine::String& path,
+                                                                          spine::Sequence* sequence) {
+    auto* attachment = new (__FILE__, __LINE__) spine::RegionAttachment(name);
+    if (sequence) {
+        if (!LoadSequence(path, sequence)) {
+            delete attachment;
+            return nullptr;
+        }
+    } else {
+        spine::AtlasRegion* region = FindRegion(path);
+        if (!region) {
+            delete attachment;
+            return nullptr;
+        }
+        attachment->setRegion(region);
+    }
+    return attachment;
+}
+
+spine::MeshAttachment* SpineIndexedAttachmentLoader::newMeshAttachment(spine::Skin& skin, const spine::String& name,
+                                                                      const spine::String& path,
+                                                                      spine::Sequence* sequence) {
+    auto* attachment = new (__FILE__, __LINE__) spine::MeshAttachment(name);
+    if (sequence) {
+        if (!LoadSequence(path, sequence)) {
+            delete attachment;
+            return nullptr;
+        }
+    } else {
+        spine::AtlasRegion* region = FindRegion(path);
+        if (!region) {
+            delete attachment;
+            return nullptr;
+        }
+        attachment->setRegion(region);
+    }
+    return attachment;
+}
+
+spine::BoundingBoxAttachment* SpineIndexedAttachmentLoader::newBoundingBoxAttachment(spine::Skin& skin,
+                                                                                    const spine::String& name) {
+    return new (__FILE__, __LINE__) spine::BoundingBoxAttachment(name);
+}
+
+spine::PathAttachment* SpineIndexedAttachmentLoader::newPathAttachment(spine::Skin& skin, const spine::String& name) {
+    return new (__FILE__, __LINE__) spine::PathAttachment(name);
+}
+
+spine::PointAttachment* SpineIndexedAttachmentLoader::newPointAttachment(spine::Skin& skin, const spine::String& name) {
+    return new (__FILE__, __LINE__) spine::PointAttachment(name);
+}
+
+spine::ClippingAttachment* SpineIndexedAttachmentLoader::newClippingAttachment(spine::Skin& skin,
+                                                                              const spine::String& name) {
+    return new (__FILE__, __LINE__) spine::ClippingAttachment(name);
+}
+*/
@@ -0,0 +1,107 @@
+//
+// Created on 2026/10/19.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#ifndef SPINEHM_SPINEREGIONINDEX_H
+#define SPINEHM_SPINEREGIONINDEX_H
+/**
+ * SpineRegionIndex - 图集区域名称的哈希索引
+ * Atlas::findRegion 按名称逐个比较全部区域，加载时每个附件查找一次，大图集上整体为 O(附件数 × 区域数)。
+ * 索引把区域名映射到区域在图集中的下标（与 .atlas 中的出现顺序相同），开放寻址、线性探测，
+ * 每个图集只构建一次，通过资源缓存在实例间共享；各实例用下标取自己 Atlas 中的区域。
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+using std::string;
+
+class SpineRegionIndex {
+public:
+    /**
+     * 由区域名称构建索引
+     * @param names 按图集顺序排列的区域名称，重名时保留第一个（与 findRegion 相同）
+     * @return 索引
+     */
+    static std::shared_ptr<const SpineRegionIndex> Build(const std::vector<const char*>& names);
+
+    /**
+     * 从 .atlas 文本中按顺序取出区域名称（兼容 Spine 3.x 与 4.x 格式，与运行时解析顺序一致）
+     * @param text 文本起始地址
+     * @param size 文本字节数
+     * @param names 输出区域名称
+     */
+    static void ParseAtlasRegionNames(const char* text, size_t size, std::vector<string>* names);
+
+    ~SpineRegionIndex();
+
+    SpineRegionIndex(const SpineRegionIndex&) = delete;
+    SpineRegionIndex& operator=(const SpineRegionIndex&) = delete;
+
+    /**
+     * 查找区域
+     * @param name 区域名称
+     * @param length 名称字节数
+     * @return 区域下标，不存在时返回 -1
+     */
+    int32_t Find(const char* name, size_t length) const;
+
+    int32_t Find(const string& name) const { return Find(name.data(), name.size()); }
+
+    size_t GetRegionCount() const { return regionCount_; }
+
+    size_t GetMemoryBytes() const;
+
+private:
+    // 槽位：名称哈希、名称在字符串池中的偏移和长度、区域下标（-1 为空槽）
+    struct Slot {
+        uint32_t hash;
+        uint32_t nameOffset;
+        uint32_t nameLength;
+        int32_t regionIndex;
+    };
+
+    SpineRegionIndex() = default;
+
+    static uint32_t Hash(const char* name, size_t length);
+
+    std::vector<Slot> slots_;  // 容量为 2 的幂，装载率不超过 1/2
+    std::vector<char> names_;  // 字符串池
+    size_t regionCount_ = 0;
+    size_t reportedBytes_ = 0;
+};
+
+// 暂时注释掉 Spine 4.2 接入
+/*
+// 通过区域索引解析附件区域的加载器（其余行为与 spine::AtlasAttachmentLoader 相同）。
+// 索引与图集的区域顺序不一致时（名称核对失败）退回 Atlas::findRegion
+class SpineIndexedAttachmentLoader : public spine::AttachmentLoader {
+public:
+    SpineIndexedAttachmentLoader(spine::Atlas* atlas, const SpineRegionIndex* index) : atlas_(atlas), index_(index) {}
+
+    spine::RegionAttachment* newRegionAttachment(spine::Skin& skin, const spine::String& name,
+                                                 const spine::String& path, spine::Sequence* sequence) override;
+    spine::MeshAttachment* newMeshAttachment(spine::Skin& skin, const spine::String& name,
+                                             const spine::String& path, spine::Sequence* sequence) override;
+    spine::BoundingBoxAttachment* newBoundingBoxAttachment(spine::Skin& skin, const spine::String& name) override;
+    spine::PathAttachment* newPathAttachment(spine::Skin& skin, const spine::String& name) override;
+    spine::PointAttachment* newPointAttachment(spine::Skin& skin, const spine::String& name) override;
+    spine::ClippingAttachment* newClippingAttachment(spine::Skin& skin, const spine::String& name) override;
+    void configureAttachment(spine::Attachment* attachment) override {}
+
+    spine::AtlasRegion* FindRegion(const spine::String& name);
+
+private:
+    bool LoadSequence(const spine::String& basePath, spine::Sequence* sequence);
+
+    spine::Atlas* atlas_;
+    const SpineRegionIndex* index_;
+};
+*/
+
+#endif //SPINEHM_SPINEREGIONINDEX_H
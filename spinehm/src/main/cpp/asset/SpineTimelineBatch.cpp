@@ -0,0 +1,497 @@
+//
+// Created on 2026/10/19.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+/**
+ * SpineTimelineBatch.cpp - 骨骼时间轴批量采样实现
+ * 本文件以 -ffp-contract=off 编译（见 CMakeLists.txt），整行插值的标量与向量实现逐位一致，
+ * 线性段的结果也与运行时的 value + percent * (next - value) 相同。
+ */
+
+#include "SpineTimelineBatch.h"
+#include "render/SpineVertexKernels.h"
+#include <algorithm>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define SPINE_KERNELS_SSE2 1
+#endif
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#define SPINE_KERNELS_AVX2 1
+#endif
+
+#if defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define SPINE_KERNELS_NEON 1
+#endif
+
+namespace {
+
+// 运行时的曲线类型和贝塞尔段长度（与 spine::CurveTimeline 一致）
+constexpr int kCurveLinear = 0;
+constexpr int kCurveStepped = 1;
+constexpr int kCurveBezier = 2;
+constexpr size_t kBezierSize = 18;
+
+// 缓存的帧向后线性推进的最大步数，超出后（跳转播放）在剩余帧中二分查找
+constexpr size_t kMaxForwardSteps = 4;
+
+/**
+ * 按 CurveTimeline::getBezierValue 的规则选择折线段（knots 为起点、9 个采样点、终点）：
+ * 第 0 段在 knots[1] > time 时选中，其余段在终点 >= time 时选中，都不满足时为最后一段
+ * @param start 起始比较的段（不晚于应选中的段）
+ */
+size_t FindSegment(const float* knots, size_t start, float time) {
+    constexpr size_t kLastSegment = SpineCurveLut::kKnots - 2;
+    size_t segment = start;
+    if (segment == 0) {
+        if (knots[1] > time) {
+            return 0;
+        }
+        segment = 1;
+    }
+    while (segment < kLastSegment && !(knots[segment + 1] >= time)) {
+        ++segment;
+    }
+    return segment;
+}
+
+/**
+ * 应选中的段是否不早于 segment（segment 大于 0）
+ */
+inline bool SegmentBefore(const float* knots, size_t segment, float time) {
+    return segment == 1 ? !(knots[1] > time) : !(knots[segment] >= time);
+}
+
+#if SPINE_KERNELS_SSE2
+
+void LerpRowSse2(const float* before, const float* after, float percent, size_t count, float* out) {
+    const __m128 p = _mm_set1_ps(percent);
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128 a = _mm_loadu_ps(before + i);
+        __m128 b = _mm_loadu_ps(after + i);
+        _mm_storeu_ps(out + i, _mm_add_ps(a, _mm_mul_ps(_mm_sub_ps(b, a), p)));
+    }
+    SpineTimelineGroup::LerpRowScalar(before + i, after + i, percent, count - i, out + i);
+}
+
+#endif // SPINE_KERNELS_SSE2
+
+#if SPINE_KERNELS_AVX2
+
+__attribute__((target("avx2")))
+void LerpRowAvx2(const float* before, const float* after, float percent, size_t count, float* out) {
+    const __m256 p = _mm256_set1_ps(percent);
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256 a = _mm256_loadu_ps(before + i);
+        __m256 b = _mm256_loadu_ps(after + i);
+        _mm256_storeu_ps(out + i, _mm256_add_ps(a, _mm256_mul_ps(_mm256_sub_ps(b, a), p)));
+    }
+    SpineTimelineGroup::LerpRowScalar(before + i, after + i, percent, count - i, out + i);
+}
+
+#endif // SPINE_KERNELS_AVX2
+
+#if SPINE_KERNELS_NEON
+
+void LerpRowNeon(const float* before, const float* after, float percent, size_t count, float* out) {
+    const float32x4_t p = vdupq_n_f32(percent);
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        float32x4_t a = vld1q_f32(before + i);
+        float32x4_t b = vld1q_f32(after + i);
+        // 分开的乘、加（不用 vmlaq/vfmaq），与标量舍入一致
+        vst1q_f32(out + i, vaddq_f32(a, vmulq_f32(vsubq_f32(b, a), p)));
+    }
+    SpineTimelineGroup::LerpRowScalar(before + i, after + i, percent, count - i, out + i);
+}
+
+#endif // SPINE_KERNELS_NEON
+
+} // namespace
+
+// ==================== SpineCurveLut ====================
+
+void SpineCurveLut::Bake(float time0, float value0, const float* points, float time1, float value1) {
+    times[0] = time0;
+    values[0] = value0;
+    for (size_t i = 0; i < kBezierSize / 2; ++i) {
+        times[i + 1] = points[i * 2];
+        values[i + 1] = points[i * 2 + 1];
+    }
+    times[kKnots - 1] = time1;
+    values[kKnots - 1] = value1;
+
+    const float span = time1 - time0;
+    for (size_t bucket = 0; bucket < kBuckets; ++bucket) {
+        float time = time0 + span * (static_cast<float>(bucket) / static_cast<float>(kBuckets));
+        firstSegment[bucket] = static_cast<uint8_t>(FindSegment(times, 0, time));
+    }
+}
+
+float SpineCurveLut::Evaluate(float time, float percent) const {
+    float position = percent * static_cast<float>(kBuckets);
+    size_t bucket = position > 0.0f ? static_cast<size_t>(position) : 0;
+    size_t segment = firstSegment[bucket < kBuckets ? bucket : kBuckets - 1];
+    // 进度的舍入可能落到后一个桶，此时从头比较
+    if (segment > 0 && !SegmentBefore(times, segment, time)) {
+        segment = 0;
+    }
+    segment = FindSegment(times, segment, time);
+
+    float x = times[segment];
+    float y = values[segment];
+    return y + (time - x) / (times[segment + 1] - x) * (values[segment + 1] - y);
+}
+
+// ==================== SpineFrameCursor ====================
+
+size_t SpineFrameCursor::BinarySearch(const float* times, size_t frameCount, float time) {
+    const float* upper = std::upper_bound(times, times + frameCount, time);
+    return upper == times ? 0 : static_cast<size_t>(upper - times) - 1;
+}
+
+size_t SpineFrameCursor::Search(const float* times, size_t frameCount, float lastTime, float time) {
+    Slot* slot = nullptr;
+    for (Slot& candidate : slots_) {
+        if (candidate.used && candidate.time == lastTime && candidate.frame < frameCount) {
+            slot = &candidate;
+            break;
+        }
+    }
+
+    size_t frame;
+    if (slot && times[slot->frame] <= time) {
+        // 同一条目继续播放：从上次的帧向后推进
+        frame = slot->frame;
+        size_t steps = 0;
+        while (frame + 1 < frameCount && times[frame + 1] <= time) {
+            if (++steps > kMaxForwardSteps) {
+                frame += BinarySearch(times + frame, frameCount - frame, time);
+                break;
+            }
+            ++frame;
+        }
+    } else {
+        frame = BinarySearch(times, frameCount, time);
+    }
+
+    if (!slot) {
+        // 新条目：占用空闲或最久未用的槽位
+        slot = &slots_[0];
+        for (Slot& candidate : slots_) {
+            if (!candidate.used) {
+                slot = &candidate;
+                break;
+            }
+            if (candidate.lastUse < slot->lastUse) {
+                slot = &candidate;
+            }
+        }
+    }
+    slot->time = time;
+    slot->frame = frame;
+    slot->lastUse = ++useClock_;
+    slot->used = true;
+    return frame;
+}
+
+// ==================== SpineTimelineGroup ====================
+
+SpineTimelineGroup::SpineTimelineGroup(const float* frames, size_t frameEntries, size_t frameCount,
+                                       size_t channelCount)
+    : channelCount_(channelCount),
+      times_(frameCount),
+      values_(frameCount * channelCount, 0.0f),
+      curves_(frameCount * channelCount, kLinear) {
+    for (size_t frame = 0; frame < frameCount; ++frame) {
+        times_[frame] = frames[frame * frameEntries];
+    }
+}
+
+bool SpineTimelineGroup::HasSameTimes(const float* frames, size_t frameEntries, size_t frameCount) const {
+    if (frameCount != times_.size()) {
+        return false;
+    }
+    for (size_t frame = 0; frame < frameCount; ++frame) {
+        if (frames[frame * frameEntries] != times_[frame]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void SpineTimelineGroup::SetChannel(size_t channel, const float* frames, size_t frameEntries, size_t valueOffset,
+                                    const float* curves, size_t bezierOffset) {
+    const size_t frameCount = times_.size();
+    for (size_t frame = 0; frame < frameCount; ++frame) {
+        values_[frame * channelCount_ + channel] = frames[frame * frameEntries + valueOffset];
+    }
+
+    // 最后一帧之后没有曲线段（运行时为阶梯），采样时直接取该帧的值
+    for (size_t frame = 0; frame + 1 < frameCount; ++frame) {
+        uint32_t& curve = curves_[frame * channelCount_ + channel];
+        int type = static_cast<int>(curves[frame]);
+        if (type == kCurveLinear) {
+            curve = kLinear;
+        } else if (type == kCurveStepped) {
+            curve = kStepped;
+        } else {
+            SpineCurveLut lut;
+            lut.Bake(times_[frame], values_[frame * channelCount_ + channel],
+                     curves + (type - kCurveBezier) + bezierOffset, times_[frame + 1],
+                     values_[(frame + 1) * channelCount_ + channel]);
+            curve = static_cast<uint32_t>(luts_.size());
+            luts_.push_back(lut);
+        }
+    }
+    fixesDirty_ = true;
+}
+
+void SpineTimelineGroup::BuildFixes() {
+    const size_t frameCount = times_.size();
+    fixStart_.assign(frameCount + 1, 0);
+    fixes_.clear();
+    for (size_t frame = 0; frame < frameCount; ++frame) {
+        fixStart_[frame] = static_cast<uint32_t>(fixes_.size());
+        for (size_t channel = 0; channel < channelCount_; ++channel) {
+            uint32_t curve = curves_[frame * channelCount_ + channel];
+            if (curve != kLinear) {
+                fixes_.push_back({static_cast<uint32_t>(channel), curve});
+            }
+        }
+    }
+    fixStart_[frameCount] = static_cast<uint32_t>(fixes_.size());
+    fixes_.shrink_to_fit();
+    fixesDirty_ = false;
+}
+
+bool SpineTimelineGroup::Sample(float lastTime, float time, float* out) {
+    const size_t frameCount = times_.size();
+    if (frameCount == 0 || time < times_[0]) {
+        return false;
+    }
+    if (fixesDirty_) {
+        BuildFixes();
+    }
+
+    const size_t frame = cursor_.Search(times_.data(), frameCount, lastTime, time);
+    const float* row = values_.data() + frame * channelCount_;
+    if (frame + 1 >= frameCount) {
+        std::copy(row, row + channelCount_, out);
+        return true;
+    }
+
+    const float before = times_[frame];
+    const float percent = (time - before) / (times_[frame + 1] - before);
+    LerpRow(row, row + channelCount_, percent, channelCount_, out);
+
+    for (uint32_t i = fixStart_[frame]; i < fixStart_[frame + 1]; ++i) {
+        const CurveFix& fix = fixes_[i];
+        out[fix.channel] = fix.curve == kStepped ? row[fix.channel] : luts_[fix.curve].Evaluate(time, percent);
+    }
+    return true;
+}
+
+size_t SpineTimelineGroup::GetMemoryBytes() const {
+    return sizeof(*this) + times_.capacity() * sizeof(float) + values_.capacity() * sizeof(float) +
+           curves_.capacity() * sizeof(uint32_t) + fixStart_.capacity() * sizeof(uint32_t) +
+           fixes_.capacity() * sizeof(CurveFix) + luts_.capacity() * sizeof(SpineCurveLut);
+}
+
+void SpineTimelineGroup::LerpRowScalar(const float* before, const float* after, float percent, size_t count,
+                                       float* out) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = before[i] + (after[i] - before[i]) * percent;
+    }
+}
+
+void SpineTimelineGroup::LerpRow(const float* before, const float* after, float percent, size_t count, float* out) {
+    using SpineVertexKernels::SimdLevel;
+    switch (SpineVertexKernels::GetSimdLevel()) {
+#if SPINE_KERNELS_AVX2
+        case SimdLevel::kAvx2:
+            LerpRowAvx2(before, after, percent, count, out);
+            return;
+#endif
+#if SPINE_KERNELS_SSE2
+        case SimdLevel::kSse2:
+            LerpRowSse2(before, after, percent, count, out);
+            return;
+#endif
+#if SPINE_KERNELS_NEON
+        case SimdLevel::kNeon:
+            LerpRowNeon(before, after, percent, count, out);
+            return;
+#endif
+        default:
+            LerpRowScalar(before, after, percent, count, out);
+            return;
+    }
+}
+
+// 暂时注释掉 Spine 4.2 接入
+/*
+namespace {
+enum BoneTimelineKind {
+    kRotate = 0,
+    kTranslate,
+    kScale,
+};
+
+// 可合并的骨骼时间轴类型，其他时间轴返回 -1
+int BoneTimelineKindOf(spine::Timeline* timeline) {
+    const spine::RTTI& rtti = timeline->getRTTI();
+    if (rtti.isExactly(spine::RotateTimeline::rtti)) {
+        return kRotate;
+    }
+    if (rtti.isExactly(spine::TranslateTimeline::rtti)) {
+        return kTranslate;
+    }
+    if (rtti.isExactly(spine::ScaleTimeline::rtti)) {
+        return kScale;
+    }
+    return -1;
+}
+
+int BoneIndexOf(spine::Timeline* timeline, int kind) {
+    switch (kind) {
+        case kRotate:
+            return static_cast<spine::RotateTimeline*>(timeline)->getBoneIndex();
+        case kTranslate:
+            return static_cast<spine::TranslateTimeline*>(timeline)->getBoneIndex();
+        default:
+            return static_cast<spine::ScaleTimeline*>(timeline)->getBoneIndex();
+    }
+}
+}
+
+RTTI_IMPL(SpineBatchedBoneTimeline, spine::Timeline)
+
+size_t SpineBatchedBoneTimeline::Apply(spine::Animation* animation) {
+    spine::Vector<spine::Timeline*>& timelines = animation->getTimelines();
+
+    // 按关键帧时间分组，组内保持时间轴在动画中的顺序
+    std::vector<std::vector<Member>> memberGroups;
+    std::vector<SpineTimelineGroup> groups;
+    std::vector<size_t> channelCounts;
+    spine::Vector<spine::Timeline*> remaining;
+    for (size_t i = 0; i < timelines.size(); ++i) {
+        int kind = BoneTimelineKindOf(timelines[i]);
+        auto* timeline = static_cast<spine::CurveTimeline*>(timelines[i]);
+        if (kind < 0 || timeline->getFrameCount() < 2) {
+            remaining.add(timelines[i]);
+            continue;
+        }
+
+        const float* frames = timeline->getFrames().buffer();
+        size_t frameEntries = timeline->getFrameEntries();
+        size_t frameCount = timeline->getFrameCount();
+        size_t index = 0;
+        while (index < groups.size() && !groups[index].HasSameTimes(frames, frameEntries, frameCount)) {
+            ++index;
+        }
+        if (index == groups.size()) {
+            // 通道数在分组完成后才确定，这里只用于比较关键帧时间
+            groups.emplace_back(frames, frameEntries, frameCount, 0);
+            memberGroups.emplace_back();
+            channelCounts.push_back(0);
+        }
+        memberGroups[index].push_back({timeline, kind, BoneIndexOf(timeline, kind), channelCounts[index]});
+        channelCounts[index] += frameEntries - 1;
+    }
+    if (groups.empty()) {
+        return 0;
+    }
+
+    size_t bytes = 0;
+    for (size_t index = 0; index < groups.size(); ++index) {
+        spine::CurveTimeline* first = memberGroups[index][0].timeline;
+        SpineTimelineGroup group(first->getFrames().buffer(), first->getFrameEntries(), first->getFrameCount(),
+                                 channelCounts[index]);
+        for (const Member& member : memberGroups[index]) {
+            const size_t frameEntries = member.timeline->getFrameEntries();
+            for (size_t value = 1; value < frameEntries; ++value) {
+                group.SetChannel(member.channel + value - 1, member.timeline->getFrames().buffer(), frameEntries,
+                                 value, member.timeline->getCurves().buffer(), (value - 1) * kBezierSize);
+            }
+        }
+        auto* batched = new SpineBatchedBoneTimeline(std::move(memberGroups[index]), std::move(group));
+        bytes += batched->group_.GetMemoryBytes();
+        remaining.add(batched);
+    }
+
+    timelines.clear();
+    timelines.addAll(remaining);
+    return bytes;
+}
+
+SpineBatchedBoneTimeline::SpineBatchedBoneTimeline(std::vector<Member> members, SpineTimelineGroup group)
+    : spine::Timeline(group.GetFrameCount(), 1),
+      members_(std::move(members)),
+      group_(std::move(group)),
+      sampled_(group_.GetChannelCount()) {
+    // 属性 ID 为所有成员的并集，AnimationState 据此计算各轨道的混合方式
+    spine::Vector<spine::PropertyId> ids;
+    for (const Member& member : members_) {
+        ids.addAll(member.timeline->getPropertyIds());
+    }
+    setPropertyIds(ids.buffer(), ids.size());
+
+    // 帧数组只保存时间（Timeline::getDuration 取最后一帧的时间）
+    spine::CurveTimeline* first = members_[0].timeline;
+    const size_t frameEntries = first->getFrameEntries();
+    for (size_t frame = 0; frame < group_.GetFrameCount(); ++frame) {
+        _frames[frame] = first->getFrames()[frame * frameEntries];
+    }
+}
+
+SpineBatchedBoneTimeline::~SpineBatchedBoneTimeline() {
+    for (Member& member : members_) {
+        delete member.timeline;
+    }
+}
+
+void SpineBatchedBoneTimeline::apply(spine::Skeleton& skeleton, float lastTime, float time,
+                                     spine::Vector<spine::Event*>* events, float alpha, spine::MixBlend blend,
+                                     spine::MixDirection direction) {
+    // 部分应用（交叉淡入、叠加、混出）和首帧之前按原时间轴的规则计算
+    if (alpha != 1.0f || blend == spine::MixBlend_Add || direction == spine::MixDirection_Out ||
+        !group_.Sample(lastTime, time, sampled_.data())) {
+        for (Member& member : members_) {
+            member.timeline->apply(skeleton, lastTime, time, events, alpha, blend, direction);
+        }
+        return;
+    }
+
+    // 完全应用：旋转、平移为初始值加采样值，缩放为初始值乘采样值（与运行时 alpha 为 1 时相同）
+    spine::Vector<spine::Bone*>& bones = skeleton.getBones();
+    for (const Member& member : members_) {
+        spine::Bone* bone = bones[member.boneIndex];
+        if (!bone->isActive()) {
+            continue;
+        }
+        spine::BoneData& data = bone->getData();
+        const float* value = sampled_.data() + member.channel;
+        switch (member.kind) {
+            case kRotate:
+                bone->setRotation(data.getRotation() + value[0]);
+                break;
+            case kTranslate:
+                bone->setX(data.getX() + value[0]);
+                bone->setY(data.getY() + value[1]);
+                break;
+            default:
+                bone->setScaleX(value[0] * data.getScaleX());
+                bone->setScaleY(value[1] * data.getScaleY());
+                break;
+        }
+    }
+}
+*/
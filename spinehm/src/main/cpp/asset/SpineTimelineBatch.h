@@ -0,0 +1,203 @@
+//
+// Created on 2026/10/19.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#ifndef SPINEHM_SPINETIMELINEBATCH_H
+#define SPINEHM_SPINETIMELINEBATCH_H
+/**
+ * SpineTimelineBatch - 骨骼时间轴的批量采样
+ * 关键帧时间完全相同的旋转、平移、缩放时间轴合为一组，各帧的通道值按行连续存放：
+ * 一次查找帧下标、一次计算线性进度后，整行用 SIMD 插值，贝塞尔和阶梯段再逐个修正。
+ * - 帧查找：按轨道条目缓存上次的帧下标，顺序播放时向后线性推进，均摊 O(1)
+ * - 贝塞尔段：加载时烘焙成按时间均匀分桶的查找表，采样时由所在桶直接定位折线段，
+ *   不再从头比较运行时的 9 个采样点；求值公式与运行时相同，结果逐位一致
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * 贝塞尔段查找表
+ * 运行时把贝塞尔段存为起点、9 个采样点、终点组成的折线；表中按时间把段均匀分为 kBuckets 个桶，
+ * 记录每个桶起点所在的折线段，采样时从该折线段开始比较（通常 0~1 次）。
+ */
+struct SpineCurveLut {
+    static constexpr size_t kBuckets = 16;
+    static constexpr size_t kKnots = 11;
+
+    float times[kKnots];
+    float values[kKnots];
+    uint8_t firstSegment[kBuckets];
+
+    /**
+     * 烘焙一段曲线
+     * @param time0 段起点（当前帧）的时间
+     * @param value0 段起点的值
+     * @param points 运行时的贝塞尔采样点（时间、值交错，18 个浮点）
+     * @param time1 段终点（下一帧）的时间
+     * @param value1 段终点的值
+     */
+    void Bake(float time0, float value0, const float* points, float time1, float value1);
+
+    /**
+     * 求值（与 CurveTimeline::getBezierValue 结果相同）
+     * @param time 动画时间
+     * @param percent 段内进度 (time - time0) / (time1 - time0)，用于选桶
+     */
+    float Evaluate(float time, float percent) const;
+};
+
+/**
+ * 帧游标：按轨道条目缓存上次查找到的帧
+ * Timeline::apply 只传入上一次和本次的动画时间，上一次时间与某个槽位记录的时间相同时
+ * 即为同一条目继续播放，从该槽位的帧向后查找；循环回绕、倒放或新条目时二分查找。
+ * 槽位数覆盖同一动画同时出现在多条轨道或混合中的情况。
+ */
+class SpineFrameCursor {
+public:
+    static constexpr size_t kSlots = 4;
+
+    /**
+     * 查找最后一个时间不晚于 time 的帧
+     * @param times 关键帧时间（递增）
+     * @param frameCount 帧数（大于 0）
+     * @param lastTime 同一条目上一次应用时的动画时间
+     * @param time 本次的动画时间
+     * @return 帧下标，time 早于首帧时返回 0
+     */
+    size_t Search(const float* times, size_t frameCount, float lastTime, float time);
+
+    /**
+     * 二分查找（不使用缓存）
+     */
+    static size_t BinarySearch(const float* times, size_t frameCount, float time);
+
+private:
+    struct Slot {
+        float time = 0.0f;
+        size_t frame = 0;
+        uint32_t lastUse = 0;
+        bool used = false;
+    };
+
+    Slot slots_[kSlots];
+    uint32_t useClock_ = 0;
+};
+
+/**
+ * 关键帧时间相同的一组时间轴
+ * 采样会更新帧游标和临时缓冲，同一组不能并发采样（每个实例持有自己的骨骼数据）
+ */
+class SpineTimelineGroup {
+public:
+    /**
+     * @param frames 第一个时间轴的帧数组（Spine 的 CurveTimeline 布局：每帧时间 + 各通道值）
+     * @param frameEntries 每帧的值个数
+     * @param frameCount 帧数（大于 0）
+     * @param channelCount 组内的值通道总数
+     */
+    SpineTimelineGroup(const float* frames, size_t frameEntries, size_t frameCount, size_t channelCount);
+
+    /**
+     * 判断时间轴的关键帧时间是否与本组完全相同
+     */
+    bool HasSameTimes(const float* frames, size_t frameEntries, size_t frameCount) const;
+
+    /**
+     * 设置一个通道的关键帧和曲线（每个通道设置一次，关键帧时间须与本组相同）
+     * @param channel 通道下标
+     * @param frames 时间轴帧数组
+     * @param frameEntries 每帧的值个数
+     * @param valueOffset 通道在帧内的偏移（从 1 开始）
+     * @param curves 时间轴曲线数组（Spine 布局：前 frameCount 个为各帧曲线类型，贝塞尔为 2 + 采样点下标）
+     * @param bezierOffset 本通道的贝塞尔采样点相对曲线类型中下标的偏移（第 n 个值通道为 (n - 1) * 18）
+     */
+    void SetChannel(size_t channel, const float* frames, size_t frameEntries, size_t valueOffset, const float* curves,
+                    size_t bezierOffset);
+
+    /**
+     * 采样所有通道
+     * @param lastTime 同一条目上一次应用时的动画时间
+     * @param time 动画时间
+     * @param out 输出（channelCount 个值）
+     * @return time 早于首帧时返回 false，不写输出（调用方按运行时规则回到初始姿态）
+     */
+    bool Sample(float lastTime, float time, float* out);
+
+    size_t GetFrameCount() const { return times_.size(); }
+
+    size_t GetChannelCount() const { return channelCount_; }
+
+    size_t GetMemoryBytes() const;
+
+    /**
+     * 整行线性插值：out[i] = before[i] + (after[i] - before[i]) * percent
+     * 按当前指令集级别选择实现（与 SpineVertexKernels 共用级别），结果与标量逐位一致
+     */
+    static void LerpRow(const float* before, const float* after, float percent, size_t count, float* out);
+
+    static void LerpRowScalar(const float* before, const float* after, float percent, size_t count, float* out);
+
+private:
+    // 各段的曲线：线性、阶梯，其余为查找表下标
+    static constexpr uint32_t kLinear = UINT32_MAX;
+    static constexpr uint32_t kStepped = UINT32_MAX - 1;
+
+    // 阶梯或贝塞尔段（整行线性插值之后逐个修正）
+    struct CurveFix {
+        uint32_t channel;
+        uint32_t curve;
+    };
+
+    // 由各段的曲线生成按帧排列的修正列表
+    void BuildFixes();
+
+    size_t channelCount_;
+    std::vector<float> times_;
+    std::vector<float> values_;      // 每帧一行，每行 channelCount_ 个值
+    std::vector<uint32_t> curves_;   // 每帧一行，与 values_ 对应
+    std::vector<uint32_t> fixStart_; // 各帧的修正在 fixes_ 中的起始下标（frameCount + 1 个）
+    std::vector<CurveFix> fixes_;
+    std::vector<SpineCurveLut> luts_;
+    bool fixesDirty_ = true;
+    SpineFrameCursor cursor_;
+};
+
+// 暂时注释掉 Spine 4.2 接入
+/*
+// 替换动画中一组时间轴的合并时间轴。原时间轴从动画中移出，由本对象持有：
+// 完全应用（alpha 为 1、非叠加、混入方向）时批量采样后直接写骨骼，其他情况交给原时间轴。
+// AnimationState 按类型识别旋转时间轴做最短路径混合，合并后的旋转在交叉淡入时按线性混合
+// （与 TrackEntry::setShortestRotation(true) 相同）。
+class SpineBatchedBoneTimeline : public spine::Timeline {
+RTTI_DECL
+public:
+    // 按关键帧时间把动画中的旋转、平移、缩放时间轴分组并替换，返回新增数据的字节数
+    static size_t Apply(spine::Animation* animation);
+
+    ~SpineBatchedBoneTimeline() override;
+
+    void apply(spine::Skeleton& skeleton, float lastTime, float time, spine::Vector<spine::Event*>* events,
+               float alpha, spine::MixBlend blend, spine::MixDirection direction) override;
+
+private:
+    // 组内的一个原时间轴：对应的骨骼和在采样结果中的起始通道
+    struct Member {
+        spine::CurveTimeline* timeline;
+        int kind;
+        int boneIndex;
+        size_t channel;
+    };
+
+    SpineBatchedBoneTimeline(std::vector<Member> members, SpineTimelineGroup group);
+
+    std::vector<Member> members_;
+    SpineTimelineGroup group_;
+    std::vector<float> sampled_;
+};
+*/
+
+#endif //SPINEHM_SPINETIMELINEBATCH_H
@@ -0,0 +1,447 @@
+//
+// Created on 2026/10/19.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+/**
+ * SpineCommandLog.cpp - 实例命令流的录制与读取实现
+ */
+
+#include "SpineCommandLog.h"
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+namespace {
+
+uint64_t NowUs() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+void WriteVarint(std::vector<uint8_t>& out, uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<uint8_t>(value));
+}
+
+void WriteInt(std::vector<uint8_t>& out, int32_t value) {
+    // zigzag 编码，小的负数（如 -1）也只占 1 字节
+    uint32_t zigzag = (static_cast<uint32_t>(value) << 1) ^ static_cast<uint32_t>(value >> 31);
+    WriteVarint(out, zigzag);
+}
+
+void WriteFloat(std::vector<uint8_t>& out, float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    for (int i = 0; i < 4; ++i) {
+        out.push_back(static_cast<uint8_t>(bits >> (i * 8)));
+    }
+}
+
+void WriteString(std::vector<uint8_t>& out, const string& value) {
+    WriteVarint(out, value.size());
+    out.insert(out.end(), value.begin(), value.end());
+}
+
+} // namespace
+
+const char* GetSpineCommandOpName(SpineCommandOp op) {
+    switch (op) {
+        case SpineCommandOp::kCreate:
+            return "create";
+        case SpineCommandOp::kDestroy:
+            return "destroy";
+        case SpineCommandOp::kLoadSpineData:
+            return "loadSpineData";
+        case SpineCommandOp::kSetAnimation:
+            return "setAnimation";
+        case SpineCommandOp::kAddAnimation:
+            return "addAnimation";
+        case SpineCommandOp::kSetSkin:
+            return "setSkin";
+        case SpineCommandOp::kSetMix:
+            return "setMix";
+        case SpineCommandOp::kSetTimeScale:
+            return "setTimeScale";
+        case SpineCommandOp::kPause:
+            return "pause";
+        case SpineCommandOp::kResume:
+            return "resume";
+        case SpineCommandOp::kClearTracks:
+            return "clearTracks";
+        case SpineCommandOp::kClearTrack:
+            return "clearTrack";
+        case SpineCommandOp::kUpdateViewSize:
+            return "updateViewSize";
+        case SpineCommandOp::kUpdate:
+            return "update";
+        case SpineCommandOp::kRender:
+            return "render";
+        case SpineCommandOp::kLoadSpineBundle:
+            return "loadSpineBundle";
+        case SpineCommandOp::kSetScale:
+            return "setScale";
+        default:
+            return "unknown";
+    }
+}
+
+// ==================== 命令构造 ====================
+
+SpineCommand SpineCommand::Create(int32_t instanceId) {
+    return Simple(SpineCommandOp::kCreate, instanceId);
+}
+
+SpineCommand SpineCommand::Destroy(int32_t instanceId) {
+    return Simple(SpineCommandOp::kDestroy, instanceId);
+}
+
+SpineCommand SpineCommand::LoadSpineData(int32_t instanceId, const string& spineDataPath,
+                                         const string& atlasDataPath, const SpineLoadOptions& options) {
+    SpineCommand command = Simple(SpineCommandOp::kLoadSpineData, instanceId);
+    command.name = spineDataPath;
+    command.name2 = atlasDataPath;
+    command.value = options.scale;
+    command.loop = options.premultipliedAlpha;
+    return command;
+}
+
+SpineCommand SpineCommand::LoadSpineBundle(int32_t instanceId, const string& bundlePath,
+                                           const SpineLoadOptions& options) {
+    SpineCommand command = LoadSpineData(instanceId, bundlePath, "", options);
+    command.op = SpineCommandOp::kLoadSpineBundle;
+    return command;
+}
+
+SpineCommand SpineCommand::SetAnimation(int32_t instanceId, int32_t trackIndex, const string& animation, bool loop) {
+    SpineCommand command = Simple(SpineCommandOp::kSetAnimation, instanceId);
+    command.trackIndex = trackIndex;
+    command.name = animation;
+    command.loop = loop;
+    return command;
+}
+
+SpineCommand SpineCommand::AddAnimation(int32_t instanceId, int32_t trackIndex, const string& animation, bool loop,
+                                        float delay) {
+    SpineCommand command = SetAnimation(instanceId, trackIndex, animation, loop);
+    command.op = SpineCommandOp::kAddAnimation;
+    command.value = delay;
+    return command;
+}
+
+SpineCommand SpineCommand::SetSkin(int32_t instanceId, const string& skin) {
+    SpineCommand command = Simple(SpineCommandOp::kSetSkin, instanceId);
+    command.name = skin;
+    return command;
+}
+
+SpineCommand SpineCommand::SetMix(int32_t instanceId, const string& from, const string& to, float duration) {
+    SpineCommand command = Simple(SpineCommandOp::kSetMix, instanceId);
+    command.name = from;
+    command.name2 = to;
+    command.value = duration;
+    return command;
+}
+
+SpineCommand SpineCommand::SetTimeScale(int32_t instanceId, float timeScale) {
+    SpineCommand command = Simple(SpineCommandOp::kSetTimeScale, instanceId);
+    command.value = timeScale;
+    return command;
+}
+
+SpineCommand SpineCommand::SetScale(int32_t instanceId, float scale) {
+    SpineCommand command = Simple(SpineCommandOp::kSetScale, instanceId);
+    command.value = scale;
+    return command;
+}
+
+SpineCommand SpineCommand::Simple(SpineCommandOp op, int32_t instanceId) {
+    SpineCommand command;
+    command.op = op;
+    command.instanceId = instanceId;
+    return command;
+}
+
+SpineCommand SpineCommand::ClearTrack(int32_t instanceId, int32_t trackIndex) {
+    SpineCommand command = Simple(SpineCommandOp::kClearTrack, instanceId);
+    command.trackIndex = trackIndex;
+    return command;
+}
+
+SpineCommand SpineCommand::UpdateViewSize(int32_t instanceId, int32_t width, int32_t height) {
+    SpineCommand command = Simple(SpineCommandOp::kUpdateViewSize, instanceId);
+    command.trackIndex = width;
+    command.height = height;
+    return command;
+}
+
+SpineCommand SpineCommand::Update(int32_t instanceId, float deltaTime) {
+    SpineCommand command = Simple(SpineCommandOp::kUpdate, instanceId);
+    command.value = deltaTime;
+    return command;
+}
+
+// ==================== 录制 ====================
+
+SpineCommandRecorder& SpineCommandRecorder::getInstance() {
+    static SpineCommandRecorder instance;
+    return instance;
+}
+
+bool SpineCommandRecorder::Start(const string& path) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (file_) {
+        return false;
+    }
+
+    file_ = std::fopen(path.c_str(), "wb");
+    if (!file_) {
+        return false;
+    }
+
+    buffer_.clear();
+    for (int i = 0; i < 4; ++i) {
+        buffer_.push_back(static_cast<uint8_t>(SpineCommandLogFormat::kMagic[i]));
+    }
+    for (int i = 0; i < 4; ++i) {
+        buffer_.push_back(static_cast<uint8_t>(SpineCommandLogFormat::kVersion >> (i * 8)));
+    }
+    lastUs_ = NowUs();
+    commandCount_ = 0;
+    recording_.store(true, std::memory_order_relaxed);
+    return true;
+}
+
+uint64_t SpineCommandRecorder::Stop() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!file_) {
+        return 0;
+    }
+
+    recording_.store(false, std::memory_order_relaxed);
+    FlushLocked();
+    std::fclose(file_);
+    file_ = nullptr;
+    buffer_.shrink_to_fit();
+    return commandCount_;
+}
+
+void SpineCommandRecorder::Record(const SpineCommand& command) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!file_) {
+        return;
+    }
+
+    uint64_t now = NowUs();
+    buffer_.push_back(static_cast<uint8_t>(command.op));
+    WriteVarint(buffer_, now - lastUs_);
+    WriteInt(buffer_, command.instanceId);
+    lastUs_ = now;
+
+    switch (command.op) {
+        case SpineCommandOp::kLoadSpineData:
+        case SpineCommandOp::kLoadSpineBundle:
+            WriteString(buffer_, command.name);
+            WriteString(buffer_, command.name2);
+            WriteFloat(buffer_, command.value);
+            buffer_.push_back(command.loop ? 1 : 0);
+            break;
+        case SpineCommandOp::kSetAnimation:
+        case SpineCommandOp::kAddAnimation:
+            WriteInt(buffer_, command.trackIndex);
+            WriteString(buffer_, command.name);
+            buffer_.push_back(command.loop ? 1 : 0);
+            if (command.op == SpineCommandOp::kAddAnimation) {
+                WriteFloat(buffer_, command.value);
+            }
+            break;
+        case SpineCommandOp::kSetSkin:
+            WriteString(buffer_, command.name);
+            break;
+        case SpineCommandOp::kSetMix:
+            WriteString(buffer_, command.name);
+            WriteString(buffer_, command.name2);
+            WriteFloat(buffer_, command.value);
+            break;
+        case SpineCommandOp::kSetTimeScale:
+        case SpineCommandOp::kSetScale:
+        case SpineCommandOp::kUpdate:
+            WriteFloat(buffer_, command.value);
+            break;
+        case SpineCommandOp::kClearTrack:
+            WriteInt(buffer_, command.trackIndex);
+            break;
+        case SpineCommandOp::kUpdateViewSize:
+            WriteInt(buffer_, command.trackIndex);
+            WriteInt(buffer_, command.height);
+            break;
+        default:
+            break;
+    }
+    commandCount_++;
+
+    if (buffer_.size() >= kFlushThreshold) {
+        FlushLocked();
+    }
+}
+
+void SpineCommandRecorder::FlushLocked() {
+    if (!buffer_.empty()) {
+        std::fwrite(buffer_.data(), 1, buffer_.size(), file_);
+        buffer_.clear();
+    }
+}
+
+// ==================== 读取 ====================
+
+bool SpineCommandLogReader::Open(const string& path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        return false;
+    }
+    data_.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+
+    if (data_.size() < 8 || std::memcmp(data_.data(), SpineCommandLogFormat::kMagic, 4) != 0) {
+        return false;
+    }
+    uint32_t version = 0;
+    for (int i = 0; i < 4; ++i) {
+        version |= static_cast<uint32_t>(data_[4 + i]) << (i * 8);
+    }
+    if (version != SpineCommandLogFormat::kVersion) {
+        return false;
+    }
+
+    dataStart_ = 8;
+    Rewind();
+    return true;
+}
+
+void SpineCommandLogReader::Rewind() {
+    offset_ = dataStart_;
+    timeUs_ = 0;
+    truncated_ = false;
+}
+
+bool SpineCommandLogReader::Next(SpineCommand* command) {
+    if (offset_ >= data_.size()) {
+        return false;
+    }
+
+    *command = SpineCommand();
+    command->op = static_cast<SpineCommandOp>(data_[offset_++]);
+    uint64_t deltaUs = 0;
+    bool ok = ReadVarint(&deltaUs) && ReadInt(&command->instanceId);
+    timeUs_ += deltaUs;
+    command->timeUs = timeUs_;
+
+    switch (command->op) {
+        case SpineCommandOp::kCreate:
+        case SpineCommandOp::kDestroy:
+        case SpineCommandOp::kPause:
+        case SpineCommandOp::kResume:
+        case SpineCommandOp::kClearTracks:
+        case SpineCommandOp::kRender:
+            break;
+        case SpineCommandOp::kLoadSpineData:
+        case SpineCommandOp::kLoadSpineBundle:
+            ok = ok && ReadString(&command->name) && ReadString(&command->name2) && ReadFloat(&command->value) &&
+                 ReadBool(&command->loop);
+            break;
+        case SpineCommandOp::kSetAnimation:
+            ok = ok && ReadInt(&command->trackIndex) && ReadString(&command->name) && ReadBool(&command->loop);
+            break;
+        case SpineCommandOp::kAddAnimation:
+            ok = ok && ReadInt(&command->trackIndex) && ReadString(&command->name) && ReadBool(&command->loop) &&
+                 ReadFloat(&command->value);
+            break;
+        case SpineCommandOp::kSetSkin:
+            ok = ok && ReadString(&command->name);
+            break;
+        case SpineCommandOp::kSetMix:
+            ok = ok && ReadString(&command->name) && ReadString(&command->name2) && ReadFloat(&command->value);
+            break;
+        case SpineCommandOp::kSetTimeScale:
+        case SpineCommandOp::kSetScale:
+        case SpineCommandOp::kUpdate:
+            ok = ok && ReadFloat(&command->value);
+            break;
+        case SpineCommandOp::kClearTrack:
+            ok = ok && ReadInt(&command->trackIndex);
+            break;
+        case SpineCommandOp::kUpdateViewSize:
+            ok = ok && ReadInt(&command->trackIndex) && ReadInt(&command->height);
+            break;
+        default:
+            // 未知命令无法确定长度，后续数据不可用
+            ok = false;
+            break;
+    }
+
+    if (!ok) {
+        truncated_ = true;
+        offset_ = data_.size();
+    }
+    return ok;
+}
+
+bool SpineCommandLogReader::ReadVarint(uint64_t* value) {
+    uint64_t result = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        if (offset_ >= data_.size()) {
+            return false;
+        }
+        uint8_t byte = data_[offset_++];
+        result |= static_cast<uint64_t>(byte & 0x7f) << shift;
+        if ((byte & 0x80) == 0) {
+            *value = result;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool SpineCommandLogReader::ReadInt(int32_t* value) {
+    uint64_t zigzag;
+    if (!ReadVarint(&zigzag) || zigzag > UINT32_MAX) {
+        return false;
+    }
+    uint32_t bits = static_cast<uint32_t>(zigzag);
+    *value = static_cast<int32_t>((bits >> 1) ^ (0u - (bits & 1)));
+    return true;
+}
+
+bool SpineCommandLogReader::ReadFloat(float* value) {
+    if (data_.size() - offset_ < 4) {
+        return false;
+    }
+    uint32_t bits = 0;
+    for (int i = 0; i < 4; ++i) {
+        bits |= static_cast<uint32_t>(data_[offset_++]) << (i * 8);
+    }
+    std::memcpy(value, &bits, sizeof(bits));
+    return true;
+}
+
+bool SpineCommandLogReader::ReadBool(bool* value) {
+    if (offset_ >= data_.size()) {
+        return false;
+    }
+    *value = data_[offset_++] != 0;
+    return true;
+}
+
+bool SpineCommandLogReader::ReadString(string* value) {
+    uint64_t length;
+    if (!ReadVarint(&length) || length > data_.size() - offset_) {
+        return false;
+    }
+    value->assign(reinterpret_cast<const char*>(data_.data() + offset_), static_cast<size_t>(length));
+    offset_ += static_cast<size_t>(length);
+    return true;
+}
@@ -0,0 +1,177 @@
+//
+// Created on 2026/10/19.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#ifndef SPINEHM_SPINECOMMANDLOG_H
+#define SPINEHM_SPINECOMMANDLOG_H
+/**
+ * SpineCommandLog - 实例命令流的录制与读取
+ * NAPI 层把每次调用写入紧凑的二进制日志，离线工具 tools/spine_command_replay
+ * 在 Linux 上按原顺序重放到 SpineManager 并统计耗时，线上问题可复现为固定基准。
+ *
+ * 文件布局：
+ *   "SPCL" | version(u32) | 记录...
+ * 每条记录：opcode(u8) | 距上一条的微秒数(varint) | instanceId(zigzag varint) | 参数
+ * 参数中整数为 zigzag varint，浮点为 4 字节小端，布尔为 1 字节，字符串为长度(varint) + UTF-8
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "common.h"
+
+using std::string;
+
+namespace SpineCommandLogFormat {
+
+constexpr char kMagic[4] = {'S', 'P', 'C', 'L'};
+constexpr uint32_t kVersion = 1;
+
+} // namespace SpineCommandLogFormat
+
+/**
+ * 命令类型（写入日志，只能追加）
+ */
+enum class SpineCommandOp : uint8_t {
+    kCreate = 1,
+    kDestroy,
+    kLoadSpineData,
+    kSetAnimation,
+    kAddAnimation,
+    kSetSkin,
+    kSetMix,
+    kSetTimeScale,
+    kPause,
+    kResume,
+    kClearTracks,
+    kClearTrack,
+    kUpdateViewSize,
+    kUpdate,
+    kRender,
+    kLoadSpineBundle,
+    kSetScale,
+};
+
+const char* GetSpineCommandOpName(SpineCommandOp op);
+
+/**
+ * 一条命令，未用到的字段保持默认值
+ */
+struct SpineCommand {
+    SpineCommandOp op = SpineCommandOp::kUpdate;
+    uint64_t timeUs = 0;         // 距录制开始的微秒数（读取时填写）
+    int32_t instanceId = -1;
+    int32_t trackIndex = 0;      // 轨道索引；UpdateViewSize 时为宽度
+    int32_t height = 0;          // UpdateViewSize 的高度
+    bool loop = false;           // 循环；LoadSpineData 时为 premultipliedAlpha
+    float value = 0.0f;          // Update 的 deltaTime、AddAnimation 的 delay、SetMix 的 duration、
+                                 // SetTimeScale 的倍率、LoadSpineData 和 SetScale 的 scale
+    string name;                 // 动画/皮肤名称、SetMix 的 from、LoadSpineData 的骨骼路径、LoadSpineBundle 的包路径
+    string name2;                // SetMix 的 to、LoadSpineData 的图集路径
+
+    static SpineCommand Create(int32_t instanceId);
+    static SpineCommand Destroy(int32_t instanceId);
+    static SpineCommand LoadSpineData(int32_t instanceId, const string& spineDataPath, const string& atlasDataPath,
+                                      const SpineLoadOptions& options);
+    static SpineCommand LoadSpineBundle(int32_t instanceId, const string& bundlePath, const SpineLoadOptions& options);
+    static SpineCommand SetAnimation(int32_t instanceId, int32_t trackIndex, const string& animation, bool loop);
+    static SpineCommand AddAnimation(int32_t instanceId, int32_t trackIndex, const string& animation, bool loop,
+                                     float delay);
+    static SpineCommand SetSkin(int32_t instanceId, const string& skin);
+    static SpineCommand SetMix(int32_t instanceId, const string& from, const string& to, float duration);
+    static SpineCommand SetTimeScale(int32_t instanceId, float timeScale);
+    static SpineCommand SetScale(int32_t instanceId, float scale);
+    static SpineCommand Simple(SpineCommandOp op, int32_t instanceId);
+    static SpineCommand ClearTrack(int32_t instanceId, int32_t trackIndex);
+    static SpineCommand UpdateViewSize(int32_t instanceId, int32_t width, int32_t height);
+    static SpineCommand Update(int32_t instanceId, float deltaTime);
+};
+
+/**
+ * 命令录制器（全局，所有实例写入同一个日志）
+ * 未录制时每次调用只有一次原子读取
+ */
+class SpineCommandRecorder {
+public:
+    static SpineCommandRecorder& getInstance();
+
+    /**
+     * 开始录制
+     * @param path 日志文件路径
+     * @return 是否成功，已在录制时返回 false
+     */
+    bool Start(const string& path);
+
+    /**
+     * 停止录制并写出剩余数据
+     * @return 记录的命令数
+     */
+    uint64_t Stop();
+
+    bool IsRecording() const { return recording_.load(std::memory_order_relaxed); }
+
+    void Record(const SpineCommand& command);
+
+private:
+    SpineCommandRecorder() = default;
+
+    // 缓冲超过该大小时写入文件
+    static constexpr size_t kFlushThreshold = 64 * 1024;
+
+    void FlushLocked();
+
+    std::atomic<bool> recording_{false};
+    std::mutex mutex_;
+    FILE* file_ = nullptr;
+    std::vector<uint8_t> buffer_;
+    uint64_t lastUs_ = 0;
+    uint64_t commandCount_ = 0;
+};
+
+/**
+ * 命令日志读取器
+ */
+class SpineCommandLogReader {
+public:
+    /**
+     * 读取整个日志文件
+     * @param path 日志文件路径
+     * @return 是否成功（文件头不匹配时返回 false）
+     */
+    bool Open(const string& path);
+
+    /**
+     * 读取下一条命令
+     * @param command 输出
+     * @return 是否读到，结束或数据截断时返回 false
+     */
+    bool Next(SpineCommand* command);
+
+    /**
+     * 回到第一条命令
+     */
+    void Rewind();
+
+    bool IsTruncated() const { return truncated_; }
+
+private:
+    bool ReadVarint(uint64_t* value);
+    bool ReadInt(int32_t* value);
+    bool ReadFloat(float* value);
+    bool ReadBool(bool* value);
+    bool ReadString(string* value);
+
+    std::vector<uint8_t> data_;
+    size_t dataStart_ = 0;
+    size_t offset_ = 0;
+    uint64_t timeUs_ = 0;
+    bool truncated_ = false;
+};
+
+#endif //SPINEHM_SPINECOMMANDLOG_H
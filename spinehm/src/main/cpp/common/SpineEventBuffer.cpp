@@ -0,0 +1,83 @@
+//
+// Created on 2026/10/19.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+/**
+ * SpineEventBuffer.cpp - 每帧合并的事件缓冲实现
+ */
+
+#include "SpineEventBuffer.h"
+
+void SpineEventBuffer::SetEnabled(bool enabled) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    enabled_ = enabled;
+    records_.clear();
+    dropped_ = 0;
+    // 新的接收方没有字符串表，从头下发
+    deliveredStrings_ = 0;
+}
+
+bool SpineEventBuffer::IsEnabled() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return enabled_;
+}
+
+SpineEventAppendResult SpineEventBuffer::Append(int32_t instanceId, SpineEventType type, int32_t trackIndex,
+                                                const char* animation, const SpineEventDataView* eventView) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!enabled_) {
+        return SpineEventAppendResult::kDisabled;
+    }
+    if (records_.size() >= kMaxPendingRecords) {
+        dropped_++;
+        return SpineEventAppendResult::kDropped;
+    }
+
+    SpineEventRecord record;
+    record.instanceId = instanceId;
+    record.type = static_cast<int32_t>(type);
+    record.trackIndex = trackIndex;
+    record.animationId = InternLocked(animation);
+    record.eventId = -1;
+    record.intValue = 0;
+    record.floatValue = 0.0f;
+    record.stringValueId = -1;
+    if (eventView) {
+        record.eventId = InternLocked(eventView->name);
+        record.intValue = eventView->intValue;
+        record.floatValue = eventView->floatValue;
+        record.stringValueId = InternLocked(eventView->stringValue);
+    }
+    records_.push_back(record);
+    return SpineEventAppendResult::kAppended;
+}
+
+size_t SpineEventBuffer::Drain(SpineEventBatch* batch) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    batch->records.swap(records_);
+    records_.clear();
+    batch->newStrings.assign(strings_.begin() + static_cast<std::ptrdiff_t>(deliveredStrings_), strings_.end());
+    deliveredStrings_ = strings_.size();
+    batch->dropped = dropped_;
+    dropped_ = 0;
+    return batch->records.size();
+}
+
+int32_t SpineEventBuffer::InternLocked(const char* value) {
+    if (!value || value[0] == '\0') {
+        return -1;
+    }
+
+    auto it = stringIds_.find(std::string_view(value));
+    if (it != stringIds_.end()) {
+        return it->second;
+    }
+
+    // 名称来自骨骼数据，数量有限，驻留后不释放
+    int32_t id = static_cast<int32_t>(strings_.size());
+    strings_.emplace_back(value);
+    stringIds_.emplace(std::string_view(strings_.back()), id);
+    return id;
+}
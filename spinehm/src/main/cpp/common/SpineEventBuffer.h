@@ -0,0 +1,108 @@
+//
+// Created on 2026/10/19.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#ifndef SPINEHM_SPINEEVENTBUFFER_H
+#define SPINEHM_SPINEEVENTBUFFER_H
+/**
+ * SpineEventBuffer - 每帧合并的事件缓冲
+ * 同一 napi_env 下所有实例的事件编码为定长记录写入同一个缓冲，动画名和事件名驻留为整数 ID，
+ * 由该环境的 flushEvents 一次性交给 ArkTS，避免每个事件创建对象和字符串。
+ * 每个环境一个缓冲（由 SpineInstanceRegistry 持有），驻留 ID 只在本环境的 ArkTS 侧有意义
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include "common.h"
+
+using std::string;
+
+/**
+ * 单条事件记录（8 个 32 位字段，floatValue 按位存放）
+ * 字符串 ID 为 -1 表示无
+ */
+struct SpineEventRecord {
+    int32_t instanceId;
+    int32_t type;           // SpineEventType
+    int32_t trackIndex;
+    int32_t animationId;
+    int32_t eventId;        // 用户事件名称
+    int32_t intValue;
+    float floatValue;
+    int32_t stringValueId;
+};
+static_assert(sizeof(SpineEventRecord) == 8 * sizeof(int32_t), "SpineEventRecord must stay packed");
+
+/**
+ * 一次取出的事件批次
+ */
+struct SpineEventBatch {
+    std::vector<SpineEventRecord> records;
+    std::vector<string> newStrings;  // 上次取出后新驻留的字符串，ID 依次递增
+    uint64_t dropped = 0;            // 缓冲写满后丢弃的事件数
+};
+
+/**
+ * 追加事件的结果
+ */
+enum class SpineEventAppendResult : uint8_t {
+    kDisabled = 0,  // 未开启合并投递，由调用方逐个回调
+    kAppended,      // 已写入缓冲
+    kDropped,       // 缓冲已满，计入批次的丢弃数
+};
+
+class SpineEventBuffer {
+public:
+    SpineEventBuffer() = default;
+
+    /**
+     * 开启或关闭合并投递
+     * 开启时清空缓冲，并在下一批中重新下发全部已驻留的字符串
+     */
+    void SetEnabled(bool enabled);
+
+    bool IsEnabled() const;
+
+    /**
+     * 追加一条事件
+     * @param instanceId 实例ID
+     * @param type 事件类型
+     * @param trackIndex 轨道索引
+     * @param animation 动画名称（可为 nullptr）
+     * @param eventView 用户事件数据（非用户事件为 nullptr）
+     * @return 追加结果；开启时即使缓冲已满也不应再逐个回调
+     */
+    SpineEventAppendResult Append(int32_t instanceId, SpineEventType type, int32_t trackIndex,
+                                  const char* animation, const SpineEventDataView* eventView);
+
+    /**
+     * 取出当前缓冲中的全部事件
+     * @param batch 输出批次
+     * @return 事件数
+     */
+    size_t Drain(SpineEventBatch* batch);
+
+private:
+    // 未及时取出时最多缓存的事件数
+    static constexpr size_t kMaxPendingRecords = 1 << 14;
+
+    int32_t InternLocked(const char* value);
+
+    mutable std::mutex mutex_;
+    bool enabled_ = false;
+    std::vector<SpineEventRecord> records_;
+    std::deque<string> strings_;                           // 驻留字符串，deque 保证地址稳定
+    std::unordered_map<std::string_view, int32_t> stringIds_;
+    size_t deliveredStrings_ = 0;
+    uint64_t dropped_ = 0;
+};
+
+#endif //SPINEHM_SPINEEVENTBUFFER_H
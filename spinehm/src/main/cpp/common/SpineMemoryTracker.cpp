@@ -0,0 +1,114 @@
+//
+// Created on 2026/10/19.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+/**
+ * SpineMemoryTracker.cpp - 内存统计与预算实现
+ */
+
+#include "SpineMemoryTracker.h"
+#include <algorithm>
+
+SpineMemoryTracker& SpineMemoryTracker::getInstance() {
+    static SpineMemoryTracker instance;
+    return instance;
+}
+
+const char* SpineMemoryTracker::GetCategoryName(SpineMemoryCategory category) {
+    switch (category) {
+        case SpineMemoryCategory::kSkeletonData:
+            return "skeletonData";
+        case SpineMemoryCategory::kAtlas:
+            return "atlas";
+        case SpineMemoryCategory::kTexture:
+            return "texture";
+        case SpineMemoryCategory::kPose:
+            return "pose";
+        case SpineMemoryCategory::kRenderBuffer:
+            return "renderBuffer";
+        case SpineMemoryCategory::kBitmapCache:
+            return "bitmapCache";
+        default:
+            return "unknown";
+    }
+}
+
+void SpineMemoryTracker::Add(SpineMemoryCategory category, size_t bytes) {
+    if (bytes != 0) {
+        bytes_[static_cast<size_t>(category)].fetch_add(bytes, std::memory_order_relaxed);
+    }
+}
+
+void SpineMemoryTracker::Sub(SpineMemoryCategory category, size_t bytes) {
+    if (bytes != 0) {
+        bytes_[static_cast<size_t>(category)].fetch_sub(bytes, std::memory_order_relaxed);
+    }
+}
+
+void SpineMemoryTracker::Update(const SpineMemoryUsage& from, const SpineMemoryUsage& to) {
+    for (size_t i = 0; i < kSpineMemoryCategoryCount; ++i) {
+        if (to.bytes[i] > from.bytes[i]) {
+            bytes_[i].fetch_add(to.bytes[i] - from.bytes[i], std::memory_order_relaxed);
+        } else if (to.bytes[i] < from.bytes[i]) {
+            bytes_[i].fetch_sub(from.bytes[i] - to.bytes[i], std::memory_order_relaxed);
+        }
+    }
+}
+
+SpineMemoryUsage SpineMemoryTracker::GetUsage() const {
+    SpineMemoryUsage usage;
+    for (size_t i = 0; i < kSpineMemoryCategoryCount; ++i) {
+        usage.bytes[i] = bytes_[i].load(std::memory_order_relaxed);
+    }
+    return usage;
+}
+
+size_t SpineMemoryTracker::GetTotal() const {
+    return GetUsage().Total();
+}
+
+void SpineMemoryTracker::SetBudget(size_t budgetBytes) {
+    budgetBytes_.store(budgetBytes, std::memory_order_relaxed);
+    EnforceBudget();
+}
+
+void SpineMemoryTracker::RegisterEvictor(int32_t priority, Evictor evictor) {
+    std::lock_guard<std::mutex> lock(evictorMutex_);
+
+    auto it = std::upper_bound(evictors_.begin(), evictors_.end(), priority,
+                               [](int32_t value, const EvictorEntry& entry) { return value < entry.priority; });
+    evictors_.insert(it, EvictorEntry{priority, std::move(evictor)});
+}
+
+size_t SpineMemoryTracker::EnforceBudget() {
+    const size_t budget = budgetBytes_.load(std::memory_order_relaxed);
+    if (budget == 0 || GetTotal() <= budget) {
+        return 0;
+    }
+
+    // 同一时间只有一个线程执行淘汰，其他线程不等待
+    if (enforcing_.exchange(true, std::memory_order_acquire)) {
+        return 0;
+    }
+
+    std::vector<EvictorEntry> evictors;
+    {
+        std::lock_guard<std::mutex> lock(evictorMutex_);
+        evictors = evictors_;
+    }
+
+    size_t freed = 0;
+    for (const EvictorEntry& entry : evictors) {
+        size_t total = GetTotal();
+        if (total <= budget) {
+            break;
+        }
+        freed += entry.evictor(total - budget);
+    }
+
+    evictedBytes_.fetch_add(freed, std::memory_order_relaxed);
+    enforcing_.store(false, std::memory_order_release);
+    return freed;
+}
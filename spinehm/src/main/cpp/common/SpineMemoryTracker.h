@@ -0,0 +1,122 @@
+//
+// Created on 2026/10/19.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#ifndef SPINEHM_SPINEMEMORYTRACKER_H
+#define SPINEHM_SPINEMEMORYTRACKER_H
+/**
+ * SpineMemoryTracker - 内存统计与预算
+ * 各模块在分配和释放时按类别上报字节数；总量超过预算时按优先级淘汰可重建的缓存
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+/**
+ * 内存类别
+ */
+enum class SpineMemoryCategory : int32_t {
+    kSkeletonData = 0,  // 骨骼数据与实例的骨骼、动画状态
+    kAtlas,             // 图集容器的映射内存
+    kTexture,           // 解压后的页面像素
+    kPose,              // 骨骼变换快照、打包的蒙皮顶点、姿态共享组缓冲
+    kRenderBuffer,      // 世界顶点与绘制范围缓冲
+    kBitmapCache,       // 静态帧位图缓存
+    kCount
+};
+
+constexpr size_t kSpineMemoryCategoryCount = static_cast<size_t>(SpineMemoryCategory::kCount);
+
+/**
+ * 各类别的字节数
+ */
+struct SpineMemoryUsage {
+    size_t bytes[kSpineMemoryCategoryCount] = {};
+
+    size_t& operator[](SpineMemoryCategory category) { return bytes[static_cast<size_t>(category)]; }
+    size_t operator[](SpineMemoryCategory category) const { return bytes[static_cast<size_t>(category)]; }
+
+    size_t Total() const {
+        size_t total = 0;
+        for (size_t value : bytes) {
+            total += value;
+        }
+        return total;
+    }
+};
+
+class SpineMemoryTracker {
+public:
+    static SpineMemoryTracker& getInstance();
+
+    static const char* GetCategoryName(SpineMemoryCategory category);
+
+    void Add(SpineMemoryCategory category, size_t bytes);
+    void Sub(SpineMemoryCategory category, size_t bytes);
+
+    /**
+     * 按两次上报之间的差值更新（用于按容量统计的缓冲）
+     * @param from 上次上报的用量
+     * @param to 当前用量
+     */
+    void Update(const SpineMemoryUsage& from, const SpineMemoryUsage& to);
+
+    SpineMemoryUsage GetUsage() const;
+    size_t GetTotal() const;
+
+    /**
+     * 设置全局预算，超出时立即淘汰缓存
+     * @param budgetBytes 预算字节数，0 表示不限制
+     */
+    void SetBudget(size_t budgetBytes);
+    size_t GetBudget() const { return budgetBytes_.load(std::memory_order_relaxed); }
+
+    /**
+     * 淘汰函数：尽量释放指定字节数，返回实际释放的字节数
+     * 调用时不能持有淘汰函数内部会获取的锁
+     */
+    using Evictor = std::function<size_t(size_t bytesToFree)>;
+
+    /**
+     * 注册淘汰函数
+     * @param priority 优先级，数值小的先淘汰
+     * @param evictor 淘汰函数
+     */
+    void RegisterEvictor(int32_t priority, Evictor evictor);
+
+    /**
+     * 总量超过预算时依次调用淘汰函数，直到回到预算以内或没有可淘汰的缓存
+     * 未超预算时只有几次原子读取，可在每帧调用
+     * @return 释放的字节数
+     */
+    size_t EnforceBudget();
+
+    /**
+     * 累计因预算淘汰的字节数
+     */
+    uint64_t GetEvictedBytes() const { return evictedBytes_.load(std::memory_order_relaxed); }
+
+private:
+    SpineMemoryTracker() = default;
+
+    struct EvictorEntry {
+        int32_t priority;
+        Evictor evictor;
+    };
+
+    std::atomic<size_t> bytes_[kSpineMemoryCategoryCount] = {};
+    std::atomic<size_t> budgetBytes_{0};
+    std::atomic<uint64_t> evictedBytes_{0};
+    std::atomic<bool> enforcing_{false};
+
+    std::vector<EvictorEntry> evictors_;
+    std::mutex evictorMutex_;
+};
+
+#endif //SPINEHM_SPINEMEMORYTRACKER_H
@@ -0,0 +1,123 @@
+//
+// Created on 2026/10/19.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+/**
+ * SpineTrace.cpp - 帧阶段追踪实现
+ */
+
+#include "SpineTrace.h"
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <unistd.h>
+#include <sys/syscall.h>
+
+SpineTrace& SpineTrace::getInstance() {
+    static SpineTrace instance;
+    return instance;
+}
+
+uint64_t SpineTrace::NowNs() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+uint32_t SpineTrace::CurrentThreadId() {
+    static thread_local uint32_t threadId = static_cast<uint32_t>(syscall(SYS_gettid));
+    return threadId;
+}
+
+bool SpineTrace::Start() {
+    if (busy_.exchange(true, std::memory_order_acquire)) {
+        return false;
+    }
+    if (enabled_.load(std::memory_order_relaxed)) {
+        busy_.store(false, std::memory_order_release);
+        return false;
+    }
+
+    if (!slots_) {
+        slots_.reset(new Slot[kCapacity]);
+    }
+    for (size_t i = 0; i < kCapacity; ++i) {
+        slots_[i].sequence.store(0, std::memory_order_relaxed);
+    }
+    writeIndex_.store(0, std::memory_order_relaxed);
+    enabled_.store(true, std::memory_order_release);
+
+    busy_.store(false, std::memory_order_release);
+    return true;
+}
+
+void SpineTrace::Record(const char* name, int32_t instanceId, uint64_t startNs, uint64_t endNs) {
+    // Stop 之后仍在进行中的作用域会到达这里，直接丢弃
+    if (!enabled_.load(std::memory_order_acquire)) {
+        return;
+    }
+
+    uint64_t index = writeIndex_.fetch_add(1, std::memory_order_relaxed);
+    Slot& slot = slots_[index & (kCapacity - 1)];
+    slot.sequence.store(0, std::memory_order_relaxed);
+    slot.name.store(name, std::memory_order_relaxed);
+    slot.instanceId.store(instanceId, std::memory_order_relaxed);
+    slot.threadId.store(CurrentThreadId(), std::memory_order_relaxed);
+    slot.startNs.store(startNs, std::memory_order_relaxed);
+    slot.durationNs.store(endNs > startNs ? endNs - startNs : 0, std::memory_order_relaxed);
+    slot.sequence.store(index + 1, std::memory_order_release);
+}
+
+bool SpineTrace::Stop(const string& path) {
+    if (busy_.exchange(true, std::memory_order_acquire)) {
+        return false;
+    }
+    if (!enabled_.exchange(false, std::memory_order_acq_rel)) {
+        busy_.store(false, std::memory_order_release);
+        return false;
+    }
+
+    FILE* file = fopen(path.c_str(), "w");
+    if (!file) {
+        busy_.store(false, std::memory_order_release);
+        return false;
+    }
+
+    const uint64_t end = writeIndex_.load(std::memory_order_acquire);
+    const uint64_t begin = end > kCapacity ? end - kCapacity : 0;
+    const int pid = static_cast<int>(getpid());
+
+    fputs("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[", file);
+    bool first = true;
+    for (uint64_t i = begin; i < end; ++i) {
+        Slot& slot = slots_[i & (kCapacity - 1)];
+        // 序号不符表示该槽尚未写完或已被覆盖
+        if (slot.sequence.load(std::memory_order_acquire) != i + 1) {
+            continue;
+        }
+        const char* name = slot.name.load(std::memory_order_relaxed);
+        int32_t instanceId = slot.instanceId.load(std::memory_order_relaxed);
+        uint32_t threadId = slot.threadId.load(std::memory_order_relaxed);
+        uint64_t startNs = slot.startNs.load(std::memory_order_relaxed);
+        uint64_t durationNs = slot.durationNs.load(std::memory_order_relaxed);
+        if (slot.sequence.load(std::memory_order_acquire) != i + 1 || !name) {
+            continue;
+        }
+
+        // 时间单位为微秒，保留纳秒精度
+        fprintf(file,
+                "%s\n{\"name\":\"%s\",\"cat\":\"spine\",\"ph\":\"X\",\"ts\":%" PRIu64 ".%03u,\"dur\":%" PRIu64
+                ".%03u,\"pid\":%d,\"tid\":%u,\"args\":{\"instance\":%d}}",
+                first ? "" : ",", name, startNs / 1000, static_cast<unsigned>(startNs % 1000), durationNs / 1000,
+                static_cast<unsigned>(durationNs % 1000), pid, threadId, instanceId);
+        first = false;
+    }
+    fputs("\n]}\n", file);
+
+    bool success = fflush(file) == 0;
+    success = fclose(file) == 0 && success;
+    busy_.store(false, std::memory_order_release);
+    return success;
+}
@@ -0,0 +1,112 @@
+//
+// Created on 2026/10/19.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#ifndef SPINEHM_SPINETRACE_H
+#define SPINEHM_SPINETRACE_H
+/**
+ * SpineTrace - 帧阶段追踪
+ * 作用域标记写入无锁环形缓冲，停止时导出 Chrome trace 事件 JSON（可用 Perfetto 打开）
+ * 未开启时每个标记只有一次原子读取
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+using std::string;
+
+class SpineTrace {
+public:
+    static SpineTrace& getInstance();
+
+    /**
+     * 开始记录（清空之前的记录）
+     * @return 是否成功，已在记录时返回 false
+     */
+    bool Start();
+
+    /**
+     * 停止记录并写出 Chrome trace 事件 JSON
+     * 缓冲写满后保留最近的事件
+     * @param path 输出文件路径
+     * @return 是否成功
+     */
+    bool Stop(const string& path);
+
+    bool IsEnabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+    /**
+     * 记录一个完整事件
+     * @param name 阶段名称（必须是静态字符串）
+     * @param instanceId 实例ID，-1 表示与实例无关
+     * @param startNs 开始时间（纳秒）
+     * @param endNs 结束时间（纳秒）
+     */
+    void Record(const char* name, int32_t instanceId, uint64_t startNs, uint64_t endNs);
+
+    static uint64_t NowNs();
+    static uint32_t CurrentThreadId();
+
+private:
+    SpineTrace() = default;
+
+    // 环形缓冲容量（事件数，2 的幂）
+    static constexpr size_t kCapacity = 1 << 16;
+
+    /**
+     * 事件槽，sequence 为写入序号 + 1，读取时据此判断槽内容是否完整
+     */
+    struct Slot {
+        std::atomic<uint64_t> sequence{0};
+        std::atomic<const char*> name{nullptr};
+        std::atomic<int32_t> instanceId{-1};
+        std::atomic<uint32_t> threadId{0};
+        std::atomic<uint64_t> startNs{0};
+        std::atomic<uint64_t> durationNs{0};
+    };
+
+    std::atomic<bool> enabled_{false};
+    std::atomic<uint64_t> writeIndex_{0};
+    std::atomic<bool> busy_{false};  // Start/Stop 互斥
+    std::unique_ptr<Slot[]> slots_;  // 首次 Start 时分配，之后不释放
+};
+
+/**
+ * 作用域追踪标记
+ */
+class SpineTraceScope {
+public:
+    SpineTraceScope(const char* name, int32_t instanceId)
+        : name_(name), instanceId_(instanceId), startNs_(0), active_(SpineTrace::getInstance().IsEnabled()) {
+        if (active_) {
+            startNs_ = SpineTrace::NowNs();
+        }
+    }
+
+    ~SpineTraceScope() {
+        if (active_) {
+            SpineTrace::getInstance().Record(name_, instanceId_, startNs_, SpineTrace::NowNs());
+        }
+    }
+
+    SpineTraceScope(const SpineTraceScope&) = delete;
+    SpineTraceScope& operator=(const SpineTraceScope&) = delete;
+
+private:
+    const char* name_;
+    int32_t instanceId_;
+    uint64_t startNs_;
+    bool active_;
+};
+
+#define SPINE_TRACE_CONCAT_INNER(a, b) a##b
+#define SPINE_TRACE_CONCAT(a, b) SPINE_TRACE_CONCAT_INNER(a, b)
+#define SPINE_TRACE_SCOPE(name, instanceId) \
+    SpineTraceScope SPINE_TRACE_CONCAT(spineTraceScope_, __LINE__)(name, instanceId)
+
+#endif //SPINEHM_SPINETRACE_H
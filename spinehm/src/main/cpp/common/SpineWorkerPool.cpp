@@ -0,0 +1,147 @@
+//
+// Created on 2026/10/19.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+/**
+ * SpineWorkerPool.cpp - 共享工作线程池实现
+ */
+
+#include "SpineWorkerPool.h"
+#include <algorithm>
+
+namespace {
+// 动画计算只占用部分核心，给 UI 与渲染线程留出余量
+constexpr size_t kMaxWorkers = 4;
+}
+
+SpineWorkerPool& SpineWorkerPool::getInstance() {
+    static SpineWorkerPool instance;
+    return instance;
+}
+
+SpineWorkerPool::~SpineWorkerPool() {
+    {
+        std::lock_guard<std::mutex> lock(queueMutex_);
+        stopping_ = true;
+    }
+    queueCondition_.notify_all();
+    for (std::thread& worker : workers_) {
+        worker.join();
+    }
+}
+
+size_t SpineWorkerPool::GetWorkerCount() {
+    std::lock_guard<std::mutex> lock(queueMutex_);
+    StartLocked();
+    return workers_.size();
+}
+
+void SpineWorkerPool::ParallelFor(size_t count, size_t grain, const std::function<void(size_t, size_t)>& body) {
+    if (count == 0) {
+        return;
+    }
+    grain = std::max<size_t>(grain, 1);
+
+    auto batch = std::make_shared<Batch>();
+    batch->body = &body;
+    batch->count = count;
+    batch->grain = grain;
+    batch->chunkCount = (count + grain - 1) / grain;
+
+    // 只有一块时不必唤醒工作线程
+    size_t helpers = 0;
+    if (batch->chunkCount > 1) {
+        std::lock_guard<std::mutex> lock(queueMutex_);
+        StartLocked();
+        helpers = std::min(workers_.size(), batch->chunkCount - 1);
+        for (size_t i = 0; i < helpers; ++i) {
+            queue_.push_back(batch);
+        }
+    }
+    if (helpers == 1) {
+        queueCondition_.notify_one();
+    } else if (helpers > 1) {
+        queueCondition_.notify_all();
+    }
+
+    // 调用线程同样参与，避免工作线程繁忙时空等
+    RunChunks(*batch);
+
+    std::unique_lock<std::mutex> lock(batch->doneMutex);
+    batch->doneCondition.wait(lock, [&batch]() {
+        return batch->doneChunks.load(std::memory_order_acquire) == batch->chunkCount;
+    });
+}
+
+void SpineWorkerPool::Post(std::function<void()> task) {
+    auto batch = std::make_shared<Batch>();
+    batch->ownedBody = [task = std::move(task)](size_t, size_t) { task(); };
+    batch->body = &batch->ownedBody;
+    batch->count = 1;
+    batch->chunkCount = 1;
+
+    {
+        std::lock_guard<std::mutex> lock(queueMutex_);
+        StartLocked();
+        if (!workers_.empty()) {
+            queue_.push_back(batch);
+            batch.reset();
+        }
+    }
+    if (batch) {
+        RunChunks(*batch);
+        return;
+    }
+    queueCondition_.notify_one();
+}
+
+void SpineWorkerPool::StartLocked() {
+    if (started_) {
+        return;
+    }
+    started_ = true;
+
+    size_t hardware = std::thread::hardware_concurrency();
+    size_t workerCount = hardware > 1 ? std::min(hardware - 1, kMaxWorkers) : 0;
+    for (size_t i = 0; i < workerCount; ++i) {
+        workers_.emplace_back(&SpineWorkerPool::WorkerLoop, this);
+    }
+}
+
+void SpineWorkerPool::WorkerLoop() {
+    while (true) {
+        std::shared_ptr<Batch> batch;
+        {
+            std::unique_lock<std::mutex> lock(queueMutex_);
+            queueCondition_.wait(lock, [this]() { return stopping_ || !queue_.empty(); });
+            if (stopping_) {
+                return;
+            }
+            batch = std::move(queue_.front());
+            queue_.pop_front();
+        }
+        RunChunks(*batch);
+    }
+}
+
+void SpineWorkerPool::RunChunks(Batch& batch) {
+    size_t finished = 0;
+    while (true) {
+        size_t chunk = batch.nextChunk.fetch_add(1, std::memory_order_relaxed);
+        if (chunk >= batch.chunkCount) {
+            break;
+        }
+        size_t begin = chunk * batch.grain;
+        size_t end = std::min(begin + batch.grain, batch.count);
+        (*batch.body)(begin, end);
+        finished++;
+    }
+
+    if (finished > 0 &&
+        batch.doneChunks.fetch_add(finished, std::memory_order_acq_rel) + finished == batch.chunkCount) {
+        std::lock_guard<std::mutex> lock(batch.doneMutex);
+        batch.doneCondition.notify_all();
+    }
+}
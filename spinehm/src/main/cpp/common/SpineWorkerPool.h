@@ -0,0 +1,82 @@
+//
+// Created on 2026/10/19.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#ifndef SPINEHM_SPINEWORKERPOOL_H
+#define SPINEHM_SPINEWORKERPOOL_H
+/**
+ * SpineWorkerPool - 共享工作线程池
+ * 把一段下标范围切分为若干块，由工作线程与调用线程共同完成
+ */
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class SpineWorkerPool {
+public:
+    static SpineWorkerPool& getInstance();
+
+    /**
+     * 并行处理 [0, count)，阻塞到全部完成
+     * 每块的边界只由 count 与 grain 决定，与线程数和调度无关
+     * @param count 元素总数
+     * @param grain 每块元素数（至少为 1）
+     * @param body 处理 [begin, end) 的函数，不同块之间不能写同一位置
+     */
+    void ParallelFor(size_t count, size_t grain, const std::function<void(size_t, size_t)>& body);
+
+    /**
+     * 提交一个后台任务，不等待完成；没有工作线程时在调用线程上执行
+     * @param task 任务
+     */
+    void Post(std::function<void()> task);
+
+    /**
+     * 工作线程数（不含调用线程），首次使用时按 CPU 核数启动
+     */
+    size_t GetWorkerCount();
+
+private:
+    SpineWorkerPool() = default;
+    ~SpineWorkerPool();
+
+    SpineWorkerPool(const SpineWorkerPool&) = delete;
+    SpineWorkerPool& operator=(const SpineWorkerPool&) = delete;
+
+    /**
+     * 一次 ParallelFor 的共享状态，各线程抢占块下标
+     */
+    struct Batch {
+        const std::function<void(size_t, size_t)>* body = nullptr;
+        std::function<void(size_t, size_t)> ownedBody;  // Post 提交的任务，body 指向它
+        size_t count = 0;
+        size_t grain = 1;
+        size_t chunkCount = 0;
+        std::atomic<size_t> nextChunk{0};
+        std::atomic<size_t> doneChunks{0};
+        std::mutex doneMutex;
+        std::condition_variable doneCondition;
+    };
+
+    void StartLocked();
+    void WorkerLoop();
+    static void RunChunks(Batch& batch);
+
+    std::vector<std::thread> workers_;
+    std::deque<std::shared_ptr<Batch>> queue_;
+    bool started_ = false;
+    bool stopping_ = false;
+    std::mutex queueMutex_;
+    std::condition_variable queueCondition_;
+};
+
+#endif //SPINEHM_SPINEWORKERPOOL_H
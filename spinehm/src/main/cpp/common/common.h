@@ -7,6 +7,32 @@
 #ifndef SPINEHM_COMMON_H
 #define SPINEHM_COMMON_H
 #include <iostream>
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * 时间轴量化的允许误差（按时间轴类型）
+ */
+struct SpineQuantizeTolerance {
+    float time = 0.0005f;        // 关键帧时间（秒）
+    float rotate = 0.02f;        // 旋转（度）
+    float translate = 0.01f;     // 平移（骨骼坐标单位）
+    float scale = 0.0005f;       // 缩放
+    float shear = 0.02f;         // 斜切（度）
+    float color = 0.001f;        // 颜色分量（0~1）
+    float deform = 0.01f;        // 网格变形偏移
+    float constraint = 0.0005f;  // 约束的混合值等其他数值
+};
+
+/**
+ * 图集变体：同一图集按较低分辨率打包的版本（区域名称相同，区域坐标按 scale 缩放）
+ */
+struct SpineAtlasVariant {
+    std::string atlasPath;       // .atlas 或 .satlas 路径
+    float scale = 1.0f;          // 相对原图集的分辨率，如 0.5、0.25
+};
 
 /**
  * Spine 加载选项结构
@@ -15,6 +41,11 @@ struct SpineLoadOptions {
     float scale = 1.0f;
     bool premultipliedAlpha = true;
     bool debugMode = false;
+    bool quantizeTimelines = false;            // 关键帧以 16 位量化存储，采样时解码
+    SpineQuantizeTolerance quantizeTolerance;
+    bool batchTimelines = false;               // 关键帧时间相同的骨骼时间轴合并批量采样
+    bool lazyAnimations = false;               // 动画在首次使用时解码（仅 JSON 骨骼数据）
+    std::vector<SpineAtlasVariant> atlasVariants;  // 低分辨率图集变体，按显示缩放选择
 };
 
 /**
@@ -30,16 +61,135 @@ struct SpineEventData {
     float volume;
 };
 
+/**
+ * Spine 动画事件类型（与 spine::EventType 顺序一致）
+ */
+enum class SpineEventType : uint32_t {
+    kStart = 0,
+    kInterrupt,
+    kEnd,
+    kComplete,
+    kDispose,
+    kEvent,
+    kCount
+};
+
+/**
+ * 事件订阅掩码：第 n 位对应 SpineEventType 的第 n 个值
+ */
+constexpr uint32_t SpineEventTypeBit(SpineEventType type) { return 1u << static_cast<uint32_t>(type); }
+constexpr uint32_t kSpineEventMaskAll = (1u << static_cast<uint32_t>(SpineEventType::kCount)) - 1;
+
+inline const char* GetSpineEventTypeName(SpineEventType type) {
+    switch (type) {
+        case SpineEventType::kStart:
+            return "start";
+        case SpineEventType::kInterrupt:
+            return "interrupt";
+        case SpineEventType::kEnd:
+            return "end";
+        case SpineEventType::kComplete:
+            return "complete";
+        case SpineEventType::kDispose:
+            return "dispose";
+        default:
+            return "event";
+    }
+}
+
+/**
+ * 用户事件的原始数据（指向运行时内部的字符串，不复制）
+ */
+struct SpineEventDataView {
+    const char* name = nullptr;
+    int intValue = 0;
+    float floatValue = 0.0f;
+    const char* stringValue = nullptr;
+    float time = 0.0f;
+    float balance = 0.0f;
+    float volume = 1.0f;
+};
+
 /**
  * Spine 动画事件结构
  */
 struct SpineAnimationEvent {
-    std::string type;
+    SpineEventType type;
     int trackIndex;
     std::string animation;
     SpineEventData* eventData;
 };
 
+/**
+ * 事件投递统计
+ */
+struct SpineEventStats {
+    uint64_t delivered = 0;  // 已投递给回调的事件数
+    uint64_t filtered = 0;   // 被订阅掩码或名称过滤丢弃的事件数
+};
+
+/**
+ * Spine 矩形区域（视图坐标）
+ */
+struct SpineRect {
+    float left = 0.0f;
+    float top = 0.0f;
+    float right = 0.0f;
+    float bottom = 0.0f;
+
+    bool IsEmpty() const { return right <= left || bottom <= top; }
+
+    void Union(const SpineRect& other) {
+        if (other.IsEmpty()) {
+            return;
+        }
+        if (IsEmpty()) {
+            *this = other;
+            return;
+        }
+        left = std::min(left, other.left);
+        top = std::min(top, other.top);
+        right = std::max(right, other.right);
+        bottom = std::max(bottom, other.bottom);
+    }
+
+    bool Intersects(const SpineRect& other) const {
+        return !IsEmpty() && !other.IsEmpty() && left < other.right && other.left < right &&
+               top < other.bottom && other.top < bottom;
+    }
+};
+
+/**
+ * 包围盒附件（BoundingBoxAttachment）的多边形，坐标为视图坐标
+ */
+struct SpineHitShape {
+    std::string name;
+    SpineRect bounds;
+    std::vector<float> polygon;  // x、y 交错
+};
+
+/**
+ * 渲染批次中单个附件的顶点范围
+ */
+struct SpineDrawRange {
+    int32_t slotIndex = -1;
+    uint32_t vertexOffset = 0;   // 在世界顶点缓冲中的起始下标（浮点数）
+    uint32_t vertexCount = 0;    // 顶点数（每个顶点 x、y 两个浮点数）
+    uint64_t attachmentKey = 0;  // 附件与颜色的标识，变化即需要重绘
+};
+
+/**
+ * Spine 渲染统计
+ */
+struct SpineRenderStats {
+    uint64_t frameCount = 0;
+    uint64_t lastPixelsTouched = 0;    // 上一帧清除并重绘的像素数
+    uint64_t totalPixelsTouched = 0;
+    SpineRect lastDamage;              // 上一帧的损坏区域
+    uint64_t culledFrames = 0;         // 按包围盒表判断不可见、跳过姿态计算的帧数
+    uint64_t cachedFrames = 0;         // 姿态未变、从缓存位图贴回损坏区域的帧数
+};
+
 /**
  * 事件回调函数类型
  */
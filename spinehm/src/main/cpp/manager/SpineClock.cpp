@@ -0,0 +1,169 @@
+//
+// Created on 2026/10/19.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+/**
+ * SpineClock.cpp - 共享时钟实现
+ */
+
+#include "SpineClock.h"
+#include <algorithm>
+
+SpineClockRegistry& SpineClockRegistry::getInstance() {
+    static SpineClockRegistry instance;
+    return instance;
+}
+
+int32_t SpineClockRegistry::CreateClock(const void* owner, int32_t parentId) {
+    std::lock_guard<std::mutex> lock(clocksMutex_);
+    if (parentId != -1 && !FindClockLocked(owner, parentId)) {
+        return -1;
+    }
+
+    int32_t clockId = nextClockId_++;
+    Clock clock;
+    clock.owner = owner;
+    clock.parentId = parentId;
+    clocks_.emplace(clockId, clock);
+    return clockId;
+}
+
+bool SpineClockRegistry::DestroyClock(const void* owner, int32_t clockId) {
+    std::lock_guard<std::mutex> lock(clocksMutex_);
+    if (!FindClockLocked(owner, clockId)) {
+        return false;
+    }
+    EraseClockLocked(clockId);
+    return true;
+}
+
+void SpineClockRegistry::DestroyClocks(const void* owner) {
+    std::lock_guard<std::mutex> lock(clocksMutex_);
+    // 父时钟总在同一环境中，整个环境的时钟一起移除
+    std::vector<int32_t> clockIds;
+    for (const auto& entry : clocks_) {
+        if (entry.second.owner == owner) {
+            clockIds.push_back(entry.first);
+        }
+    }
+    for (int32_t clockId : clockIds) {
+        EraseClockLocked(clockId);
+    }
+}
+
+bool SpineClockRegistry::SetTimeScale(const void* owner, int32_t clockId, float timeScale) {
+    std::lock_guard<std::mutex> lock(clocksMutex_);
+    Clock* clock = FindClockLocked(owner, clockId);
+    if (!clock) {
+        return false;
+    }
+    clock->timeScale = std::max(0.0f, timeScale);
+    return true;
+}
+
+bool SpineClockRegistry::SetPaused(const void* owner, int32_t clockId, bool paused) {
+    std::lock_guard<std::mutex> lock(clocksMutex_);
+    Clock* clock = FindClockLocked(owner, clockId);
+    if (!clock) {
+        return false;
+    }
+    clock->paused = paused;
+    return true;
+}
+
+bool SpineClockRegistry::Attach(const void* owner, int32_t instanceId, int32_t clockId) {
+    std::lock_guard<std::mutex> lock(clocksMutex_);
+    if (clockId == -1) {
+        instanceClocks_.erase(instanceId);
+        return true;
+    }
+    if (!FindClockLocked(owner, clockId)) {
+        return false;
+    }
+    instanceClocks_[instanceId] = clockId;
+    return true;
+}
+
+void SpineClockRegistry::Detach(int32_t instanceId) {
+    std::lock_guard<std::mutex> lock(clocksMutex_);
+    instanceClocks_.erase(instanceId);
+}
+
+float SpineClockRegistry::GetEffectiveScale(int32_t instanceId) const {
+    std::lock_guard<std::mutex> lock(clocksMutex_);
+    auto it = instanceClocks_.find(instanceId);
+    if (it == instanceClocks_.end()) {
+        return 1.0f;
+    }
+    return EffectiveScaleLocked(it->second);
+}
+
+bool SpineClockRegistry::CollectInstances(const void* owner, int32_t clockId,
+                                          std::vector<std::pair<int32_t, float>>* out) const {
+    std::lock_guard<std::mutex> lock(clocksMutex_);
+    out->clear();
+    if (!FindClockLocked(owner, clockId)) {
+        return false;
+    }
+
+    for (const auto& entry : instanceClocks_) {
+        bool underClock = false;
+        float scale = EffectiveScaleLocked(entry.second, clockId, &underClock);
+        if (underClock) {
+            out->emplace_back(entry.first, scale);
+        }
+    }
+    std::sort(out->begin(), out->end());
+    return true;
+}
+
+float SpineClockRegistry::EffectiveScaleLocked(int32_t clockId, int32_t ancestorId, bool* underAncestor) const {
+    float scale = 1.0f;
+    // 父链只在创建时指定、销毁时上移，不会成环；层数上限只作保护
+    for (size_t depth = 0; clockId != -1 && depth < clocks_.size(); ++depth) {
+        auto it = clocks_.find(clockId);
+        if (it == clocks_.end()) {
+            break;
+        }
+        if (underAncestor && clockId == ancestorId) {
+            *underAncestor = true;
+        }
+        scale = it->second.paused ? 0.0f : scale * it->second.timeScale;
+        clockId = it->second.parentId;
+    }
+    return scale;
+}
+
+SpineClockRegistry::Clock* SpineClockRegistry::FindClockLocked(const void* owner, int32_t clockId) {
+    auto it = clocks_.find(clockId);
+    return it != clocks_.end() && it->second.owner == owner ? &it->second : nullptr;
+}
+
+const SpineClockRegistry::Clock* SpineClockRegistry::FindClockLocked(const void* owner, int32_t clockId) const {
+    auto it = clocks_.find(clockId);
+    return it != clocks_.end() && it->second.owner == owner ? &it->second : nullptr;
+}
+
+void SpineClockRegistry::EraseClockLocked(int32_t clockId) {
+    auto it = clocks_.find(clockId);
+    if (it == clocks_.end()) {
+        return;
+    }
+
+    int32_t parentId = it->second.parentId;
+    for (auto& entry : clocks_) {
+        if (entry.second.parentId == clockId) {
+            entry.second.parentId = parentId;
+        }
+    }
+    for (auto instance = instanceClocks_.begin(); instance != instanceClocks_.end();) {
+        if (instance->second == clockId) {
+            instance = instanceClocks_.erase(instance);
+        } else {
+            ++instance;
+        }
+    }
+    clocks_.erase(it);
+}
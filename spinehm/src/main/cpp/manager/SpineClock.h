@@ -0,0 +1,131 @@
+//
+// Created on 2026/10/19.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#ifndef SPINEHM_SPINECLOCK_H
+#define SPINEHM_SPINECLOCK_H
+/**
+ * SpineClock - 共享时钟
+ * 实例挂到时钟上后，帧间隔按时钟链（自身及所有父时钟）的时间缩放相乘，任一层暂停则停止。
+ * 时钟可嵌套（如全局游戏时钟下挂 UI 时钟），对一组实例暂停或慢放只需一次调用。
+ * 时钟属于创建它的环境（napi_env），只能由该环境操作，环境销毁时一并销毁。
+ */
+
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+class SpineClockRegistry {
+public:
+    static SpineClockRegistry& getInstance();
+
+    /**
+     * 创建时钟
+     * @param owner 所属环境
+     * @param parentId 父时钟ID，-1 表示根时钟
+     * @return 时钟ID，父时钟不存在或属于其他环境时返回 -1
+     */
+    int32_t CreateClock(const void* owner, int32_t parentId);
+
+    /**
+     * 销毁时钟，子时钟改挂到其父时钟，挂在其上的实例恢复独立计时
+     * @param owner 调用方所属环境
+     * @param clockId 时钟ID
+     * @return 是否成功，时钟不存在或属于其他环境时返回 false
+     */
+    bool DestroyClock(const void* owner, int32_t clockId);
+
+    /**
+     * 销毁环境的所有时钟（环境销毁时调用）
+     * @param owner 环境
+     */
+    void DestroyClocks(const void* owner);
+
+    /**
+     * 设置时钟自身的时间缩放
+     * @param owner 调用方所属环境
+     * @param clockId 时钟ID
+     * @param timeScale 时间缩放（不小于 0）
+     * @return 是否成功
+     */
+    bool SetTimeScale(const void* owner, int32_t clockId, float timeScale);
+
+    /**
+     * 暂停或恢复时钟（子时钟一并停止）
+     * @param owner 调用方所属环境
+     * @param clockId 时钟ID
+     * @param paused 是否暂停
+     * @return 是否成功
+     */
+    bool SetPaused(const void* owner, int32_t clockId, bool paused);
+
+    /**
+     * 把实例挂到时钟上
+     * @param owner 调用方所属环境（实例须属于该环境）
+     * @param instanceId 实例ID
+     * @param clockId 时钟ID，-1 表示取下
+     * @return 是否成功
+     */
+    bool Attach(const void* owner, int32_t instanceId, int32_t clockId);
+
+    /**
+     * 取下实例（实例销毁时调用）
+     */
+    void Detach(int32_t instanceId);
+
+    /**
+     * 获取实例的有效时间缩放
+     * @param instanceId 实例ID
+     * @return 时钟链上缩放的乘积，暂停时为 0，未挂时钟时为 1
+     */
+    float GetEffectiveScale(int32_t instanceId) const;
+
+    /**
+     * 收集挂在时钟及其子时钟上的实例
+     * @param owner 调用方所属环境
+     * @param clockId 时钟ID
+     * @param out 输出（实例ID、有效时间缩放），按实例ID排序
+     * @return 时钟是否存在且属于该环境
+     */
+    bool CollectInstances(const void* owner, int32_t clockId, std::vector<std::pair<int32_t, float>>* out) const;
+
+private:
+    SpineClockRegistry() = default;
+
+    struct Clock {
+        const void* owner = nullptr;
+        int32_t parentId = -1;
+        float timeScale = 1.0f;
+        bool paused = false;
+    };
+
+    /**
+     * 沿父链计算有效缩放
+     * @param clockId 时钟ID
+     * @param ancestorId 若不为 -1，同时判断 ancestorId 是否在链上
+     * @param underAncestor 输出是否在 ancestorId 之下（含自身）
+     */
+    float EffectiveScaleLocked(int32_t clockId, int32_t ancestorId = -1, bool* underAncestor = nullptr) const;
+
+    /**
+     * 查找属于 owner 的时钟，不存在或属于其他环境时返回 nullptr
+     */
+    Clock* FindClockLocked(const void* owner, int32_t clockId);
+    const Clock* FindClockLocked(const void* owner, int32_t clockId) const;
+
+    /**
+     * 移除时钟：子时钟改挂到其父时钟，挂在其上的实例取下
+     */
+    void EraseClockLocked(int32_t clockId);
+
+    std::unordered_map<int32_t, Clock> clocks_;
+    std::unordered_map<int32_t, int32_t> instanceClocks_;  // 实例ID -> 时钟ID
+    int32_t nextClockId_ = 1;
+    mutable std::mutex clocksMutex_;
+};
+
+#endif //SPINEHM_SPINECLOCK_H
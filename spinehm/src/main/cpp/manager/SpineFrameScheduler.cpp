@@ -0,0 +1,124 @@
+//
+// Created on 2026/10/19.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+/**
+ * SpineFrameScheduler.cpp - 帧预算调度实现
+ */
+
+#include "SpineFrameScheduler.h"
+#include "SpineClock.h"
+#include "SpineManager.h"
+#include "common/SpineCommandLog.h"
+#include "common/SpineTrace.h"
+#include <algorithm>
+
+void SpineFrameScheduler::SetBudget(double budgetMs) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    budgetMs_ = std::max(0.0, budgetMs);
+}
+
+double SpineFrameScheduler::GetBudget() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return budgetMs_;
+}
+
+SpineSchedulerStats SpineFrameScheduler::GetStats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+}
+
+SpineFrameReport SpineFrameScheduler::RunFrame(float deltaTime,
+                                               const std::vector<std::pair<int32_t, SpineManager*>>& instances) {
+    SPINE_TRACE_SCOPE("Scheduler.frame", -1);
+    std::lock_guard<std::mutex> lock(mutex_);
+    const uint64_t frame = ++stats_.frames;
+
+    struct Candidate {
+        int32_t instanceId;
+        SpineManager* manager;
+        InstanceState* state;
+        double score;
+    };
+    std::vector<Candidate> candidates;
+    candidates.reserve(instances.size());
+
+    int64_t maxArea = 0;
+    std::vector<int64_t> areas;
+    areas.reserve(instances.size());
+    for (const auto& instance : instances) {
+        int64_t area = instance.second ? instance.second->GetViewArea() : 0;
+        areas.push_back(area);
+        maxArea = std::max(maxArea, area);
+    }
+
+    for (size_t i = 0; i < instances.size(); ++i) {
+        SpineManager* manager = instances[i].second;
+        if (!manager) {
+            continue;
+        }
+        InstanceState& state = states_[instances[i].first];
+        state.pendingDelta += deltaTime * SpineClockRegistry::getInstance().GetEffectiveScale(instances[i].first);
+        state.lastSeenFrame = frame;
+
+        // 面积归一化到 [0, 1]，推迟的帧数逐步抬高排序
+        double areaScore = maxArea > 0 ? static_cast<double>(areas[i]) / static_cast<double>(maxArea) : 0.0;
+        double score = manager->GetSchedulePriority() * kPriorityWeight + areaScore +
+                       state.deferredFrames * kStarvationWeight;
+        candidates.push_back({instances[i].first, manager, &state, score});
+    }
+    std::sort(candidates.begin(), candidates.end(), [](const Candidate& a, const Candidate& b) {
+        return a.score != b.score ? a.score > b.score : a.instanceId < b.instanceId;
+    });
+
+    SpineFrameReport report;
+    report.budgetMs = budgetMs_;
+    SpineCommandRecorder& recorder = SpineCommandRecorder::getInstance();
+    const uint64_t frameStartNs = SpineTrace::NowNs();
+    for (const Candidate& candidate : candidates) {
+        InstanceState& state = *candidate.state;
+        double elapsedMs = static_cast<double>(SpineTrace::NowNs() - frameStartNs) / 1e6;
+
+        // 至少更新排序最靠前的实例；估计放不下的推迟，连续推迟过多的强制更新
+        bool fits = budgetMs_ <= 0.0 || report.updatedCount == 0 || elapsedMs + state.estimatedMs <= budgetMs_;
+        if (!fits && state.deferredFrames < kMaxDeferredFrames) {
+            state.deferredFrames++;
+            stats_.deferrals++;
+            report.deferredInstanceIds.push_back(candidate.instanceId);
+            continue;
+        }
+
+        if (recorder.IsRecording()) {
+            recorder.Record(SpineCommand::Update(candidate.instanceId, state.pendingDelta));
+            recorder.Record(SpineCommand::Simple(SpineCommandOp::kRender, candidate.instanceId));
+        }
+        const uint64_t startNs = SpineTrace::NowNs();
+        candidate.manager->Update(state.pendingDelta);
+        candidate.manager->Render();
+        double costMs = static_cast<double>(SpineTrace::NowNs() - startNs) / 1e6;
+
+        state.estimatedMs = state.estimatedMs == 0.0
+                                ? costMs
+                                : state.estimatedMs + (costMs - state.estimatedMs) * kCostSmoothing;
+        state.pendingDelta = 0.0f;
+        state.deferredFrames = 0;
+        report.updatedCount++;
+    }
+    report.elapsedMs = static_cast<double>(SpineTrace::NowNs() - frameStartNs) / 1e6;
+    if (budgetMs_ > 0.0 && report.elapsedMs > budgetMs_) {
+        report.overrunMs = report.elapsedMs - budgetMs_;
+        stats_.overrunFrames++;
+    }
+
+    // 本帧未出现的实例（已销毁或不可见）丢弃状态
+    for (auto it = states_.begin(); it != states_.end();) {
+        if (it->second.lastSeenFrame != frame) {
+            it = states_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    return report;
+}
@@ -0,0 +1,94 @@
+//
+// Created on 2026/10/19.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#ifndef SPINEHM_SPINEFRAMESCHEDULER_H
+#define SPINEHM_SPINEFRAMESCHEDULER_H
+/**
+ * SpineFrameScheduler - 按帧预算调度多个实例的 Update + Render
+ * 每帧按优先级排序：显式优先级 > 视图面积 > 距上次更新的帧数，
+ * 在预算内依次更新，放不下的实例推迟到后续帧，并累计其帧间隔。
+ * 每个 napi_env 一个调度器（由 SpineInstanceRegistry 持有）：RunFrame 会丢弃本次未出现的实例状态，
+ * 多个环境共用时会互相清掉对方的累计帧间隔。
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+class SpineManager;
+
+/**
+ * 单帧调度结果
+ */
+struct SpineFrameReport {
+    double budgetMs = 0.0;
+    double elapsedMs = 0.0;                 // 本帧 Update + Render 实际耗时
+    double overrunMs = 0.0;                 // 超出预算的时间，未超出为 0
+    uint32_t updatedCount = 0;
+    std::vector<int32_t> deferredInstanceIds;
+};
+
+/**
+ * 累计调度统计
+ */
+struct SpineSchedulerStats {
+    uint64_t frames = 0;
+    uint64_t overrunFrames = 0;             // 超出预算的帧数
+    uint64_t deferrals = 0;                 // 实例被推迟的总次数
+};
+
+class SpineFrameScheduler {
+public:
+    SpineFrameScheduler() = default;
+
+    /**
+     * 设置每帧预算
+     * @param budgetMs 预算（毫秒），0 表示不限制（每帧更新全部实例）
+     */
+    void SetBudget(double budgetMs);
+
+    double GetBudget() const;
+
+    /**
+     * 执行一帧调度
+     * @param deltaTime 帧时间间隔（秒）
+     * @param instances 可见实例（实例ID、管理器），调用期间须保持有效
+     * @return 本帧调度结果
+     */
+    SpineFrameReport RunFrame(float deltaTime, const std::vector<std::pair<int32_t, SpineManager*>>& instances);
+
+    SpineSchedulerStats GetStats() const;
+
+private:
+    // 每级显式优先级的排序分数，高于面积分数的范围 [0, 1]
+    static constexpr double kPriorityWeight = 2.0;
+    // 每推迟一帧增加的排序分数，推迟 4 帧后可越过面积差异
+    static constexpr double kStarvationWeight = 0.25;
+    // 连续推迟超过该帧数的实例本帧强制更新，避免长时间静止
+    static constexpr uint32_t kMaxDeferredFrames = 8;
+    // 耗时估计的平滑系数
+    static constexpr double kCostSmoothing = 0.2;
+
+    /**
+     * 每个实例的调度状态
+     */
+    struct InstanceState {
+        float pendingDelta = 0.0f;          // 推迟期间累计的帧间隔
+        uint32_t deferredFrames = 0;
+        double estimatedMs = 0.0;           // Update + Render 耗时估计
+        uint64_t lastSeenFrame = 0;
+    };
+
+    mutable std::mutex mutex_;
+    double budgetMs_ = 0.0;
+    std::unordered_map<int32_t, InstanceState> states_;
+    SpineSchedulerStats stats_;
+};
+
+#endif //SPINEHM_SPINEFRAMESCHEDULER_H
@@ -10,7 +10,23 @@
  */
 
 #include "SpineManager.h"
-#include "spine_napi.h"
+#include "SpinePoseGroup.h"
+#include "common/common.h"
+#include "render/SpineBitmapCache.h"
+#include "asset/SpineAnimationIndex.h"
+#include "asset/SpineAssetCache.h"
+#include "asset/SpineAtlasContainer.h"
+#include "asset/SpineAtlasVariant.h"
+#include "asset/SpineBoundsTable.h"
+#include "asset/SpineBundle.h"
+#include "asset/SpineQuantizedTimeline.h"
+#include "asset/SpineRegionIndex.h"
+#include "asset/SpineTimelineBatch.h"
+#include "common/SpineEventBuffer.h"
+#include "common/SpineTrace.h"
+#include "common/SpineWorkerPool.h"
+#include "manager/SpineSpatialIndex.h"
+#include <atomic>
 #include <cstring>
 #include <algorithm>
 #include <cmath>
@@ -26,17 +42,60 @@
 
 using std::string;
 
+namespace {
+// 并行蒙皮阈值（顶点数），0 表示禁用
+std::atomic<uint32_t> g_parallelSkinningThreshold{2048};
+
+// 暂时注释掉 Spine 4.2 动画状态监听器
+/*
+void SpineAnimationStateListener(spine::AnimationState* state, spine::EventType type, spine::TrackEntry* entry,
+                                 spine::Event* event) {
+    auto* manager = static_cast<SpineManager*>(state->getRendererObject());
+    
+    // 只传递运行时内部字符串的指针，是否构造事件对象由订阅决定
+    SpineEventDataView view;
+    const SpineEventDataView* eventView = nullptr;
+    if (type == spine::EventType_Event && event) {
+        view.name = event->getData().getName().buffer();
+        view.intValue = event->getIntValue();
+        view.floatValue = event->getFloatValue();
+        view.stringValue = event->getStringValue().buffer();
+        view.time = event->getTime();
+        view.balance = event->getBalance();
+        view.volume = event->getVolume();
+        eventView = &view;
+    }
+    manager->TriggerEvent(static_cast<SpineEventType>(type), entry->getTrackIndex(),
+                          entry->getAnimation()->getName().buffer(), eventView);
+}
+*/
+
+// 每块顶点数，取向量宽度的整数倍，只有最后一块会走标量尾部
+constexpr size_t kParallelSkinningGrain = 1024;
+}
+
 /**
  * SpineManager 构造函数
  */
 SpineManager::SpineManager(const string& surfaceId, std::unique_ptr<SpineRenderContext> renderContext)
     : renderContext_(std::move(renderContext))
+    , instanceId_(-1)
+    , schedulePriority_(0)
     , isLoaded_(false)
     , isPaused_(false)
     , timeScale_(1.0f)
+    , trackTime_(0.0)
+    , atlasVariant_(0)
+    , hasVisibleRect_(false)
+    , packedMeshBytes_(0)
+    , skeletonDataBytes_(0)
+    , poseSignature_(0)
+    , poseVersion_(0)
+    , fullDamage_(true)
     , eventCallback_(nullptr)
     , globalEventCallback_(nullptr)
-    , callbackInstanceId_(-1) {
+    , callbackInstanceId_(-1)
+    , eventTypeMask_(kSpineEventMaskAll) {
     
     // 暂时注释掉 Spine 4.2 对象初始化
     // atlas_ = nullptr;
@@ -58,30 +117,139 @@ SpineManager::SpineManager(const string& surfaceId, std::unique_ptr<SpineRenderC
  */
 SpineManager::~SpineManager() {
     Cleanup();
+    
+    // 缓冲随对象释放
+    SpineMemoryTracker::getInstance().Update(reportedMemory_, SpineMemoryUsage());
 }
 
 // ==================== 数据加载 ====================
 
 bool SpineManager::LoadSpineData(const string& spineDataPath, const string& atlasDataPath, const SpineLoadOptions& options) {
+    SPINE_TRACE_SCOPE("LoadSpineData", instanceId_);
+    std::lock_guard<std::mutex> lock(dataMutex_);
+    
+    // 预处理的图集容器：mmap 后直接使用 RGBA 页面，跳过 PNG 解码
+    std::shared_ptr<SpineAtlasContainer> atlasContainer;
+    if (SpineAtlasContainer::IsContainerPath(atlasDataPath)) {
+        atlasContainer = SpineAssetCache::getInstance().AcquireAtlasContainer(atlasDataPath);
+        if (!atlasContainer) {
+            return false;
+        }
+    }
+    return LoadDataLocked(spineDataPath, atlasDataPath, std::move(atlasContainer), nullptr, options);
+}
+
+bool SpineManager::LoadSpineBundle(const string& bundlePath, const SpineLoadOptions& options) {
+    SPINE_TRACE_SCOPE("LoadSpineBundle", instanceId_);
     std::lock_guard<std::mutex> lock(dataMutex_);
     
+    // 一次 mmap 得到骨骼数据和图集容器，同一资源包的实例共享映射
+    std::shared_ptr<SpineBundle> bundle = SpineAssetCache::getInstance().AcquireBundle(bundlePath);
+    if (!bundle) {
+        return false;
+    }
+    return LoadDataLocked(bundlePath, bundlePath, bundle->GetAtlasContainer(), bundle, options);
+}
+
+bool SpineManager::LoadDataLocked(const string& spineDataPath, const string& atlasDataPath,
+                                  std::shared_ptr<SpineAtlasContainer> atlasContainer,
+                                  const std::shared_ptr<SpineBundle>& bundle, const SpineLoadOptions& options) {
+    // 图集变体：视图已布局时按当前显示缩放直接加载选中的变体，不解压原图集的页面
+    atlasVariants_ = SpineAtlasVariants::Normalize(atlasDataPath, options.atlasVariants);
+    atlasVariant_ = 0;
+    atlasVariantLoad_.reset();
+    if (atlasVariants_.size() > 1 && renderContext_ && renderContext_->viewWidth > 0 &&
+        renderContext_->viewHeight > 0) {
+        const size_t target = SpineAtlasVariants::Select(atlasVariants_, renderContext_->scale * options.scale, 0);
+        const string& variantPath = atlasVariants_[target].atlasPath;
+        if (target != 0 && SpineAtlasContainer::IsContainerPath(variantPath)) {
+            std::shared_ptr<SpineAtlasContainer> variantContainer =
+                SpineAssetCache::getInstance().AcquireAtlasContainer(variantPath);
+            if (variantContainer) {
+                atlasContainer = std::move(variantContainer);
+                atlasVariant_ = target;
+            }
+        } else if (target != 0) {
+            atlasContainer.reset();
+            atlasVariant_ = target;
+        }
+    }
+    const string& atlasPath = atlasVariants_[atlasVariant_].atlasPath;
+    atlasContainer_ = std::move(atlasContainer);
+    
+    // 区域索引每个图集只构建一次，后续加载同一图集的实例直接复用；首次构建直接读已获取的容器
+    {
+        SPINE_TRACE_SCOPE("LoadSpineData.regionIndex", instanceId_);
+        regionIndex_ = SpineAssetCache::getInstance().AcquireRegionIndex(atlasPath, atlasContainer_);
+    }
+    
+    // 延迟解码动画：加载时只扫描动画的字节范围，二进制骨骼数据没有索引，仍在加载时全部解码
+    loadOptions_ = options;
+    animationIndex_.reset();
+    animationDecoded_.clear();
+    pendingMixes_.clear();
+    if (options.lazyAnimations) {
+        SPINE_TRACE_SCOPE("LoadSpineData.animationIndex", instanceId_);
+        animationIndex_ = SpineAssetCache::getInstance().AcquireAnimationIndex(spineDataPath, bundle);
+        if (animationIndex_) {
+            animationDecoded_.assign(animationIndex_->GetAnimationCount(), false);
+        }
+    }
+    
+    // 已预乘的容器只能按预乘混合；未预乘的容器按加载选项提供原始或预乘页面（预乘页面由容器转换并缓存）
+    bool premultipliedAlpha = options.premultipliedAlpha;
+    if (atlasContainer_) {
+        premultipliedAlpha = premultipliedAlpha || atlasContainer_->IsPremultiplied();
+        if (renderContext_) {
+            renderContext_->premultipliedAlpha = premultipliedAlpha;
+        }
+    }
+    
     // 暂时注释掉实际的 Spine 4.2 加载逻辑
     /*
     try {
         // 清理现有资源
         CleanupRenderResources();
         
-        // 加载图集
-        atlas_ = new spine::Atlas(atlasDataPath.c_str(), nullptr);
+        // 骨骼数据占用：运行时安装 spine::DebugExtension，按加载前后的已用内存差计算
+        auto* debugExtension = static_cast<spine::DebugExtension*>(spine::SpineExtension::getInstance());
+        size_t usedBefore = debugExtension->getUsedMemory();
+        
+        // 加载图集（容器使用内嵌的 .atlas 文本，页面纹理由容器直接提供）
+        if (atlasContainer_) {
+            size_t atlasTextSize = 0;
+            const char* atlasText = atlasContainer_->GetAtlasText(&atlasTextSize);
+            containerTextureLoader_ = new SpineContainerTextureLoader(atlasContainer_, premultipliedAlpha);
+            
+            // 纹理上传完成前不允许按预算释放解压页面
+            atlasContainer_->PinDecodedPages();
+            atlas_ = new spine::Atlas(atlasText, static_cast<int>(atlasTextSize), "", containerTextureLoader_);
+            atlasContainer_->UnpinDecodedPages();
+        } else {
+            atlas_ = new spine::Atlas(atlasPath.c_str(), nullptr);
+        }
         if (!atlas_) {
             return false;
         }
         
-        // 创建附件加载器
-        spine::AtlasAttachmentLoader attachmentLoader(atlas_);
+        // 创建附件加载器：区域按名称哈希查找，不再逐个比较全部区域
+        SpineIndexedAttachmentLoader attachmentLoader(atlas_, regionIndex_.get());
         
-        // 加载骨骼数据
-        if (spineDataPath.find(".json") != string::npos) {
+        // 加载骨骼数据（资源包直接从映射内存解析，不再打开文件；延迟解码时解析去掉动画的文本）
+        if (animationIndex_) {
+            skeletonJson_ = new spine::SkeletonJson(&attachmentLoader);
+            skeletonData_ = skeletonJson_->readSkeletonData(animationIndex_->GetSkeletonText().c_str());
+        } else if (bundle) {
+            size_t skeletonSize = 0;
+            const uint8_t* skeletonBytes = bundle->GetSkeletonData(&skeletonSize);
+            if (bundle->IsSkeletonJson()) {
+                skeletonJson_ = new spine::SkeletonJson(&attachmentLoader);
+                skeletonData_ = skeletonJson_->readSkeletonData(reinterpret_cast<const char*>(skeletonBytes));
+            } else {
+                spine::SkeletonBinary skeletonBinary(&attachmentLoader);
+                skeletonData_ = skeletonBinary.readSkeletonData(skeletonBytes, static_cast<int>(skeletonSize));
+            }
+        } else if (spineDataPath.find(".json") != string::npos) {
             skeletonJson_ = new spine::SkeletonJson(&attachmentLoader);
             skeletonData_ = skeletonJson_->readSkeletonDataFile(spineDataPath.c_str());
         } else {
@@ -93,17 +261,48 @@ bool SpineManager::LoadSpineData(const string& spineDataPath, const string& atla
             return false;
         }
         
+        // 骨骼时间轴批量采样：关键帧时间相同的旋转、平移、缩放时间轴合并为一个时间轴。
+        // 在量化之前进行，合并后的时间轴保留浮点关键帧，量化只处理剩余的时间轴
+        size_t batchedBytes = 0;
+        if (options.batchTimelines) {
+            SPINE_TRACE_SCOPE("LoadSpineData.batch", instanceId_);
+            spine::Vector<spine::Animation*>& animations = skeletonData_->getAnimations();
+            for (size_t i = 0; i < animations.size(); ++i) {
+                batchedBytes += SpineBatchedBoneTimeline::Apply(animations[i]);
+            }
+        }
+        
+        // 关键帧量化存储：释放浮点帧数组，采样前按轨道时间解码两侧的关键帧
+        size_t quantizedBytes = 0;
+        if (options.quantizeTimelines) {
+            SPINE_TRACE_SCOPE("LoadSpineData.quantize", instanceId_);
+            spine::Vector<spine::Animation*>& animations = skeletonData_->getAnimations();
+            for (size_t i = 0; i < animations.size(); ++i) {
+                SpineQuantizedAnimation quantized;
+                quantized.Build(animations[i], options.quantizeTolerance);
+                if (!quantized.IsEmpty()) {
+                    quantizedBytes += quantized.GetMemoryBytes();
+                    quantizedAnimations_.emplace(animations[i], std::move(quantized));
+                }
+            }
+        }
+        
         // 创建骨骼实例
         skeleton_ = new spine::Skeleton(skeletonData_);
         
         // 创建动画状态
         animationStateData_ = new spine::AnimationStateData(skeletonData_);
         animationState_ = new spine::AnimationState(animationStateData_);
+        animationState_->setRendererObject(this);
+        animationState_->setListener(SpineAnimationStateListener);
         
         // 设置默认皮肤
         skeleton_->setSkin(skeletonData_->getDefaultSkin());
         skeleton_->updateWorldTransform();
         
+        skeletonDataBytes_ = debugExtension->getUsedMemory() - usedBefore + quantizedBytes + batchedBytes;
+        ReportMemoryLocked();
+        
         isLoaded_ = true;
         return true;
         
@@ -115,18 +314,35 @@ bool SpineManager::LoadSpineData(const string& spineDataPath, const string& atla
     // 临时实现：仅设置加载状态
     isLoaded_ = true;
     
-    // 创建默认动画和皮肤列表
+    // 更换数据后不再与原姿态共享组同步
+    LeavePoseGroupLocked();
+    spineDataPath_ = spineDataPath;
+    currentSkin_.clear();
+    trackTime_ = 0.0;
+    boundsTables_ = SpineAssetCache::getInstance().AcquireBoundsTables(spineDataPath, options.scale);
+    poseSignature_ = 0;
+    MarkStateChanged("load:" + spineDataPath + ":" + std::to_string(options.scale));
+    
+    // 创建默认动画和皮肤列表（延迟解码时动画列表取自索引）
     availableAnimations_.clear();
-    availableAnimations_.push_back("idle");
-    availableAnimations_.push_back("walk");
-    availableAnimations_.push_back("run");
-    availableAnimations_.push_back("attack");
+    if (animationIndex_) {
+        for (size_t i = 0; i < animationIndex_->GetAnimationCount(); ++i) {
+            availableAnimations_.push_back(animationIndex_->GetAnimationName(i));
+        }
+    } else {
+        availableAnimations_.push_back("idle");
+        availableAnimations_.push_back("walk");
+        availableAnimations_.push_back("run");
+        availableAnimations_.push_back("attack");
+    }
     
     availableSkins_.clear();
     availableSkins_.push_back("default");
     availableSkins_.push_back("blue");
     availableSkins_.push_back("red");
     
+    ReportMemoryLocked();
+    SpineMemoryTracker::getInstance().EnforceBudget();
     return true;
 }
 
@@ -140,7 +356,12 @@ std::vector<string> SpineManager::GetAnimations() const {
     // 暂时注释掉 Spine 4.2 实现
     /*
     std::vector<string> animations;
-    if (skeletonData_) {
+    if (animationIndex_) {
+        // 延迟解码时骨骼数据中只有已解码的动画，列表取自索引
+        for (size_t i = 0; i < animationIndex_->GetAnimationCount(); ++i) {
+            animations.push_back(animationIndex_->GetAnimationName(i));
+        }
+    } else if (skeletonData_) {
         auto& animationsData = skeletonData_->getAnimations();
         for (size_t i = 0; i < animationsData.size(); ++i) {
             animations.push_back(animationsData[i]->getName().buffer());
@@ -176,6 +397,11 @@ std::vector<string> SpineManager::GetSkins() const {
     return availableSkins_;
 }
 
+string SpineManager::GetSpineDataPath() const {
+    std::lock_guard<std::mutex> lock(dataMutex_);
+    return isLoaded_ ? spineDataPath_ : string();
+}
+
 // ==================== 动画控制 ====================
 
 bool SpineManager::SetAnimation(int32_t trackIndex, const string& animationName, bool loop) {
@@ -185,6 +411,11 @@ bool SpineManager::SetAnimation(int32_t trackIndex, const string& animationName,
         return false;
     }
     
+    // 延迟解码模式下首次使用时解码
+    if (!EnsureAnimationLocked(animationName)) {
+        return false;
+    }
+    
     // 暂时注释掉 Spine 4.2 实现
     /*
     if (animationState_) {
@@ -194,9 +425,8 @@ bool SpineManager::SetAnimation(int32_t trackIndex, const string& animationName,
     return false;
     */
     
-    // 临时实现：仅检查动画是否存在
-    auto it = std::find(availableAnimations_.begin(), availableAnimations_.end(), animationName);
-    return it != availableAnimations_.end();
+    MarkStateChanged("set:" + std::to_string(trackIndex) + ":" + animationName + ":" + (loop ? "1" : "0"));
+    return true;
 }
 
 bool SpineManager::AddAnimation(int32_t trackIndex, const string& animationName, bool loop, float delay) {
@@ -206,6 +436,11 @@ bool SpineManager::AddAnimation(int32_t trackIndex, const string& animationName,
         return false;
     }
     
+    // 延迟解码模式下首次使用时解码
+    if (!EnsureAnimationLocked(animationName)) {
+        return false;
+    }
+    
     // 暂时注释掉 Spine 4.2 实现
     /*
     if (animationState_) {
@@ -215,9 +450,209 @@ bool SpineManager::AddAnimation(int32_t trackIndex, const string& animationName,
     return false;
     */
     
-    // 临时实现：仅检查动画是否存在
-    auto it = std::find(availableAnimations_.begin(), availableAnimations_.end(), animationName);
-    return it != availableAnimations_.end();
+    MarkStateChanged("add:" + std::to_string(trackIndex) + ":" + animationName + ":" + (loop ? "1" : "0") +
+                     ":" + std::to_string(delay));
+    return true;
+}
+
+void SpineManager::UpdateAtlasVariantLocked() {
+    if (!isLoaded_ || atlasVariants_.size() < 2 || !renderContext_) {
+        return;
+    }
+    // 尚未布局时保持当前变体
+    if (renderContext_->viewWidth <= 0 || renderContext_->viewHeight <= 0) {
+        return;
+    }
+    
+    // 屏幕上每个原图集像素对应的像素数：渲染缩放乘以加载缩放
+    const float requiredScale = renderContext_->scale * loadOptions_.scale;
+    const size_t target = SpineAtlasVariants::Select(atlasVariants_, requiredScale, atlasVariant_);
+    if (atlasVariantLoad_ && atlasVariantLoad_->GetVariantIndex() == target) {
+        return;
+    }
+    
+    // 回到当前变体时取消尚未替换的切换；否则重新提交（旧的准备结果随任务丢弃）
+    if (target == atlasVariant_) {
+        atlasVariantLoad_.reset();
+        return;
+    }
+    atlasVariantLoad_ = SpineAtlasVariantLoad::Start(target, atlasVariants_[target].atlasPath,
+                                                     renderContext_->premultipliedAlpha);
+}
+
+void SpineManager::ApplyAtlasVariantLocked() {
+    if (!atlasVariantLoad_ || !atlasVariantLoad_->IsReady()) {
+        return;
+    }
+    std::shared_ptr<SpineAtlasVariantLoad> load = std::move(atlasVariantLoad_);
+    if (!load->Succeeded()) {
+        // 变体缺失或损坏时保持当前变体
+        return;
+    }
+    
+    SPINE_TRACE_SCOPE("AtlasVariant.apply", instanceId_);
+    
+    // 暂时注释掉 Spine 4.2 实现
+    /*
+    // 附件改用新图集中同名的区域。变体的区域尺寸与原尺寸按同一比例缩放，附件的偏移不变，只有 UV 和纹理变化，
+    // 世界顶点和姿态共享组不受影响
+    spine::TextureLoader* textureLoader = nullptr;
+    spine::Atlas* atlas = load->TakeAtlas(&textureLoader);
+    spine::Vector<spine::AtlasRegion*>& regions = atlas->getRegions();
+    const SpineRegionIndex* index = load->GetRegionIndex().get();
+    auto findRegion = [&](const spine::String& path) -> spine::AtlasRegion* {
+        int32_t i = index->Find(path.buffer(), path.length());
+        return i >= 0 ? regions[i] : nullptr;
+    };
+    
+    spine::Vector<spine::Skin*>& skins = skeletonData_->getSkins();
+    for (size_t i = 0; i < skins.size(); ++i) {
+        spine::Skin::AttachmentMap::Entries entries = skins[i]->getAttachments();
+        while (entries.hasNext()) {
+            spine::Attachment* attachment = entries.next()._attachment;
+            spine::Sequence* sequence = nullptr;
+            spine::String basePath;
+            if (attachment->getRTTI().isExactly(spine::RegionAttachment::rtti)) {
+                auto* region = static_cast<spine::RegionAttachment*>(attachment);
+                sequence = region->getSequence();
+                basePath = region->getPath();
+                if (!sequence) {
+                    if (spine::AtlasRegion* atlasRegion = findRegion(region->getPath())) {
+                        region->setRegion(atlasRegion);
+                        region->updateRegion();
+                    }
+                }
+            } else if (attachment->getRTTI().isExactly(spine::MeshAttachment::rtti)) {
+                auto* mesh = static_cast<spine::MeshAttachment*>(attachment);
+                sequence = mesh->getSequence();
+                basePath = mesh->getPath();
+                if (!sequence) {
+                    if (spine::AtlasRegion* atlasRegion = findRegion(mesh->getPath())) {
+                        mesh->setRegion(atlasRegion);
+                        mesh->updateRegion();
+                    }
+                }
+            }
+            // 序列的每一帧各自对应一个区域
+            if (sequence) {
+                spine::Vector<spine::TextureRegion*>& frames = sequence->getRegions();
+                for (size_t frame = 0; frame < frames.size(); ++frame) {
+                    spine::String framePath = sequence->getPath(basePath, static_cast<int>(frame));
+                    if (spine::AtlasRegion* atlasRegion = findRegion(framePath)) {
+                        frames[frame] = atlasRegion;
+                    }
+                }
+            }
+        }
+    }
+    
+    // 原图集在所有附件改绑后释放
+    delete atlas_;
+    delete containerTextureLoader_;
+    atlas_ = atlas;
+    containerTextureLoader_ = textureLoader;
+    */
+    
+    atlasContainer_ = load->GetAtlasContainer();
+    regionIndex_ = load->GetRegionIndex();
+    atlasVariant_ = load->GetVariantIndex();
+    
+    SpineBitmapCache::getInstance().Invalidate(this);
+    fullDamage_ = true;
+    ReportMemoryLocked();
+}
+
+bool SpineManager::PreloadAnimations(const std::vector<string>& animationNames) {
+    SPINE_TRACE_SCOPE("PreloadAnimations", instanceId_);
+    std::lock_guard<std::mutex> lock(dataMutex_);
+    
+    if (!isLoaded_) {
+        return false;
+    }
+    
+    bool allFound = true;
+    for (const string& animationName : animationNames) {
+        allFound = EnsureAnimationLocked(animationName) && allFound;
+    }
+    return allFound;
+}
+
+bool SpineManager::EnsureAnimationLocked(const string& animationName) {
+    if (!animationIndex_) {
+        // 暂时注释掉 Spine 4.2 实现
+        /*
+        return skeletonData_ && skeletonData_->findAnimation(animationName.c_str()) != nullptr;
+        */
+        return std::find(availableAnimations_.begin(), availableAnimations_.end(), animationName) !=
+               availableAnimations_.end();
+    }
+    
+    const int32_t index = animationIndex_->Find(animationName);
+    if (index < 0) {
+        return false;
+    }
+    if (animationDecoded_[index]) {
+        return true;
+    }
+    
+    SPINE_TRACE_SCOPE("DecodeAnimation", instanceId_);
+    
+    // 暂时注释掉 Spine 4.2 实现
+    /*
+    // 只解析该动画的文本。时间轴解码到本实例的骨骼数据：变形、序列和事件时间轴引用其中的附件和事件数据。
+    // 运行时的 SkeletonJson::readAnimation 为 private，接入时需改为 public
+    auto* debugExtension = static_cast<spine::DebugExtension*>(spine::SpineExtension::getInstance());
+    size_t usedBefore = debugExtension->getUsedMemory();
+    
+    spine::Animation* animation = nullptr;
+    {
+        string text = animationIndex_->GetAnimationText(index);
+        spine::Json root(text.c_str());
+        spine::Json* animationMap = spine::Json::getItem(&root, animationName.c_str());
+        if (animationMap) {
+            animation = skeletonJson_->readAnimation(animationMap, skeletonData_);
+        }
+    }
+    if (!animation) {
+        return false;
+    }
+    skeletonData_->getAnimations().add(animation);
+    
+    // 与加载时相同：先合并批量采样的时间轴，再量化剩余的时间轴
+    size_t batchedBytes = 0;
+    if (loadOptions_.batchTimelines) {
+        batchedBytes = SpineBatchedBoneTimeline::Apply(animation);
+    }
+    size_t quantizedBytes = 0;
+    if (loadOptions_.quantizeTimelines) {
+        SpineQuantizedAnimation quantized;
+        quantized.Build(animation, loadOptions_.quantizeTolerance);
+        if (!quantized.IsEmpty()) {
+            quantizedBytes = quantized.GetMemoryBytes();
+            quantizedAnimations_.emplace(animation, std::move(quantized));
+        }
+    }
+    skeletonDataBytes_ += debugExtension->getUsedMemory() - usedBefore + quantizedBytes + batchedBytes;
+    */
+    
+    animationDecoded_[index] = true;
+    
+    // 设置两端都已解码的待定混合
+    for (auto it = pendingMixes_.begin(); it != pendingMixes_.end();) {
+        if (!animationDecoded_[it->from] || !animationDecoded_[it->to]) {
+            ++it;
+            continue;
+        }
+        // 暂时注释掉 Spine 4.2 实现
+        /*
+        animationStateData_->setMix(animationIndex_->GetAnimationName(it->from).c_str(),
+                                    animationIndex_->GetAnimationName(it->to).c_str(), it->duration);
+        */
+        it = pendingMixes_.erase(it);
+    }
+    
+    ReportMemoryLocked();
+    return true;
 }
 
 void SpineManager::ClearTrack(int32_t trackIndex) {
@@ -233,6 +668,8 @@ void SpineManager::ClearTrack(int32_t trackIndex) {
         animationState_->clearTrack(trackIndex);
     }
     */
+    
+    MarkStateChanged("clear:" + std::to_string(trackIndex));
 }
 
 void SpineManager::ClearTracks() {
@@ -248,6 +685,8 @@ void SpineManager::ClearTracks() {
         animationState_->clearTracks();
     }
     */
+    
+    MarkStateChanged("clearAll");
 }
 
 // ==================== 外观控制 ====================
@@ -274,7 +713,13 @@ bool SpineManager::SetSkin(const string& skinName) {
     
     // 临时实现：仅检查皮肤是否存在
     auto it = std::find(availableSkins_.begin(), availableSkins_.end(), skinName);
-    return it != availableSkins_.end();
+    if (it == availableSkins_.end()) {
+        return false;
+    }
+    
+    currentSkin_ = skinName;
+    MarkStateChanged("skin:" + skinName);
+    return true;
 }
 
 void SpineManager::SetMix(const string& fromAnimation, const string& toAnimation, float duration) {
@@ -284,12 +729,35 @@ void SpineManager::SetMix(const string& fromAnimation, const string& toAnimation
         return;
     }
     
+    // 延迟解码时不为设置混合而解码动画：两端尚未都解码时先记下，解码后再设置
+    bool deferred = false;
+    if (animationIndex_) {
+        const int32_t fromIndex = animationIndex_->Find(fromAnimation);
+        const int32_t toIndex = animationIndex_->Find(toAnimation);
+        if (fromIndex < 0 || toIndex < 0) {
+            return;
+        }
+        deferred = !animationDecoded_[fromIndex] || !animationDecoded_[toIndex];
+        if (deferred) {
+            auto it = std::find_if(pendingMixes_.begin(), pendingMixes_.end(), [&](const PendingMix& mix) {
+                return mix.from == fromIndex && mix.to == toIndex;
+            });
+            if (it != pendingMixes_.end()) {
+                it->duration = duration;
+            } else {
+                pendingMixes_.push_back(PendingMix{fromIndex, toIndex, duration});
+            }
+        }
+    }
+    
     // 暂时注释掉 Spine 4.2 实现
     /*
-    if (animationStateData_) {
+    if (animationStateData_ && !deferred) {
         animationStateData_->setMix(fromAnimation.c_str(), toAnimation.c_str(), duration);
     }
     */
+    
+    MarkStateChanged("mix:" + fromAnimation + ":" + toAnimation + ":" + std::to_string(duration));
 }
 
 // ==================== 播放控制 ====================
@@ -305,6 +773,8 @@ void SpineManager::SetTimeScale(float timeScale) {
         animationState_->setTimeScale(timeScale);
     }
     */
+    
+    MarkStateChanged("timeScale:" + std::to_string(timeScale));
 }
 
 void SpineManager::Pause() {
@@ -358,7 +828,9 @@ string SpineManager::GetState() const {
     // 临时返回基本状态信息
     return "{\"isLoaded\":" + string(isLoaded_ ? "true" : "false") + 
            ",\"isPaused\":" + string(isPaused_ ? "true" : "false") + 
-           ",\"timeScale\":" + std::to_string(timeScale_) + "}";
+           ",\"timeScale\":" + std::to_string(timeScale_) +
+           ",\"trackTime\":" + std::to_string(trackTime_) +
+           ",\"poseGroup\":" + std::to_string(poseGroup_ ? poseGroup_->GetGroupId() : -1) + "}";
 }
 
 // ==================== 视图控制 ====================
@@ -370,6 +842,33 @@ void SpineManager::UpdateViewSize(int32_t width, int32_t height) {
         renderContext_->viewWidth = width;
         renderContext_->viewHeight = height;
     }
+    
+    // 位图按视图尺寸分配，尺寸变化后重新分配
+    SpineBitmapCache::getInstance().Release(this);
+    fullDamage_ = true;
+    
+    UpdateAtlasVariantLocked();
+}
+
+int64_t SpineManager::GetViewArea() const {
+    std::lock_guard<std::mutex> lock(dataMutex_);
+    
+    if (!renderContext_ || renderContext_->viewWidth <= 0 || renderContext_->viewHeight <= 0) {
+        return 0;
+    }
+    return static_cast<int64_t>(renderContext_->viewWidth) * renderContext_->viewHeight;
+}
+
+void SpineManager::SetVisibleRect(const SpineRect& rect) {
+    std::lock_guard<std::mutex> lock(dataMutex_);
+    visibleRect_ = rect;
+    hasVisibleRect_ = true;
+}
+
+void SpineManager::ClearVisibleRect() {
+    std::lock_guard<std::mutex> lock(dataMutex_);
+    visibleRect_ = SpineRect();
+    hasVisibleRect_ = false;
 }
 
 void SpineManager::SetScale(float scale) {
@@ -378,64 +877,279 @@ void SpineManager::SetScale(float scale) {
     if (renderContext_) {
         renderContext_->scale = scale;
     }
+    SpineBitmapCache::getInstance().Invalidate(this);
+    fullDamage_ = true;
+    
+    UpdateAtlasVariantLocked();
 }
 
 void SpineManager::SetPremultipliedAlpha(bool premultipliedAlpha) {
     std::lock_guard<std::mutex> lock(dataMutex_);
     
+    if (atlasContainer_ && atlasContainer_->IsPremultiplied()) {
+        premultipliedAlpha = true;
+    }
+    
+    // 暂时注释掉 Spine 4.2 实现
+    /*
+    // 未预乘的图集容器同时缓存两种页面像素，重新创建页面纹理即可切换，不重新加载骨骼数据
+    if (atlas_ && containerTextureLoader_ && !atlasContainer_->IsPremultiplied()) {
+        auto* loader = static_cast<SpineContainerTextureLoader*>(containerTextureLoader_);
+        loader->SetPremultiplied(premultipliedAlpha);
+        spine::Vector<spine::AtlasPage*>& pages = atlas_->getPages();
+        for (size_t i = 0; i < pages.size(); ++i) {
+            loader->unload(pages[i]->texture);
+            loader->load(*pages[i], pages[i]->name);
+        }
+    }
+    */
+    
     if (renderContext_) {
         renderContext_->premultipliedAlpha = premultipliedAlpha;
     }
+    SpineBitmapCache::getInstance().Invalidate(this);
+    fullDamage_ = true;
+}
+
+void SpineManager::SetTint(float r, float g, float b, float a) {
+    std::lock_guard<std::mutex> lock(dataMutex_);
+    
+    if (renderContext_) {
+        renderContext_->tintR = r;
+        renderContext_->tintG = g;
+        renderContext_->tintB = b;
+        renderContext_->tintA = a;
+    }
+    SpineBitmapCache::getInstance().Invalidate(this);
+    fullDamage_ = true;
+}
+
+// ==================== 姿态共享 ====================
+
+bool SpineManager::JoinPoseGroup(int32_t groupId) {
+    std::lock_guard<std::mutex> lock(dataMutex_);
+    
+    if (!isLoaded_) {
+        return false;
+    }
+    
+    if (poseGroup_ && poseGroup_->GetGroupId() == groupId) {
+        return true;
+    }
+    LeavePoseGroupLocked();
+    
+    // 签名包含骨骼数据、皮肤和全部动画指令及其下达时的轨道时间，轨道时间也需与领导者一致
+    std::shared_ptr<SpinePoseGroup> group = SpinePoseGroupRegistry::getInstance().Acquire(groupId);
+    if (!group->AddMember(this, poseSignature_, trackTime_)) {
+        return false;
+    }
+    
+    poseGroup_ = group;
+    poseVersion_ = 0;
+    return true;
+}
+
+void SpineManager::LeavePoseGroup() {
+    std::lock_guard<std::mutex> lock(dataMutex_);
+    LeavePoseGroupLocked();
+}
+
+int32_t SpineManager::GetPoseGroupId() const {
+    std::lock_guard<std::mutex> lock(dataMutex_);
+    return poseGroup_ ? poseGroup_->GetGroupId() : -1;
 }
 
 // ==================== 渲染循环 ====================
 
 void SpineManager::Update(float deltaTime) {
+    SPINE_TRACE_SCOPE("Update", instanceId_);
     std::lock_guard<std::mutex> lock(dataMutex_);
     
     if (!isLoaded_ || isPaused_) {
         return;
     }
     
+    // 动画状态总是推进（事件照常触发）；跟随者同样推进，离组后可以直接接手计算
+    const float scaledDelta = deltaTime * timeScale_;
+    trackTime_ += scaledDelta;
     // 暂时注释掉 Spine 4.2 实现
+    /*
+    if (animationState_) {
+        animationState_->update(scaledDelta);
+    }
+    */
+    
+    // 与组内多数成员的指令或轨道时间不一致时离开姿态共享组
+    SyncPoseGroupLocked();
+    
+    // 跟随者的姿态和顶点由领导者计算
+    if (IsPoseFollower()) {
+        return;
+    }
+    
+    // 按包围盒表判断不可见时跳过姿态和顶点计算；清空绘制内容，渲染时与上一帧比较清除旧区域
+    if (IsCulledLocked()) {
+        worldVertices_.clear();
+        drawRanges_.clear();
+        renderStats_.culledFrames++;
+        PublishHitBoundsLocked();
+        return;
+    }
+    
     /*
     if (animationState_ && skeleton_) {
-        // 更新动画状态
-        animationState_->update(deltaTime * timeScale_);
-        animationState_->apply(*skeleton_);
+        // 应用动画
+        {
+            SPINE_TRACE_SCOPE("Update.apply", instanceId_);
+            SeekQuantizedTimelinesLocked();
+            animationState_->apply(*skeleton_);
+        }
         
         // 更新骨骼世界变换
-        skeleton_->updateWorldTransform();
+        {
+            SPINE_TRACE_SCOPE("Update.worldTransform", instanceId_);
+            skeleton_->updateWorldTransform();
+        }
+        
+        // 计算世界顶点
+        BuildWorldVertices(worldVertices_, drawRanges_);
     }
     */
+    
+    // 领导者发布本帧姿态
+    if (poseGroup_) {
+        poseGroup_->PublishPose(this, trackTime_, worldVertices_, drawRanges_);
+    }
+    PublishHitBoundsLocked();
+    
+    // 缓冲增长后检查全局预算
+    ReportMemoryLocked();
+    SpineMemoryTracker::getInstance().EnforceBudget();
 }
 
 void SpineManager::Render() {
+    SPINE_TRACE_SCOPE("Render", instanceId_);
     std::lock_guard<std::mutex> lock(dataMutex_);
     
     if (!isLoaded_) {
         return;
     }
     
+    // 后台准备好的图集变体在绘制前替换
+    ApplyAtlasVariantLocked();
+    
+    // 单独暂停的成员不经过 Update，在这里检查是否仍与组同步
+    SyncPoseGroupLocked();
+    
+    // 跟随者使用领导者在相同轨道时间发布的世界顶点，只应用自身的变换和着色
+    if (IsPoseFollower()) {
+        poseVersion_ = poseGroup_->CopyPose(poseVersion_, trackTime_, &worldVertices_, &drawRanges_);
+        if (poseVersion_ == 0) {
+            // 领导者尚未发布姿态
+            return;
+        }
+        PublishHitBoundsLocked();
+    }
+    
+    if (!renderContext_) {
+        return;
+    }
+    
+    // 只有与上一帧相比发生变化的附件所在区域需要清除并重绘
+    bool poseChanged = false;
+    SpineRect damage;
+    {
+        SPINE_TRACE_SCOPE("Render.damage", instanceId_);
+        damage = ComputeDamageRect(&poseChanged);
+    }
+    ReportMemoryLocked();
+    renderContext_->damageRect = damage;
+    
+    uint64_t pixelsTouched = damage.IsEmpty() ? 0 : static_cast<uint64_t>(damage.right - damage.left) *
+                                                    static_cast<uint64_t>(damage.bottom - damage.top);
+    renderStats_.frameCount++;
+    renderStats_.lastPixelsTouched = pixelsTouched;
+    renderStats_.totalPixelsTouched += pixelsTouched;
+    renderStats_.lastDamage = damage;
+    
+    if (damage.IsEmpty()) {
+        // 画面没有变化，无需重绘
+        return;
+    }
+    
+    // 姿态与上一帧相同却需要重绘（暂停期间表面重建、改变着色等整帧损坏）时，从缓存位图贴回损坏区域；
+    // 暂停不会使位图失效，重复的整帧重绘只需贴图
+    if (poseChanged) {
+        SpineBitmapCache::getInstance().Invalidate(this);
+    } else if (RenderFromBitmapCache(damage)) {
+        return;
+    }
+    
     // 暂时注释掉 Spine 4.2 + Skia 渲染实现
     /*
-    if (renderContext_ && renderContext_->canvas && skeleton_) {
+    if (renderContext_->canvas && skeleton_) {
         // 保存当前 Canvas 状态
         renderContext_->canvas->save();
         
+        // 只清除并重绘损坏区域
+        {
+            SPINE_TRACE_SCOPE("Render.clip", instanceId_);
+            renderContext_->canvas->clipRect(SkRect::MakeLTRB(damage.left, damage.top, damage.right, damage.bottom));
+            renderContext_->canvas->clear(SK_ColorTRANSPARENT);
+        }
+        
         // 应用变换矩阵
         SkMatrix matrix;
         matrix.setScale(renderContext_->scale, renderContext_->scale);
         matrix.postTranslate(renderContext_->viewWidth * 0.5f, renderContext_->viewHeight * 0.5f);
         renderContext_->canvas->concat(matrix);
         
-        // 渲染骨骼
-        RenderSkeleton();
+        // 渲染骨骼（顶点颜色乘以实例着色）
+        {
+            SPINE_TRACE_SCOPE("Render.draw", instanceId_);
+            RenderSkeleton(worldVertices_, renderContext_->tintR, renderContext_->tintG,
+                           renderContext_->tintB, renderContext_->tintA);
+        }
         
         // 恢复 Canvas 状态
         renderContext_->canvas->restore();
     }
     */
+    
+    // 暂时注释掉表面提交：只提交损坏区域
+    /*
+    SPINE_TRACE_SCOPE("Render.submit", instanceId_);
+    Region::Rect rect{static_cast<int32_t>(damage.left), static_cast<int32_t>(damage.top),
+                      static_cast<uint32_t>(damage.right - damage.left), static_cast<uint32_t>(damage.bottom - damage.top)};
+    Region region{&rect, 1};
+    OH_NativeWindow_NativeWindowFlushBuffer(renderContext_->nativeWindow, renderContext_->buffer, -1, region);
+    */
+}
+
+SpineRect SpineManager::GetDamageRect() const {
+    std::lock_guard<std::mutex> lock(dataMutex_);
+    return renderContext_ ? renderContext_->damageRect : SpineRect();
+}
+
+SpineRenderStats SpineManager::GetRenderStats() const {
+    std::lock_guard<std::mutex> lock(dataMutex_);
+    return renderStats_;
+}
+
+SpineMemoryUsage SpineManager::GetMemoryUsage() const {
+    std::lock_guard<std::mutex> lock(dataMutex_);
+    
+    SpineMemoryUsage usage = reportedMemory_;
+    usage[SpineMemoryCategory::kBitmapCache] = SpineBitmapCache::getInstance().GetBytes(this);
+    return usage;
+}
+
+void SpineManager::SetParallelSkinningThreshold(uint32_t vertexCount) {
+    g_parallelSkinningThreshold.store(vertexCount, std::memory_order_relaxed);
+}
+
+uint32_t SpineManager::GetParallelSkinningThreshold() {
+    return g_parallelSkinningThreshold.load(std::memory_order_relaxed);
 }
 
 // ==================== 事件系统 ====================
@@ -451,7 +1165,67 @@ void SpineManager::SetGlobalEventCallback(void (*callback)(int32_t, const SpineA
     callbackInstanceId_ = instanceId;
 }
 
-void SpineManager::TriggerEvent(const SpineAnimationEvent& event) {
+void SpineManager::SetEventBuffer(std::shared_ptr<SpineEventBuffer> buffer) {
+    std::lock_guard<std::mutex> lock(dataMutex_);
+    eventBuffer_ = std::move(buffer);
+}
+
+void SpineManager::SetEventFilter(uint32_t typeMask, const std::vector<string>& eventNames) {
+    std::lock_guard<std::mutex> lock(dataMutex_);
+    eventTypeMask_ = typeMask & kSpineEventMaskAll;
+    eventNameFilter_ = eventNames;
+    std::sort(eventNameFilter_.begin(), eventNameFilter_.end());
+    eventNameFilter_.erase(std::unique(eventNameFilter_.begin(), eventNameFilter_.end()), eventNameFilter_.end());
+}
+
+SpineEventStats SpineManager::GetEventStats() const {
+    std::lock_guard<std::mutex> lock(dataMutex_);
+    return eventStats_;
+}
+
+void SpineManager::TriggerEvent(SpineEventType type, int32_t trackIndex, const char* animation,
+                                const SpineEventDataView* eventView) {
+    // 没有回调时直接丢弃，不计入统计
+    if (!eventCallback_ && !globalEventCallback_) {
+        return;
+    }
+    // 未订阅的事件直接丢弃，不分配任何对象
+    if (!AcceptsEvent(type, eventView ? eventView->name : nullptr)) {
+        eventStats_.filtered++;
+        return;
+    }
+    
+    // 合并投递时只写入事件缓冲，由 flushEvents 统一交给 ArkTS；
+    // 缓冲已满的事件只计入批次的丢弃数，不再逐个回调，避免与批次乱序
+    int32_t instanceId = instanceId_.load(std::memory_order_relaxed);
+    if (instanceId >= 0 && eventBuffer_) {
+        SpineEventAppendResult result = eventBuffer_->Append(instanceId, type, trackIndex, animation, eventView);
+        if (result == SpineEventAppendResult::kAppended) {
+            eventStats_.delivered++;
+        }
+        if (result != SpineEventAppendResult::kDisabled) {
+            return;
+        }
+    }
+    eventStats_.delivered++;
+    
+    SpineEventData eventData;
+    SpineAnimationEvent event;
+    event.type = type;
+    event.trackIndex = trackIndex;
+    event.animation = animation ? animation : "";
+    event.eventData = nullptr;
+    if (eventView) {
+        eventData.name = eventView->name ? eventView->name : "";
+        eventData.intValue = eventView->intValue;
+        eventData.floatValue = eventView->floatValue;
+        eventData.stringValue = eventView->stringValue ? eventView->stringValue : "";
+        eventData.time = eventView->time;
+        eventData.balance = eventView->balance;
+        eventData.volume = eventView->volume;
+        event.eventData = &eventData;
+    }
+    
     // 先调用本地回调
     if (eventCallback_) {
         eventCallback_(event);
@@ -471,6 +1245,64 @@ void SpineManager::Cleanup() {
     // 清理渲染资源
     CleanupRenderResources();
     
+    ReleaseStateLocked();
+}
+
+void SpineManager::Reset() {
+    std::lock_guard<std::mutex> lock(dataMutex_);
+    
+    // 清空轨道、释放数据和回调；顶点等缓冲只清空内容，保留容量供下一次使用
+    CleanupRenderResources();
+    ReleaseStateLocked();
+    
+    // 恢复渲染上下文的默认设置
+    if (renderContext_) {
+        renderContext_->viewWidth = 0;
+        renderContext_->viewHeight = 0;
+        renderContext_->scale = 1.0f;
+        renderContext_->premultipliedAlpha = true;
+        renderContext_->tintR = 1.0f;
+        renderContext_->tintG = 1.0f;
+        renderContext_->tintB = 1.0f;
+        renderContext_->tintA = 1.0f;
+        renderContext_->damageRect = SpineRect();
+    }
+    renderStats_ = SpineRenderStats();
+    instanceId_ = -1;
+    schedulePriority_ = 0;
+    // 事件缓冲属于上一个环境，池中等待期间不再持有；复用时 RegisterInstance 重新设置
+    eventBuffer_.reset();
+}
+
+void SpineManager::SetSurfaceId(const string& surfaceId) {
+    std::lock_guard<std::mutex> lock(dataMutex_);
+    
+    if (!renderContext_) {
+        return;
+    }
+    
+    CleanupRenderResources();
+    renderContext_->surfaceId = surfaceId;
+    InitializeRenderResources();
+    fullDamage_ = true;
+}
+
+// ==================== 私有方法实现 ====================
+
+void SpineManager::ReleaseStateLocked() {
+    // 清空轨道
+    /*
+    if (animationState_) {
+        animationState_->clearTracks();
+    }
+    */
+    
+    // 离开姿态共享组
+    LeavePoseGroupLocked();
+    
+    // 释放缓存位图
+    SpineBitmapCache::getInstance().Release(this);
+    
     // 暂时注释掉 Spine 4.2 资源清理
     /*
     if (animationState_) {
@@ -488,6 +1320,9 @@ void SpineManager::Cleanup() {
         skeleton_ = nullptr;
     }
     
+    // 量化数据引用骨骼数据中的时间轴，先于骨骼数据释放
+    quantizedAnimations_.clear();
+    
     if (skeletonData_) {
         delete skeletonData_;
         skeletonData_ = nullptr;
@@ -502,6 +1337,11 @@ void SpineManager::Cleanup() {
         delete atlas_;
         atlas_ = nullptr;
     }
+    
+    if (containerTextureLoader_) {
+        delete containerTextureLoader_;
+        containerTextureLoader_ = nullptr;
+    }
     */
     
     // 清理状态
@@ -513,14 +1353,39 @@ void SpineManager::Cleanup() {
     eventCallback_ = nullptr;
     globalEventCallback_ = nullptr;
     callbackInstanceId_ = -1;
+    eventTypeMask_ = kSpineEventMaskAll;
+    eventNameFilter_.clear();
+    eventStats_ = SpineEventStats();
     
     // 清理数据
     availableAnimations_.clear();
     availableSkins_.clear();
+    spineDataPath_.clear();
+    currentSkin_.clear();
+    atlasContainer_.reset();
+    regionIndex_.reset();
+    atlasVariants_.clear();
+    atlasVariant_ = 0;
+    atlasVariantLoad_.reset();
+    animationIndex_.reset();
+    animationDecoded_.clear();
+    pendingMixes_.clear();
+    boundsTables_.reset();
+    visibleRect_ = SpineRect();
+    hasVisibleRect_ = false;
+    worldVertices_.clear();
+    drawRanges_.clear();
+    boneTransforms_.clear();
+    packedMeshes_.clear();
+    packedMeshBytes_ = 0;
+    skeletonDataBytes_ = 0;
+    lastSlotStates_.clear();
+    fullDamage_ = true;
+    poseSignature_ = 0;
+    trackTime_ = 0.0;
+    ReportMemoryLocked();
 }
 
-// ==================== 私有方法实现 ====================
-
 bool SpineManager::InitializeRenderResources() {
     if (!renderContext_) {
         return false;
@@ -560,4 +1425,533 @@ void SpineManager::CreateDefaultData() {
     
     availableSkins_.clear();
     availableSkins_.push_back("default");
-} 
\ No newline at end of file
+}
+
+void SpineManager::MarkStateChanged(const string& token) {
+    // 状态变化后缓存位图不再代表当前画面
+    SpineBitmapCache::getInstance().Invalidate(this);
+    
+    // FNV-1a，在上一次签名的基础上累加；同时计入指令下达时的轨道时间（微秒），
+    // 相同指令在不同时刻下达的实例姿态不同
+    const string entry = token + "@" + std::to_string(std::llround(trackTime_ * 1e6));
+    uint64_t hash = poseSignature_ ^ 0xcbf29ce484222325ULL;
+    for (unsigned char c : entry) {
+        hash ^= c;
+        hash *= 0x100000001b3ULL;
+    }
+    poseSignature_ = hash;
+    
+    // 只登记不判断，是否离组在下一次 Update 或 Render 时按多数决定
+    if (poseGroup_) {
+        poseGroup_->ReportSignature(this, poseSignature_);
+    }
+}
+
+void SpineManager::SyncPoseGroupLocked() {
+    if (poseGroup_ && !poseGroup_->Sync(this, poseSignature_, trackTime_)) {
+        LeavePoseGroupLocked();
+    }
+}
+
+void SpineManager::LeavePoseGroupLocked() {
+    if (!poseGroup_) {
+        return;
+    }
+    
+    poseGroup_->RemoveMember(this);
+    poseGroup_.reset();
+    poseVersion_ = 0;
+}
+
+bool SpineManager::AcceptsEvent(SpineEventType type, const char* eventName) const {
+    if ((eventTypeMask_ & SpineEventTypeBit(type)) == 0) {
+        return false;
+    }
+    if (type != SpineEventType::kEvent || eventNameFilter_.empty()) {
+        return true;
+    }
+    if (!eventName) {
+        return false;
+    }
+    
+    auto it = std::lower_bound(eventNameFilter_.begin(), eventNameFilter_.end(), eventName,
+                               [](const string& name, const char* value) { return std::strcmp(name.c_str(), value) < 0; });
+    return it != eventNameFilter_.end() && std::strcmp(it->c_str(), eventName) == 0;
+}
+
+bool SpineManager::IsPoseFollower() const {
+    return poseGroup_ && !poseGroup_->IsLeader(this);
+}
+
+bool SpineManager::RenderFromBitmapCache(const SpineRect& damage) {
+    if (!renderContext_) {
+        return false;
+    }
+    
+    SpineBitmapCache& cache = SpineBitmapCache::getInstance();
+    std::shared_ptr<SpineBitmap> bitmap = cache.Acquire(this, renderContext_->viewWidth, renderContext_->viewHeight);
+    if (!bitmap) {
+        // 超出预算或视图尚未确定尺寸，直接绘制
+        return false;
+    }
+    
+    if (!bitmap->valid) {
+        // 暂时注释掉 Skia 离屏光栅化
+        /*
+        SkImageInfo info = SkImageInfo::MakeN32Premul(bitmap->width, bitmap->height);
+        auto offscreen = SkSurface::MakeRasterDirect(info, bitmap->pixels.data(), bitmap->width * sizeof(uint32_t));
+        SkCanvas* canvas = offscreen->getCanvas();
+        canvas->clear(SK_ColorTRANSPARENT);
+        
+        SkMatrix matrix;
+        matrix.setScale(renderContext_->scale, renderContext_->scale);
+        matrix.postTranslate(renderContext_->viewWidth * 0.5f, renderContext_->viewHeight * 0.5f);
+        canvas->concat(matrix);
+        RenderSkeleton(canvas, worldVertices_, renderContext_->tintR, renderContext_->tintG,
+                       renderContext_->tintB, renderContext_->tintA);
+        bitmap->image = offscreen->makeImageSnapshot();
+        */
+        bitmap->valid = true;
+    }
+    
+    // 只覆盖损坏区域，按位图尺寸裁剪
+    const SpineRect rect{std::max(0.0f, damage.left), std::max(0.0f, damage.top),
+                         std::min(static_cast<float>(bitmap->width), damage.right),
+                         std::min(static_cast<float>(bitmap->height), damage.bottom)};
+    if (rect.IsEmpty()) {
+        return true;
+    }
+    renderStats_.cachedFrames++;
+    
+    // 暂时注释掉 Skia 贴图
+    /*
+    if (renderContext_->canvas) {
+        SkRect skRect = SkRect::MakeLTRB(rect.left, rect.top, rect.right, rect.bottom);
+        SkPaint paint;
+        paint.setBlendMode(SkBlendMode::kSrc);
+        renderContext_->canvas->drawImageRect(bitmap->image, skRect, skRect, SkSamplingOptions(), &paint,
+                                              SkCanvas::kStrict_SrcRectConstraint);
+    }
+    */
+    return true;
+}
+
+SpineRect SpineManager::ComputeDamageRect(bool* poseChanged) {
+    const float viewWidth = static_cast<float>(renderContext_->viewWidth);
+    const float viewHeight = static_cast<float>(renderContext_->viewHeight);
+    const float scale = renderContext_->scale;
+    const float originX = viewWidth * 0.5f;
+    const float originY = viewHeight * 0.5f;
+    
+    // 收集本帧各附件的绘制状态（包围盒已变换到视图坐标，与渲染矩阵一致）
+    std::vector<SlotDrawState> current;
+    current.reserve(drawRanges_.size());
+    for (const SpineDrawRange& range : drawRanges_) {
+        SlotDrawState state{range.slotIndex, range.attachmentKey, 0, SpineRect()};
+        size_t begin = range.vertexOffset;
+        size_t count = static_cast<size_t>(range.vertexCount) * 2;
+        if (begin + count > worldVertices_.size() || count == 0) {
+            current.push_back(state);
+            continue;
+        }
+        
+        const float* vertices = worldVertices_.data() + begin;
+        state.vertexHash = HashVertices(vertices, count);
+        float minX = vertices[0], maxX = vertices[0];
+        float minY = vertices[1], maxY = vertices[1];
+        for (size_t i = 2; i < count; i += 2) {
+            minX = std::min(minX, vertices[i]);
+            maxX = std::max(maxX, vertices[i]);
+            minY = std::min(minY, vertices[i + 1]);
+            maxY = std::max(maxY, vertices[i + 1]);
+        }
+        state.bounds = SpineRect{minX * scale + originX, minY * scale + originY,
+                                 maxX * scale + originX, maxY * scale + originY};
+        current.push_back(state);
+    }
+    
+    SpineRect damage;
+    bool changed = current.size() != lastSlotStates_.size();
+    if (!changed) {
+        for (size_t i = 0; i < current.size(); ++i) {
+            const SlotDrawState& now = current[i];
+            const SlotDrawState& last = lastSlotStates_[i];
+            if (now.slotIndex != last.slotIndex) {
+                // 绘制顺序变化会影响重叠区域，两帧全部附件都需要重绘
+                changed = true;
+                break;
+            }
+            if (now.attachmentKey != last.attachmentKey || now.vertexHash != last.vertexHash) {
+                damage.Union(last.bounds);
+                damage.Union(now.bounds);
+            }
+        }
+    }
+    if (changed) {
+        damage = SpineRect();
+        for (const SlotDrawState& state : lastSlotStates_) {
+            damage.Union(state.bounds);
+        }
+        for (const SlotDrawState& state : current) {
+            damage.Union(state.bounds);
+        }
+    }
+    *poseChanged = changed || !damage.IsEmpty();
+    
+    if (fullDamage_) {
+        damage = SpineRect{0.0f, 0.0f, viewWidth, viewHeight};
+        fullDamage_ = false;
+    }
+    lastSlotStates_.swap(current);
+    
+    if (damage.IsEmpty()) {
+        return damage;
+    }
+    
+    // 外扩 1 像素覆盖抗锯齿边缘，对齐到整数像素并限制在视图内
+    damage.left = std::max(0.0f, std::floor(damage.left - 1.0f));
+    damage.top = std::max(0.0f, std::floor(damage.top - 1.0f));
+    damage.right = std::min(viewWidth, std::ceil(damage.right + 1.0f));
+    damage.bottom = std::min(viewHeight, std::ceil(damage.bottom + 1.0f));
+    return damage.IsEmpty() ? SpineRect() : damage;
+}
+
+uint64_t SpineManager::HashVertices(const float* vertices, size_t count) {
+    // FNV-1a，按位比较顶点是否变化
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (size_t i = 0; i < count; ++i) {
+        uint32_t bits;
+        std::memcpy(&bits, &vertices[i], sizeof(bits));
+        hash ^= bits;
+        hash *= 0x100000001b3ULL;
+    }
+    return hash ^ count;
+}
+
+void SpineManager::BuildWorldVertices(std::vector<float>& worldVertices, std::vector<SpineDrawRange>& drawRanges) {
+    SPINE_TRACE_SCOPE("Update.vertexBuild", instanceId_);
+    worldVertices.clear();
+    drawRanges.clear();
+    
+    // 暂时注释掉 Spine 4.2 实现
+    /*
+    if (!skeleton_) {
+        return;
+    }
+    
+    // 骨骼世界变换快照，内核按下标读取
+    spine::Vector<spine::Bone*>& bones = skeleton_->getBones();
+    boneTransforms_.resize(bones.size());
+    for (size_t i = 0; i < bones.size(); ++i) {
+        spine::Bone* bone = bones[i];
+        boneTransforms_[i] = {bone->getA(), bone->getB(), bone->getC(), bone->getD(),
+                              bone->getWorldX(), bone->getWorldY()};
+    }
+    
+    spine::Vector<spine::Slot*>& drawOrder = skeleton_->getDrawOrder();
+    for (size_t i = 0; i < drawOrder.size(); ++i) {
+        spine::Slot* slot = drawOrder[i];
+        spine::Attachment* attachment = slot->getAttachment();
+        if (!attachment || !slot->getBone().isActive()) {
+            continue;
+        }
+        
+        SpineDrawRange range;
+        range.slotIndex = slot->getData().getIndex();
+        range.vertexOffset = static_cast<uint32_t>(worldVertices.size());
+        
+        const spine::Color& color = slot->getColor();
+        uint64_t key = reinterpret_cast<uintptr_t>(attachment);
+        key = key * 31 + static_cast<uint64_t>(color.r * 255.0f);
+        key = key * 31 + static_cast<uint64_t>(color.g * 255.0f);
+        key = key * 31 + static_cast<uint64_t>(color.b * 255.0f);
+        key = key * 31 + static_cast<uint64_t>(color.a * 255.0f);
+        range.attachmentKey = key;
+        
+        if (attachment->getRTTI().isExactly(spine::RegionAttachment::rtti)) {
+            auto* region = static_cast<spine::RegionAttachment*>(attachment);
+            spine::Bone& bone = slot->getBone();
+            const SpineVertexKernels::BoneTransform& transform = boneTransforms_[bone.getData().getIndex()];
+            worldVertices.resize(range.vertexOffset + 8);
+            SpineVertexKernels::TransformVertices(transform, region->getOffset().buffer(), 4,
+                                                  worldVertices.data() + range.vertexOffset, 2);
+            range.vertexCount = 4;
+        } else if (attachment->getRTTI().isExactly(spine::MeshAttachment::rtti)) {
+            auto* mesh = static_cast<spine::MeshAttachment*>(attachment);
+            size_t vertexCount = mesh->getWorldVerticesLength() / 2;
+            spine::Vector<float>& deform = slot->getDeform();
+            worldVertices.resize(range.vertexOffset + vertexCount * 2);
+            float* out = worldVertices.data() + range.vertexOffset;
+            
+            if (mesh->getBones().size() == 0) {
+                // 非加权网格：变形数组直接存放局部坐标
+                spine::Bone& bone = slot->getBone();
+                const float* local = deform.size() > 0 ? deform.buffer() : mesh->getVertices().buffer();
+                ComputeMeshVertices(boneTransforms_[bone.getData().getIndex()], local, nullptr, vertexCount,
+                                    nullptr, out);
+            } else {
+                // 加权网格：首次遇到时打包为固定 4 影响格式，超过 4 个影响的网格走运行时通用路径
+                auto it = packedMeshes_.find(mesh);
+                if (it == packedMeshes_.end()) {
+                    std::vector<SpineVertexKernels::SkinnedVertex4> packed;
+                    SpineVertexKernels::PackWeightedVertices(mesh->getBones().buffer(), mesh->getBones().size(),
+                                                             mesh->getVertices().buffer(),
+                                                             mesh->getVertices().size(), &packed);
+                    packedMeshBytes_ += packed.capacity() * sizeof(SpineVertexKernels::SkinnedVertex4);
+                    it = packedMeshes_.emplace(mesh, std::move(packed)).first;
+                }
+                
+                if (!it->second.empty()) {
+                    ComputeMeshVertices(SpineVertexKernels::BoneTransform(), nullptr, it->second.data(),
+                                        it->second.size(), deform.size() > 0 ? deform.buffer() : nullptr, out);
+                } else {
+                    mesh->computeWorldVertices(*slot, 0, mesh->getWorldVerticesLength(), out, 0, 2);
+                }
+            }
+            range.vertexCount = static_cast<uint32_t>(vertexCount);
+        } else {
+            continue;
+        }
+        
+        drawRanges.push_back(range);
+    }
+    */
+}
+
+void SpineManager::ComputeMeshVertices(const SpineVertexKernels::BoneTransform& bone, const float* local,
+                                       const SpineVertexKernels::SkinnedVertex4* packed, size_t vertexCount,
+                                       const float* deform, float* out) const {
+    auto compute = [&](size_t begin, size_t end) {
+        SPINE_TRACE_SCOPE("Update.skin", instanceId_);
+        if (packed) {
+            SpineVertexKernels::SkinVertices4(boneTransforms_.data(), packed + begin, end - begin, deform,
+                                              out + begin * 2, 2);
+        } else {
+            SpineVertexKernels::TransformVertices(bone, local + begin * 2, end - begin, out + begin * 2, 2);
+        }
+    };
+    
+    uint32_t threshold = g_parallelSkinningThreshold.load(std::memory_order_relaxed);
+    if (threshold == 0 || vertexCount < threshold || vertexCount <= kParallelSkinningGrain) {
+        compute(0, vertexCount);
+        return;
+    }
+    
+    SpineWorkerPool::getInstance().ParallelFor(vertexCount, kParallelSkinningGrain, compute);
+}
+
+void SpineManager::ReportMemoryLocked() {
+    SpineMemoryUsage usage;
+    usage[SpineMemoryCategory::kSkeletonData] = skeletonDataBytes_;
+    usage[SpineMemoryCategory::kPose] = boneTransforms_.capacity() * sizeof(SpineVertexKernels::BoneTransform) +
+                                        packedMeshBytes_ + lastSlotStates_.capacity() * sizeof(SlotDrawState);
+    usage[SpineMemoryCategory::kRenderBuffer] = worldVertices_.capacity() * sizeof(float) +
+                                                drawRanges_.capacity() * sizeof(SpineDrawRange);
+    
+    // 位图由位图缓存统计
+    SpineMemoryTracker::getInstance().Update(reportedMemory_, usage);
+    reportedMemory_ = usage;
+}
+
+void SpineManager::PublishHitBoundsLocked() {
+    int32_t instanceId = instanceId_.load(std::memory_order_relaxed);
+    SpineSpatialIndex& index = SpineSpatialIndex::getInstance();
+    if (instanceId < 0 || !index.IsTracked(instanceId)) {
+        return;
+    }
+    
+    // 与渲染矩阵一致：骨骼坐标缩放后以视图中心为原点
+    const float scale = renderContext_->scale;
+    const float originX = static_cast<float>(renderContext_->viewWidth) * 0.5f;
+    const float originY = static_cast<float>(renderContext_->viewHeight) * 0.5f;
+    
+    SpineRect bounds;
+    if (worldVertices_.size() >= 2) {
+        float minX = worldVertices_[0], maxX = worldVertices_[0];
+        float minY = worldVertices_[1], maxY = worldVertices_[1];
+        for (size_t i = 2; i + 1 < worldVertices_.size(); i += 2) {
+            minX = std::min(minX, worldVertices_[i]);
+            maxX = std::max(maxX, worldVertices_[i]);
+            minY = std::min(minY, worldVertices_[i + 1]);
+            maxY = std::max(maxY, worldVertices_[i + 1]);
+        }
+        bounds = SpineRect{minX * scale + originX, minY * scale + originY,
+                           maxX * scale + originX, maxY * scale + originY};
+    }
+    
+    // 包围盒附件只有自己计算姿态的实例才有，跟随者只发布实例包围盒
+    size_t shapeCount = 0;
+    // 暂时注释掉 Spine 4.2 实现
+    /*
+    if (!IsPoseFollower() && skeleton_) {
+        skeletonBounds_.update(*skeleton_, true);
+        spine::Vector<spine::BoundingBoxAttachment*>& boxes = skeletonBounds_.getBoundingBoxes();
+        spine::Vector<spine::Polygon*>& polygons = skeletonBounds_.getPolygons();
+        for (size_t i = 0; i < boxes.size(); ++i) {
+            if (shapeCount == hitShapes_.size()) {
+                hitShapes_.emplace_back();
+            }
+            SpineHitShape& shape = hitShapes_[shapeCount++];
+            shape.name = boxes[i]->getName().buffer();
+            shape.polygon.clear();
+            
+            spine::Polygon* polygon = polygons[i];
+            float minX = 0.0f, minY = 0.0f, maxX = 0.0f, maxY = 0.0f;
+            for (int j = 0; j + 1 < polygon->_count; j += 2) {
+                float x = polygon->_vertices[j] * scale + originX;
+                float y = polygon->_vertices[j + 1] * scale + originY;
+                shape.polygon.push_back(x);
+                shape.polygon.push_back(y);
+                minX = j == 0 ? x : std::min(minX, x);
+                minY = j == 0 ? y : std::min(minY, y);
+                maxX = j == 0 ? x : std::max(maxX, x);
+                maxY = j == 0 ? y : std::max(maxY, y);
+            }
+            shape.bounds = SpineRect{minX, minY, maxX, maxY};
+            bounds.Union(shape.bounds);
+        }
+    }
+    */
+    hitShapes_.resize(shapeCount);
+    index.Publish(instanceId, bounds, hitShapes_);
+}
+
+void SpineManager::SeekQuantizedTimelinesLocked() {
+    // 暂时注释掉 Spine 4.2 实现
+    /*
+    if (quantizedAnimations_.empty() || !animationState_) {
+        return;
+    }
+    
+    // 同一动画可能同时出现在多条轨道或混合中，窗口取所有出现时间的范围
+    std::unordered_map<SpineQuantizedAnimation*, std::pair<float, float>> ranges;
+    spine::Vector<spine::TrackEntry*>& tracks = animationState_->getTracks();
+    for (size_t i = 0; i < tracks.size(); ++i) {
+        for (spine::TrackEntry* entry = tracks[i]; entry; entry = entry->getMixingFrom()) {
+            auto it = quantizedAnimations_.find(entry->getAnimation());
+            if (it == quantizedAnimations_.end()) {
+                continue;
+            }
+            // 与 AnimationState::apply 一致，倒放时从动画末尾计时
+            float time = entry->getAnimationTime();
+            if (entry->getReverse()) {
+                time = entry->getAnimation()->getDuration() - time;
+            }
+            auto range = ranges.emplace(&it->second, std::make_pair(time, time)).first;
+            range->second.first = std::min(range->second.first, time);
+            range->second.second = std::max(range->second.second, time);
+        }
+    }
+    for (auto& range : ranges) {
+        range.first->Seek(range.second.first, range.second.second);
+    }
+    */
+}
+
+bool SpineManager::IsCulledLocked() {
+    // 姿态共享组的领导者为组内所有实例计算姿态，不能按自身视图剔除
+    if (!renderContext_ || poseGroup_) {
+        return false;
+    }
+    const float viewWidth = static_cast<float>(renderContext_->viewWidth);
+    const float viewHeight = static_cast<float>(renderContext_->viewHeight);
+    if (viewWidth <= 0.0f || viewHeight <= 0.0f) {
+        // 尚未布局
+        return false;
+    }
+    
+    SpineRect cullRect{0.0f, 0.0f, viewWidth, viewHeight};
+    if (hasVisibleRect_) {
+        cullRect = SpineRect{std::max(cullRect.left, visibleRect_.left), std::max(cullRect.top, visibleRect_.top),
+                             std::min(cullRect.right, visibleRect_.right), std::min(cullRect.bottom, visibleRect_.bottom)};
+    }
+    if (cullRect.IsEmpty()) {
+        return true;
+    }
+    
+    // 当前轨道时间在各动画包围盒表中的区间之并（骨骼坐标）
+    SpineRect bounds;
+    bool covered = false;
+    // 暂时注释掉 Spine 4.2 实现
+    /*
+    if (!animationState_) {
+        return false;
+    }
+    spine::Vector<spine::TrackEntry*>& tracks = animationState_->getTracks();
+    spine::TrackEntry* active = nullptr;
+    for (size_t i = 0; i < tracks.size(); ++i) {
+        if (!tracks[i]) {
+            continue;
+        }
+        // 多轨叠加时各轨单独采样的包围盒之并不一定保守
+        if (active) {
+            return false;
+        }
+        active = tracks[i];
+    }
+    for (spine::TrackEntry* entry = active; entry; entry = entry->getMixingFrom()) {
+        std::shared_ptr<const SpineBoundsTable> table = AcquireBoundsTableLocked(entry->getAnimation()->getName().buffer());
+        if (!table) {
+            return false;
+        }
+        bounds.Union(table->Lookup(entry->getAnimationTime()));
+        covered = true;
+    }
+    */
+    if (!covered || bounds.IsEmpty()) {
+        return false;
+    }
+    
+    // 与渲染矩阵一致：骨骼坐标缩放后以视图中心为原点
+    const float scale = renderContext_->scale;
+    const float x0 = bounds.left * scale + viewWidth * 0.5f;
+    const float x1 = bounds.right * scale + viewWidth * 0.5f;
+    const float y0 = bounds.top * scale + viewHeight * 0.5f;
+    const float y1 = bounds.bottom * scale + viewHeight * 0.5f;
+    SpineRect viewBounds{std::min(x0, x1), std::min(y0, y1), std::max(x0, x1), std::max(y0, y1)};
+    return !viewBounds.Intersects(cullRect);
+}
+
+std::shared_ptr<const SpineBoundsTable> SpineManager::AcquireBoundsTableLocked(const string& animationName) {
+    if (!boundsTables_) {
+        return nullptr;
+    }
+    
+    const string key = SpineBoundsTableSet::MakeKey(currentSkin_, animationName);
+    std::shared_ptr<const SpineBoundsTable> table = boundsTables_->Find(key);
+    if (table) {
+        return table;
+    }
+    
+    // 暂时注释掉 Spine 4.2 实现
+    /*
+    // 用独立的骨骼采样，不影响本实例的姿态；每份骨骼数据的每个动画只采样一次
+    SPINE_TRACE_SCOPE("Update.sampleBounds", instanceId_);
+    spine::Animation* animation = skeletonData_->findAnimation(animationName.c_str());
+    if (!animation) {
+        return nullptr;
+    }
+    spine::Skeleton scratch(skeletonData_);
+    scratch.setSkin(skeleton_->getSkin());
+    auto quantized = quantizedAnimations_.find(animation);
+    
+    const float duration = animation->getDuration();
+    std::vector<SpineRect> samples(SpineBoundsTable::SampleCount(duration));
+    spine::Vector<float> vertexBuffer;
+    for (size_t i = 0; i < samples.size(); ++i) {
+        float time = SpineBoundsTable::SampleTime(duration, i);
+        if (quantized != quantizedAnimations_.end()) {
+            quantized->second.Seek(time, time);
+        }
+        scratch.setToSetupPose();
+        animation->apply(scratch, time, time, false, nullptr, 1.0f, spine::MixBlend_Setup, spine::MixDirection_In);
+        scratch.updateWorldTransform(spine::Physics_None);
+        
+        float x = 0.0f, y = 0.0f, width = 0.0f, height = 0.0f;
+        scratch.getBounds(x, y, width, height, vertexBuffer);
+        samples[i] = SpineRect{x, y, x + width, y + height};
+    }
+    table = boundsTables_->Insert(key, SpineBoundsTable::Build(duration, samples));
+    */
+    return table;
+}
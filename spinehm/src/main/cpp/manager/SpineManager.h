@@ -15,7 +15,12 @@
 #include <vector>
 #include <memory>
 #include <mutex>
+#include <atomic>
 #include <functional>
+#include <unordered_map>
+#include "common/common.h"
+#include "common/SpineMemoryTracker.h"
+#include "render/SpineVertexKernels.h"
 
 // 暂时注释掉 Spine 4.2 相关头文件
 // #include <spine/spine.h>
@@ -26,9 +31,15 @@
 // #include <spine/AnimationStateData.h>
 
 // 前置声明
-struct SpineAnimationEvent;
-struct SpineLoadOptions;
-struct SpineEventData;
+class SpinePoseGroup;
+class SpineAnimationIndex;
+class SpineAtlasContainer;
+class SpineAtlasVariantLoad;
+class SpineBundle;
+class SpineBoundsTable;
+class SpineBoundsTableSet;
+class SpineEventBuffer;
+class SpineRegionIndex;
 
 using std::string;
 
@@ -50,6 +61,15 @@ struct SpineRenderContext {
     float scale = 1.0f;
     bool premultipliedAlpha = true;
     
+    // 着色（RGBA，姿态共享组的跟随者也使用自己的着色）
+    float tintR = 1.0f;
+    float tintG = 1.0f;
+    float tintB = 1.0f;
+    float tintA = 1.0f;
+    
+    // 本帧的损坏区域，表面提交时只更新该区域
+    SpineRect damageRect;
+    
     SpineRenderContext(const string& surfaceId) : surfaceId(surfaceId) {}
 };
 
@@ -82,6 +102,14 @@ public:
      */
     bool LoadSpineData(const string& spineDataPath, const string& atlasDataPath, const SpineLoadOptions& options);
     
+    /**
+     * 从资源包加载 Spine 数据（骨骼数据、图集和页面都来自同一个 mmap 的 .sbundle 文件）
+     * @param bundlePath .sbundle 文件路径
+     * @param options 加载选项
+     * @return 是否加载成功
+     */
+    bool LoadSpineBundle(const string& bundlePath, const SpineLoadOptions& options);
+    
     /**
      * 获取可用的动画列表
      * @return 动画名称列表
@@ -94,6 +122,12 @@ public:
      */
     std::vector<string> GetSkins() const;
     
+    /**
+     * 获取已加载的骨骼数据路径（资源包为包路径），未加载时为空
+     * 同一路径的实例动画和皮肤名称相同，可作为名称缓存的键
+     */
+    string GetSpineDataPath() const;
+    
     // ==================== 动画控制 ====================
     
     /**
@@ -115,6 +149,13 @@ public:
      */
     bool AddAnimation(int32_t trackIndex, const string& animationName, bool loop, float delay);
     
+    /**
+     * 预先解码动画（延迟解码模式下避免首次播放时解码；其余模式下动画已在加载时解码）
+     * @param animationNames 动画名称列表
+     * @return 是否全部存在
+     */
+    bool PreloadAnimations(const std::vector<string>& animationNames);
+    
     /**
      * 清除指定轨道的动画
      * @param trackIndex 轨道索引
@@ -189,10 +230,61 @@ public:
     
     /**
      * 设置是否预乘Alpha
+     * 未预乘的图集容器切换到容器缓存的另一种页面像素，不重新加载；已预乘的容器始终按预乘处理
      * @param premultipliedAlpha 是否预乘Alpha
      */
     void SetPremultipliedAlpha(bool premultipliedAlpha);
     
+    /**
+     * 设置着色
+     * @param r 红色分量（0~1）
+     * @param g 绿色分量（0~1）
+     * @param b 蓝色分量（0~1）
+     * @param a 透明度（0~1）
+     */
+    void SetTint(float r, float g, float b, float a);
+    
+    /**
+     * 获取视图面积（像素数，供帧调度按可见大小排序）
+     * @return 视图面积，未设置尺寸时为 0
+     */
+    int64_t GetViewArea() const;
+    
+    /**
+     * 设置视图在屏幕上可见的部分（视图坐标），Update 时骨骼包围盒与该区域不相交则跳过姿态计算
+     * 包围盒取自动画包围盒表，只凭轨道时间判断，不需要先计算姿态
+     * @param rect 可见区域，为空表示视图完全不可见
+     */
+    void SetVisibleRect(const SpineRect& rect);
+    
+    /**
+     * 取消可见区域，恢复为整个视图
+     */
+    void ClearVisibleRect();
+    
+    // ==================== 姿态共享 ====================
+    
+    /**
+     * 加入姿态共享组
+     * 第一个加入的实例作为领导者计算姿态和世界顶点，其余实例只应用自身的变换和着色。
+     * 成员的动画指令或轨道时间与组内多数成员不一致后自动离开（偏离的是领导者时由下一个成员接任）；
+     * 暂停本身不改变签名，全部暂停的组保持不变
+     * @param groupId 组ID
+     * @return 是否加入成功（骨骼或动画状态与组不一致时失败）
+     */
+    bool JoinPoseGroup(int32_t groupId);
+    
+    /**
+     * 离开姿态共享组
+     */
+    void LeavePoseGroup();
+    
+    /**
+     * 获取所在的姿态共享组ID
+     * @return 组ID，未加入时返回 -1
+     */
+    int32_t GetPoseGroupId() const;
+    
     // ==================== 渲染循环 ====================
     
     /**
@@ -206,6 +298,47 @@ public:
      */
     void Render();
     
+    /**
+     * 获取上一帧的损坏区域（供表面提交局部更新）
+     * @return 损坏区域，为空表示画面无变化
+     */
+    SpineRect GetDamageRect() const;
+    
+    /**
+     * 获取渲染统计
+     * @return 渲染统计
+     */
+    SpineRenderStats GetRenderStats() const;
+    
+    /**
+     * 获取实例自身占用的内存（不含跨实例共享的图集和姿态共享组）
+     * @return 各类别字节数
+     */
+    SpineMemoryUsage GetMemoryUsage() const;
+    
+    /**
+     * 设置并行蒙皮阈值（所有实例共享）
+     * 顶点数不低于阈值的网格附件按范围拆分到工作线程池，较小的网格在当前线程计算
+     * @param vertexCount 顶点数阈值，0 表示禁用并行
+     */
+    static void SetParallelSkinningThreshold(uint32_t vertexCount);
+    
+    /**
+     * 获取并行蒙皮阈值
+     */
+    static uint32_t GetParallelSkinningThreshold();
+    
+    /**
+     * 设置调度优先级，帧预算不足时优先级高的实例先更新
+     * @param priority 优先级，默认 0，越大越优先
+     */
+    void SetSchedulePriority(int32_t priority) { schedulePriority_ = priority; }
+    
+    /**
+     * 获取调度优先级
+     */
+    int32_t GetSchedulePriority() const { return schedulePriority_; }
+    
     // ==================== 事件系统 ====================
     
     /**
@@ -222,10 +355,35 @@ public:
     void SetGlobalEventCallback(void (*callback)(int32_t, const SpineAnimationEvent&), int32_t instanceId);
     
     /**
-     * 触发事件
-     * @param event 事件数据
+     * 设置事件订阅
+     * 未订阅的事件在 TriggerEvent 中直接丢弃，不构造事件对象
+     * @param typeMask 事件类型掩码（SpineEventTypeBit 的组合）
+     * @param eventNames 用户事件名称白名单，为空表示不限制（只作用于 kEvent）
+     */
+    void SetEventFilter(uint32_t typeMask, const std::vector<string>& eventNames);
+    
+    /**
+     * 设置合并投递使用的事件缓冲（实例所属 napi_env 的缓冲，注册实例时设置）
+     * @param buffer 事件缓冲，为空表示始终逐个回调
+     */
+    void SetEventBuffer(std::shared_ptr<SpineEventBuffer> buffer);
+    
+    /**
+     * 获取事件投递统计
+     * @return 已投递和已过滤的事件数
      */
-    void TriggerEvent(const SpineAnimationEvent& event);
+    SpineEventStats GetEventStats() const;
+    
+    /**
+     * 触发事件（由动画状态监听器在 Update 中调用）
+     * 先按订阅过滤，通过后才构造事件对象并调用回调；没有回调时直接返回，不计入统计
+     * @param type 事件类型
+     * @param trackIndex 轨道索引
+     * @param animation 动画名称
+     * @param eventView 用户事件数据，非 kEvent 时为 nullptr
+     */
+    void TriggerEvent(SpineEventType type, int32_t trackIndex, const char* animation,
+                      const SpineEventDataView* eventView);
     
     // ==================== 生命周期 ====================
     
@@ -234,11 +392,35 @@ public:
      */
     void Cleanup();
     
+    /**
+     * 重置为干净状态以便复用（实例池回收时调用）
+     * 清空轨道、释放数据、丢弃回调，保留已分配的缓冲
+     */
+    void Reset();
+    
+    /**
+     * 重新绑定渲染表面（从实例池取出时调用）
+     * @param surfaceId 渲染表面ID
+     */
+    void SetSurfaceId(const string& surfaceId);
+    
     /**
      * 获取表面ID
      * @return 表面ID
      */
     const string& GetSurfaceId() const { return renderContext_->surfaceId; }
+    
+    /**
+     * 设置注册表分配的实例ID（用于追踪等诊断信息）
+     * @param instanceId 实例ID，-1 表示未注册
+     */
+    void SetInstanceId(int32_t instanceId) { instanceId_ = instanceId; }
+    
+    /**
+     * 获取实例ID
+     * @return 实例ID，未注册时返回 -1
+     */
+    int32_t GetInstanceId() const { return instanceId_; }
 
 private:
     // ==================== 私有成员变量 ====================
@@ -253,20 +435,111 @@ private:
     // spine::Skeleton* skeleton_;
     // spine::AnimationState* animationState_;
     // spine::AnimationStateData* animationStateData_;
+    // spine::TextureLoader* containerTextureLoader_;  // 从图集容器提供页面纹理
+    // spine::SkeletonBounds skeletonBounds_;           // 包围盒附件的世界多边形
+    // std::unordered_map<spine::Animation*, SpineQuantizedAnimation> quantizedAnimations_;  // 量化的关键帧
+    
+    // 注册表分配的实例ID
+    std::atomic<int32_t> instanceId_;
+    
+    // 帧调度优先级
+    std::atomic<int32_t> schedulePriority_;
     
     // 基本状态
     bool isLoaded_;
     bool isPaused_;
     float timeScale_;
     
+    // 动画状态已推进的时间（秒，已乘时间缩放），加载后从 0 开始
+    double trackTime_;
+    
     // 动画数据（临时用 string 列表代替）
     std::vector<string> availableAnimations_;
     std::vector<string> availableSkins_;
     
+    // 当前数据路径和皮肤
+    string spineDataPath_;
+    string currentSkin_;
+    
+    // 预处理的图集容器（通过资源缓存在实例间共享）
+    std::shared_ptr<SpineAtlasContainer> atlasContainer_;
+    
+    // 图集区域名称索引（通过资源缓存在同一图集的实例间共享），附件加载时按名称解析区域
+    std::shared_ptr<const SpineRegionIndex> regionIndex_;
+    
+    // 图集变体（第 0 个为原图集）、当前使用的变体，以及正在后台准备的切换
+    std::vector<SpineAtlasVariant> atlasVariants_;
+    size_t atlasVariant_;
+    std::shared_ptr<SpineAtlasVariantLoad> atlasVariantLoad_;
+    
+    // 动画字节范围索引（延迟解码时使用，通过资源缓存在同一骨骼数据的实例间共享）及各动画是否已解码
+    std::shared_ptr<const SpineAnimationIndex> animationIndex_;
+    std::vector<bool> animationDecoded_;
+    
+    // 延迟解码时两端尚未都解码的动画混合（动画下标），两端解码后设置
+    struct PendingMix {
+        int32_t from;
+        int32_t to;
+        float duration;
+    };
+    std::vector<PendingMix> pendingMixes_;
+    
+    // 加载选项（延迟解码的动画按同样的选项批量采样、量化）
+    SpineLoadOptions loadOptions_;
+    
+    // 动画包围盒表（通过资源缓存在同一骨骼数据的实例间共享）
+    std::shared_ptr<SpineBoundsTableSet> boundsTables_;
+    
+    // 视图在屏幕上可见的部分（视图坐标），未设置时为整个视图
+    SpineRect visibleRect_;
+    bool hasVisibleRect_;
+    
+    // 世界顶点缓冲（渲染批次）及各附件的顶点范围
+    std::vector<float> worldVertices_;
+    std::vector<SpineDrawRange> drawRanges_;
+    
+    // 本帧骨骼世界变换快照，以及按网格附件缓存的 4 影响打包顶点（无法打包的网格为空，走通用路径）
+    std::vector<SpineVertexKernels::BoneTransform> boneTransforms_;
+    std::unordered_map<const void*, std::vector<SpineVertexKernels::SkinnedVertex4>> packedMeshes_;
+    size_t packedMeshBytes_;
+    
+    // 骨骼数据、骨骼和动画状态占用的字节数（加载时测得）
+    size_t skeletonDataBytes_;
+    
+    // 已计入全局内存统计的用量
+    SpineMemoryUsage reportedMemory_;
+    
+    // 姿态共享
+    std::shared_ptr<SpinePoseGroup> poseGroup_;
+    uint64_t poseSignature_;
+    uint64_t poseVersion_;
+    
+    // 上一帧各附件的绘制状态，用于计算损坏区域
+    struct SlotDrawState {
+        int32_t slotIndex;
+        uint64_t attachmentKey;
+        uint64_t vertexHash;
+        SpineRect bounds;
+    };
+    std::vector<SlotDrawState> lastSlotStates_;
+    bool fullDamage_;
+    
+    // 发布到空间索引的包围盒附件（视图坐标），保留容量逐帧复用
+    std::vector<SpineHitShape> hitShapes_;
+    
+    // 渲染统计
+    SpineRenderStats renderStats_;
+    
     // 事件回调
     void (*eventCallback_)(const SpineAnimationEvent&);
     void (*globalEventCallback_)(int32_t, const SpineAnimationEvent&);
     int32_t callbackInstanceId_;
+    std::shared_ptr<SpineEventBuffer> eventBuffer_;
+    
+    // 事件订阅（白名单已排序，按 strcmp 二分查找）
+    uint32_t eventTypeMask_;
+    std::vector<string> eventNameFilter_;
+    SpineEventStats eventStats_;
     
     // 线程安全
     mutable std::mutex dataMutex_;
@@ -279,6 +552,36 @@ private:
      */
     bool InitializeRenderResources();
     
+    /**
+     * 加载骨骼数据和图集（调用方需持有 dataMutex_）
+     * @param spineDataPath 骨骼数据路径（资源包为包路径）
+     * @param atlasDataPath 图集路径（资源包为包路径）
+     * @param atlasContainer 图集容器，.atlas 图集为空
+     * @param bundle 资源包，非资源包为空
+     * @param options 加载选项
+     * @return 是否加载成功
+     */
+    bool LoadDataLocked(const string& spineDataPath, const string& atlasDataPath,
+                        std::shared_ptr<SpineAtlasContainer> atlasContainer,
+                        const std::shared_ptr<SpineBundle>& bundle, const SpineLoadOptions& options);
+    
+    /**
+     * 按显示缩放重新选择图集变体，需要切换时提交后台准备（调用方需持有 dataMutex_）
+     */
+    void UpdateAtlasVariantLocked();
+    
+    /**
+     * 替换为后台准备完成的图集变体（调用方需持有 dataMutex_）
+     */
+    void ApplyAtlasVariantLocked();
+    
+    /**
+     * 确保动画已解码，延迟解码模式下首次使用时解码（调用方需持有 dataMutex_）
+     * @param animationName 动画名称
+     * @return 动画是否存在
+     */
+    bool EnsureAnimationLocked(const string& animationName);
+    
     /**
      * 清理渲染资源
      */
@@ -289,6 +592,113 @@ private:
      */
     void CreateDefaultData();
     
+    /**
+     * 释放动画数据、回调和共享资源，清空缓冲内容（调用方需持有 dataMutex_）
+     */
+    void ReleaseStateLocked();
+    
+    /**
+     * 记录状态变化：计入姿态签名并使缓存位图失效（调用方需持有 dataMutex_）
+     * @param token 状态变化描述
+     */
+    void MarkStateChanged(const string& token);
+    
+    /**
+     * 离开姿态共享组（调用方需持有 dataMutex_）
+     */
+    void LeavePoseGroupLocked();
+    
+    /**
+     * 向姿态共享组报告签名和轨道时间，与组内多数成员不一致时离组（调用方需持有 dataMutex_）
+     */
+    void SyncPoseGroupLocked();
+    
+    /**
+     * 是否为姿态共享组的跟随者（调用方需持有 dataMutex_）
+     */
+    bool IsPoseFollower() const;
+    
+    /**
+     * 事件是否已订阅（调用方需持有 dataMutex_）
+     * @param type 事件类型
+     * @param eventName 用户事件名称，非 kEvent 时忽略
+     */
+    bool AcceptsEvent(SpineEventType type, const char* eventName) const;
+    
+    /**
+     * 使用缓存位图绘制，位图无效时先光栅化一次（调用方需持有 dataMutex_）
+     * @param damage 需要更新的区域
+     * @return 是否已绘制，超出预算时返回 false
+     */
+    bool RenderFromBitmapCache(const SpineRect& damage);
+    
+    /**
+     * 与上一帧比较各附件的绘制状态，计算损坏区域（调用方需持有 dataMutex_）
+     * @param poseChanged 输出是否有附件的顶点或外观发生变化
+     * @return 损坏区域（已对齐到像素并限制在视图内）
+     */
+    SpineRect ComputeDamageRect(bool* poseChanged);
+    
+    /**
+     * 按绘制顺序计算所有可见附件的世界顶点（调用方需持有 dataMutex_）
+     * @param worldVertices 输出顶点缓冲（复用容量）
+     * @param drawRanges 输出各附件的顶点范围
+     */
+    void BuildWorldVertices(std::vector<float>& worldVertices, std::vector<SpineDrawRange>& drawRanges);
+    
+    /**
+     * 按缓冲容量重新计算实例的内存用量，并把变化计入全局统计（调用方需持有 dataMutex_）
+     */
+    void ReportMemoryLocked();
+    
+    /**
+     * 按轨道时间解码量化关键帧的窗口（调用方需持有 dataMutex_，未启用量化时直接返回）
+     * 必须在 AnimationState::apply 之前调用
+     */
+    void SeekQuantizedTimelinesLocked();
+    
+    /**
+     * 按动画包围盒表判断本帧是否不可见（调用方需持有 dataMutex_）
+     * 只有单条轨道（含混合来源）时判断；多轨叠加、姿态共享组成员或缺少包围盒表时不剔除
+     * @return 是否可以跳过姿态和顶点计算
+     */
+    bool IsCulledLocked();
+    
+    /**
+     * 获取当前皮肤下动画的包围盒表，尚未采样时用独立骨骼采样一次（调用方需持有 dataMutex_）
+     * @param animationName 动画名称
+     * @return 包围盒表，动画不存在时返回 nullptr
+     */
+    std::shared_ptr<const SpineBoundsTable> AcquireBoundsTableLocked(const string& animationName);
+    
+    /**
+     * 计算实例包围盒和包围盒附件多边形并发布到空间索引（调用方需持有 dataMutex_）
+     * 未设置场景位置的实例直接返回
+     */
+    void PublishHitBoundsLocked();
+    
+    /**
+     * 计算顶点的哈希
+     * @param vertices 顶点数据
+     * @param count 浮点数个数
+     * @return 哈希值
+     */
+    static uint64_t HashVertices(const float* vertices, size_t count);
+    
+    /**
+     * 计算单个网格附件的世界顶点，超过并行阈值时拆分到工作线程池
+     * 各块互不重叠且内核结果与分块方式无关，输出与单线程逐位一致
+     * @param bone 非加权网格的骨骼变换（加权网格时忽略）
+     * @param local 非加权网格的局部坐标（加权网格时为 nullptr）
+     * @param packed 加权网格的打包顶点（非加权网格时为 nullptr）
+     * @param vertexCount 顶点数
+     * @param deform 加权网格的顶点变形偏移（可为 nullptr）
+     * @param out 输出缓冲
+     */
+    void ComputeMeshVertices(const SpineVertexKernels::BoneTransform& bone, const float* local,
+                             const SpineVertexKernels::SkinnedVertex4* packed, size_t vertexCount,
+                             const float* deform, float* out) const;
+    
     // 友元类声明
     friend class SpineEventListener;
 };
@@ -0,0 +1,213 @@
+//
+// Created on 2026/10/19.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+/**
+ * SpinePoseGroup.cpp - 姿态共享组实现
+ */
+
+#include "SpinePoseGroup.h"
+#include "common/SpineMemoryTracker.h"
+#include <algorithm>
+#include <cmath>
+
+SpinePoseGroup::~SpinePoseGroup() {
+    SpineMemoryTracker::getInstance().Sub(SpineMemoryCategory::kPose, reportedBytes_);
+}
+
+namespace {
+// 同步的实例收到相同的时间增量，轨道时间按相同顺序累加，只需容忍舍入
+constexpr double kTrackTimeEpsilon = 1e-6;
+
+bool SameTime(double a, double b) {
+    return std::fabs(a - b) <= kTrackTimeEpsilon;
+}
+}
+
+bool SpinePoseGroup::InSync(const Member& a, const Member& b) {
+    return SameTime(a.trackTime, b.trackTime) || SameTime(a.trackTime, b.previousTrackTime) ||
+           SameTime(a.previousTrackTime, b.trackTime);
+}
+
+bool SpinePoseGroup::Follows(const Member& voter, const Member& target) {
+    return SameTime(voter.trackTime, target.trackTime) || SameTime(voter.trackTime, target.previousTrackTime);
+}
+
+std::vector<SpinePoseGroup::Member>::iterator SpinePoseGroup::FindLocked(const SpineManager* member) {
+    return std::find_if(members_.begin(), members_.end(),
+                        [member](const Member& entry) { return entry.manager == member; });
+}
+
+std::vector<SpinePoseGroup::Member>::const_iterator SpinePoseGroup::FindLeaderLocked() const {
+    return std::find_if(members_.begin(), members_.end(),
+                        [this](const Member& entry) { return entry.signature == signature_; });
+}
+
+size_t SpinePoseGroup::CountSignatureLocked(uint64_t signature) const {
+    return std::count_if(members_.begin(), members_.end(),
+                         [signature](const Member& entry) { return entry.signature == signature; });
+}
+
+bool SpinePoseGroup::AddMember(const SpineManager* member, uint64_t signature, double trackTime) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (FindLocked(member) != members_.end()) {
+        return signature == signature_;
+    }
+
+    // 第一个成员成为领导者并确定组签名
+    if (members_.empty()) {
+        signature_ = signature;
+        poseVersion_ = 0;
+        worldVertices_.clear();
+        drawRanges_.clear();
+    } else {
+        auto leader = FindLeaderLocked();
+        if (signature != signature_ || leader == members_.end() ||
+            !InSync(Member{member, signature, trackTime, trackTime}, *leader)) {
+            return false;
+        }
+    }
+
+    members_.push_back(Member{member, signature, trackTime, trackTime});
+    return true;
+}
+
+void SpinePoseGroup::RemoveMember(const SpineManager* member) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto it = FindLocked(member);
+    if (it == members_.end()) {
+        return;
+    }
+
+    // 领导者离开后由下一个成员接任；跟随者一直在推进自身的动画状态，可以直接接手计算
+    members_.erase(it);
+}
+
+bool SpinePoseGroup::Sync(const SpineManager* member, uint64_t signature, double trackTime) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto it = FindLocked(member);
+    if (it == members_.end()) {
+        // 作为偏离的领导者已被其他成员移除
+        return false;
+    }
+    if (!SameTime(it->trackTime, trackTime)) {
+        it->previousTrackTime = it->trackTime;
+        it->trackTime = trackTime;
+    }
+    it->signature = signature;
+
+    // 签名：多数成员收到同样的指令时组随之改变，其余持有旧签名的成员在各自检查时离组
+    if (signature != signature_) {
+        if (CountSignatureLocked(signature) <= CountSignatureLocked(signature_)) {
+            return false;
+        }
+        signature_ = signature;
+    }
+
+    // 轨道时间：与领导者一致即可；不一致时由多数决定偏离的是谁
+    auto leader = FindLeaderLocked();
+    if (leader == members_.end() || leader == it || InSync(*it, *leader)) {
+        return true;
+    }
+    size_t withMember = 0;
+    size_t withLeader = 0;
+    for (auto other = members_.begin(); other != members_.end(); ++other) {
+        if (other == it || other == leader || other->signature != signature_) {
+            continue;
+        }
+        // 投票只看投票者当前的时间，避免尚未更新的成员同时认同双方
+        withMember += Follows(*other, *it) ? 1 : 0;
+        withLeader += Follows(*other, *leader) ? 1 : 0;
+    }
+    if (withMember <= withLeader) {
+        return false;
+    }
+    // 领导者单独偏离（例如单独暂停）：移除领导者，它在下一次检查时发现自己已不在组内
+    members_.erase(leader);
+    return true;
+}
+
+void SpinePoseGroup::ReportSignature(const SpineManager* member, uint64_t signature) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto it = FindLocked(member);
+    if (it != members_.end()) {
+        it->signature = signature;
+    }
+}
+
+bool SpinePoseGroup::IsLeader(const SpineManager* member) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto leader = FindLeaderLocked();
+    return leader != members_.end() && leader->manager == member;
+}
+
+void SpinePoseGroup::PublishPose(const SpineManager* member, double trackTime, const std::vector<float>& worldVertices,
+                                 const std::vector<SpineDrawRange>& drawRanges) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto leader = FindLeaderLocked();
+    if (leader == members_.end() || leader->manager != member) {
+        return;
+    }
+    worldVertices_.assign(worldVertices.begin(), worldVertices.end());
+    drawRanges_.assign(drawRanges.begin(), drawRanges.end());
+    poseTrackTime_ = trackTime;
+    ++poseVersion_;
+
+    size_t bytes = worldVertices_.capacity() * sizeof(float) + drawRanges_.capacity() * sizeof(SpineDrawRange);
+    if (bytes != reportedBytes_) {
+        SpineMemoryTracker::getInstance().Add(SpineMemoryCategory::kPose, bytes);
+        SpineMemoryTracker::getInstance().Sub(SpineMemoryCategory::kPose, reportedBytes_);
+        reportedBytes_ = bytes;
+    }
+}
+
+uint64_t SpinePoseGroup::CopyPose(uint64_t lastVersion, double trackTime, std::vector<float>* worldVertices,
+                                  std::vector<SpineDrawRange>* drawRanges) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (poseVersion_ == 0 || poseVersion_ == lastVersion || !SameTime(poseTrackTime_, trackTime)) {
+        return lastVersion;
+    }
+    if (worldVertices) {
+        worldVertices->assign(worldVertices_.begin(), worldVertices_.end());
+    }
+    if (drawRanges) {
+        drawRanges->assign(drawRanges_.begin(), drawRanges_.end());
+    }
+    return poseVersion_;
+}
+
+/**
+ * SpinePoseGroupRegistry 实现
+ */
+SpinePoseGroupRegistry& SpinePoseGroupRegistry::getInstance() {
+    static SpinePoseGroupRegistry instance;
+    return instance;
+}
+
+std::shared_ptr<SpinePoseGroup> SpinePoseGroupRegistry::Acquire(int32_t groupId) {
+    std::lock_guard<std::mutex> lock(groupsMutex_);
+
+    // 顺带清理已释放的组
+    for (auto it = groups_.begin(); it != groups_.end();) {
+        if (it->second.expired() && it->first != groupId) {
+            it = groups_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    std::shared_ptr<SpinePoseGroup> group = groups_[groupId].lock();
+    if (!group) {
+        group = std::make_shared<SpinePoseGroup>(groupId);
+        groups_[groupId] = group;
+    }
+    return group;
+}
@@ -0,0 +1,157 @@
+//
+// Created on 2026/10/19.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#ifndef SPINEHM_SPINEPOSEGROUP_H
+#define SPINEHM_SPINEPOSEGROUP_H
+/**
+ * SpinePoseGroup - 姿态共享组
+ * 同一骨骼、同一动画、同步播放的多个实例共享一份姿态：
+ * 领导者计算姿态与世界顶点，跟随者只应用自身的 2D 变换和着色
+ */
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include "common/common.h"
+
+class SpineManager;
+
+/**
+ * 姿态共享组
+ * 组键由姿态签名（骨骼数据、皮肤及每条动画指令和发出时的轨道时间）与当前轨道时间组成。
+ * 成员各自登记键，与组不一致的成员离组，其余成员留在组内：签名按多数成员决定（多数成员收到同样的指令时组随之改变），
+ * 轨道时间与领导者不一致时按多数判断离组的是该成员还是领导者。
+ * 领导者为成员列表中第一个签名与组一致的成员；领导者离开时由下一个成员接任
+ */
+class SpinePoseGroup {
+public:
+    explicit SpinePoseGroup(int32_t groupId) : groupId_(groupId) {}
+    ~SpinePoseGroup();
+
+    int32_t GetGroupId() const { return groupId_; }
+
+    /**
+     * 加入成员
+     * @param member 成员实例
+     * @param signature 成员当前的姿态签名
+     * @param trackTime 成员当前的轨道时间
+     * @return 是否加入成功（签名或轨道时间与组不一致时失败）
+     */
+    bool AddMember(const SpineManager* member, uint64_t signature, double trackTime);
+
+    /**
+     * 移除成员，领导者离开时自动选出新的领导者
+     * @param member 成员实例
+     */
+    void RemoveMember(const SpineManager* member);
+
+    /**
+     * 登记成员当前的键并检查是否仍与组一致（每次更新和渲染前调用）
+     * 签名不同时，多数成员已持有该签名则组改用该签名，否则该成员应离组；
+     * 轨道时间与领导者不同时，多数成员与该成员一致则移除领导者，否则该成员应离组
+     * @param member 成员实例
+     * @param signature 成员当前的姿态签名
+     * @param trackTime 成员当前的轨道时间
+     * @return 是否仍在组内，返回 false 时调用方应离组（已被移除的成员也返回 false）
+     */
+    bool Sync(const SpineManager* member, uint64_t signature, double trackTime);
+
+    /**
+     * 登记成员的新签名，不做判断（下达指令时调用，使同一时刻向全组下达的指令在判断前全部登记）
+     * @param member 成员实例
+     * @param signature 成员新的姿态签名
+     */
+    void ReportSignature(const SpineManager* member, uint64_t signature);
+
+    /**
+     * 是否为领导者
+     * @param member 成员实例
+     */
+    bool IsLeader(const SpineManager* member) const;
+
+    /**
+     * 领导者发布本帧的世界顶点
+     * @param member 调用者，非领导者调用无效
+     * @param trackTime 姿态对应的轨道时间
+     * @param worldVertices 世界顶点缓冲
+     * @param drawRanges 各附件的顶点范围
+     */
+    void PublishPose(const SpineManager* member, double trackTime, const std::vector<float>& worldVertices,
+                     const std::vector<SpineDrawRange>& drawRanges);
+
+    /**
+     * 跟随者读取领导者发布的世界顶点
+     * 只复制与调用者轨道时间相同的姿态（领导者本帧尚未更新时保留调用者已持有的姿态）
+     * @param lastVersion 调用者已持有的姿态版本，版本未变化时不复制
+     * @param trackTime 调用者当前的轨道时间
+     * @param worldVertices 输出缓冲
+     * @param drawRanges 输出各附件的顶点范围
+     * @return 调用者持有的姿态版本，尚未复制过时返回 0
+     */
+    uint64_t CopyPose(uint64_t lastVersion, double trackTime, std::vector<float>* worldVertices,
+                      std::vector<SpineDrawRange>* drawRanges) const;
+
+private:
+    /**
+     * 成员登记的键；上一个轨道时间用于容忍同一帧内成员更新先后造成的一帧偏差
+     */
+    struct Member {
+        const SpineManager* manager;
+        uint64_t signature;
+        double trackTime;
+        double previousTrackTime;
+    };
+
+    /**
+     * 两个成员的轨道时间是否同步（允许其中一个本帧尚未更新）
+     */
+    static bool InSync(const Member& a, const Member& b);
+
+    /**
+     * voter 当前的轨道时间是否与 target 一致（允许 voter 本帧尚未更新）
+     */
+    static bool Follows(const Member& voter, const Member& target);
+
+    std::vector<Member>::iterator FindLocked(const SpineManager* member);
+    std::vector<Member>::const_iterator FindLeaderLocked() const;
+    size_t CountSignatureLocked(uint64_t signature) const;
+
+    int32_t groupId_;
+    uint64_t signature_ = 0;
+    uint64_t poseVersion_ = 0;
+    double poseTrackTime_ = 0.0;
+    std::vector<Member> members_;
+    std::vector<float> worldVertices_;
+    std::vector<SpineDrawRange> drawRanges_;
+    size_t reportedBytes_ = 0;  // 已计入内存统计的缓冲字节数
+    mutable std::mutex mutex_;
+};
+
+/**
+ * 姿态共享组注册表
+ * 组在第一个成员加入时创建，最后一个成员离开后释放
+ */
+class SpinePoseGroupRegistry {
+public:
+    static SpinePoseGroupRegistry& getInstance();
+
+    /**
+     * 获取或创建姿态共享组
+     * @param groupId 组ID
+     * @return 组对象
+     */
+    std::shared_ptr<SpinePoseGroup> Acquire(int32_t groupId);
+
+private:
+    SpinePoseGroupRegistry() = default;
+
+    std::unordered_map<int32_t, std::weak_ptr<SpinePoseGroup>> groups_;
+    std::mutex groupsMutex_;
+};
+
+#endif //SPINEHM_SPINEPOSEGROUP_H
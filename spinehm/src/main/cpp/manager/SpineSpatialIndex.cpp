@@ -0,0 +1,188 @@
+//
+// Created on 2026/10/19.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+/**
+ * SpineSpatialIndex.cpp - 实例包围盒网格索引实现
+ */
+
+#include "SpineSpatialIndex.h"
+#include <algorithm>
+#include <cmath>
+
+SpineSpatialIndex& SpineSpatialIndex::getInstance() {
+    static SpineSpatialIndex instance;
+    return instance;
+}
+
+void SpineSpatialIndex::SetTransform(int32_t instanceId, float x, float y, int32_t zIndex) {
+    std::lock_guard<std::mutex> lock(indexMutex_);
+    Entry& entry = entries_[instanceId];
+    entry.originX = x;
+    entry.originY = y;
+    entry.zIndex = zIndex;
+    RebucketLocked(instanceId, entry);
+}
+
+void SpineSpatialIndex::Remove(int32_t instanceId) {
+    std::lock_guard<std::mutex> lock(indexMutex_);
+    auto it = entries_.find(instanceId);
+    if (it == entries_.end()) {
+        return;
+    }
+    UnbucketLocked(instanceId, it->second);
+    entries_.erase(it);
+}
+
+bool SpineSpatialIndex::IsTracked(int32_t instanceId) const {
+    std::lock_guard<std::mutex> lock(indexMutex_);
+    return entries_.find(instanceId) != entries_.end();
+}
+
+void SpineSpatialIndex::Publish(int32_t instanceId, const SpineRect& bounds, const std::vector<SpineHitShape>& shapes) {
+    std::lock_guard<std::mutex> lock(indexMutex_);
+    auto it = entries_.find(instanceId);
+    if (it == entries_.end()) {
+        return;
+    }
+    Entry& entry = it->second;
+    entry.bounds = bounds;
+    // 逐项赋值复用已有字符串和多边形的容量
+    entry.shapes.resize(shapes.size());
+    for (size_t i = 0; i < shapes.size(); ++i) {
+        entry.shapes[i].name = shapes[i].name;
+        entry.shapes[i].bounds = shapes[i].bounds;
+        entry.shapes[i].polygon = shapes[i].polygon;
+    }
+    RebucketLocked(instanceId, entry);
+}
+
+void SpineSpatialIndex::HitTest(float x, float y, std::vector<SpineHitResult>* results) const {
+    std::lock_guard<std::mutex> lock(indexMutex_);
+    results->clear();
+
+    struct Hit {
+        int32_t instanceId;
+        const Entry* entry;
+    };
+    std::vector<Hit> hits;
+    auto testEntry = [&](int32_t instanceId) {
+        auto it = entries_.find(instanceId);
+        if (it == entries_.end()) {
+            return;
+        }
+        const Entry& entry = it->second;
+        float localX = x - entry.originX;
+        float localY = y - entry.originY;
+        if (localX >= entry.bounds.left && localX < entry.bounds.right &&
+            localY >= entry.bounds.top && localY < entry.bounds.bottom) {
+            hits.push_back({instanceId, &entry});
+        }
+    };
+
+    auto cell = cells_.find(CellKey(static_cast<int32_t>(std::floor(x / kCellSize)),
+                                    static_cast<int32_t>(std::floor(y / kCellSize))));
+    if (cell != cells_.end()) {
+        for (int32_t instanceId : cell->second) {
+            testEntry(instanceId);
+        }
+    }
+    for (int32_t instanceId : oversized_) {
+        testEntry(instanceId);
+    }
+
+    std::sort(hits.begin(), hits.end(), [](const Hit& a, const Hit& b) {
+        return a.entry->zIndex != b.entry->zIndex ? a.entry->zIndex > b.entry->zIndex : a.instanceId > b.instanceId;
+    });
+
+    results->resize(hits.size());
+    for (size_t i = 0; i < hits.size(); ++i) {
+        SpineHitResult& result = (*results)[i];
+        result.instanceId = hits[i].instanceId;
+        const Entry& entry = *hits[i].entry;
+        float localX = x - entry.originX;
+        float localY = y - entry.originY;
+        for (const SpineHitShape& shape : entry.shapes) {
+            if (localX >= shape.bounds.left && localX < shape.bounds.right &&
+                localY >= shape.bounds.top && localY < shape.bounds.bottom &&
+                PointInPolygon(shape.polygon, localX, localY)) {
+                result.attachments.push_back(shape.name);
+            }
+        }
+    }
+}
+
+bool SpineSpatialIndex::PointInPolygon(const std::vector<float>& polygon, float x, float y) {
+    // 与 spine::SkeletonBounds::containsPoint 相同的奇偶规则
+    size_t count = polygon.size() / 2;
+    if (count < 3) {
+        return false;
+    }
+    bool inside = false;
+    size_t prev = count - 1;
+    for (size_t i = 0; i < count; prev = i++) {
+        float xi = polygon[i * 2];
+        float yi = polygon[i * 2 + 1];
+        float xj = polygon[prev * 2];
+        float yj = polygon[prev * 2 + 1];
+        if ((yi < y && yj >= y) || (yj < y && yi >= y)) {
+            if (xi + (y - yi) / (yj - yi) * (xj - xi) < x) {
+                inside = !inside;
+            }
+        }
+    }
+    return inside;
+}
+
+void SpineSpatialIndex::RebucketLocked(int32_t instanceId, Entry& entry) {
+    CellRange range;
+    if (!entry.bounds.IsEmpty()) {
+        range.minX = static_cast<int32_t>(std::floor((entry.bounds.left + entry.originX) / kCellSize));
+        range.minY = static_cast<int32_t>(std::floor((entry.bounds.top + entry.originY) / kCellSize));
+        range.maxX = static_cast<int32_t>(std::floor((entry.bounds.right + entry.originX) / kCellSize));
+        range.maxY = static_cast<int32_t>(std::floor((entry.bounds.bottom + entry.originY) / kCellSize));
+    }
+    int64_t cellCount = range.IsEmpty() ? 0
+        : static_cast<int64_t>(range.maxX - range.minX + 1) * (range.maxY - range.minY + 1);
+    bool oversized = cellCount > kMaxCellsPerInstance;
+    if (range == entry.cells && oversized == entry.oversized) {
+        return;
+    }
+
+    UnbucketLocked(instanceId, entry);
+    entry.cells = range;
+    entry.oversized = oversized;
+    if (oversized) {
+        oversized_.push_back(instanceId);
+        return;
+    }
+    for (int32_t cellY = range.minY; cellY <= range.maxY; ++cellY) {
+        for (int32_t cellX = range.minX; cellX <= range.maxX; ++cellX) {
+            cells_[CellKey(cellX, cellY)].push_back(instanceId);
+        }
+    }
+}
+
+void SpineSpatialIndex::UnbucketLocked(int32_t instanceId, Entry& entry) {
+    if (entry.oversized) {
+        oversized_.erase(std::remove(oversized_.begin(), oversized_.end(), instanceId), oversized_.end());
+    } else {
+        for (int32_t cellY = entry.cells.minY; cellY <= entry.cells.maxY; ++cellY) {
+            for (int32_t cellX = entry.cells.minX; cellX <= entry.cells.maxX; ++cellX) {
+                auto cell = cells_.find(CellKey(cellX, cellY));
+                if (cell == cells_.end()) {
+                    continue;
+                }
+                std::vector<int32_t>& ids = cell->second;
+                ids.erase(std::remove(ids.begin(), ids.end(), instanceId), ids.end());
+                if (ids.empty()) {
+                    cells_.erase(cell);
+                }
+            }
+        }
+    }
+    entry.cells = CellRange();
+    entry.oversized = false;
+}
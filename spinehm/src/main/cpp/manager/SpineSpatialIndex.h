@@ -0,0 +1,118 @@
+//
+// Created on 2026/10/19.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#ifndef SPINEHM_SPINESPATIALINDEX_H
+#define SPINEHM_SPINESPATIALINDEX_H
+/**
+ * SpineSpatialIndex - 实例包围盒的均匀网格索引
+ * 设置了场景位置的实例在每次 Update 后发布自身包围盒和包围盒附件多边形，
+ * 包围盒跨越的网格不变时只替换数据；命中测试只检查触点所在网格中的实例。
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "common/common.h"
+
+/**
+ * 单个实例的命中结果
+ */
+struct SpineHitResult {
+    int32_t instanceId = -1;
+    std::vector<std::string> attachments;  // 命中的包围盒附件名称，只命中实例包围盒时为空
+};
+
+class SpineSpatialIndex {
+public:
+    static SpineSpatialIndex& getInstance();
+
+    /**
+     * 设置实例在场景中的位置（视图左上角）和层级，首次设置时开始跟踪该实例
+     * @param instanceId 实例ID
+     * @param x 场景坐标 x
+     * @param y 场景坐标 y
+     * @param zIndex 层级，命中结果按层级从高到低排列
+     */
+    void SetTransform(int32_t instanceId, float x, float y, int32_t zIndex);
+
+    /**
+     * 停止跟踪实例（实例销毁时调用）
+     */
+    void Remove(int32_t instanceId);
+
+    /**
+     * 是否跟踪该实例（未跟踪的实例不需要计算包围盒）
+     */
+    bool IsTracked(int32_t instanceId) const;
+
+    /**
+     * 发布实例的包围盒（视图坐标）
+     * @param instanceId 实例ID
+     * @param bounds 实例包围盒
+     * @param shapes 包围盒附件多边形
+     */
+    void Publish(int32_t instanceId, const SpineRect& bounds, const std::vector<SpineHitShape>& shapes);
+
+    /**
+     * 命中测试
+     * @param x 场景坐标 x
+     * @param y 场景坐标 y
+     * @param results 输出，按层级从高到低、同层按实例ID从大到小排列
+     */
+    void HitTest(float x, float y, std::vector<SpineHitResult>* results) const;
+
+private:
+    SpineSpatialIndex() = default;
+
+    // 网格边长（场景像素）
+    static constexpr float kCellSize = 128.0f;
+    // 跨越网格数超过该值的实例不进网格，每次命中测试都检查
+    static constexpr int64_t kMaxCellsPerInstance = 256;
+
+    struct CellRange {
+        int32_t minX = 0;
+        int32_t minY = 0;
+        int32_t maxX = -1;
+        int32_t maxY = -1;
+
+        bool IsEmpty() const { return maxX < minX || maxY < minY; }
+        bool operator==(const CellRange& other) const {
+            return minX == other.minX && minY == other.minY && maxX == other.maxX && maxY == other.maxY;
+        }
+    };
+
+    struct Entry {
+        float originX = 0.0f;
+        float originY = 0.0f;
+        int32_t zIndex = 0;
+        SpineRect bounds;                  // 视图坐标
+        std::vector<SpineHitShape> shapes; // 视图坐标
+        CellRange cells;
+        bool oversized = false;
+    };
+
+    static int64_t CellKey(int32_t cellX, int32_t cellY) {
+        return (static_cast<int64_t>(cellX) << 32) ^ static_cast<uint32_t>(cellY);
+    }
+
+    static bool PointInPolygon(const std::vector<float>& polygon, float x, float y);
+
+    /**
+     * 按场景包围盒重新放入网格（范围不变时不做任何事）
+     */
+    void RebucketLocked(int32_t instanceId, Entry& entry);
+    void UnbucketLocked(int32_t instanceId, Entry& entry);
+
+    std::unordered_map<int32_t, Entry> entries_;
+    std::unordered_map<int64_t, std::vector<int32_t>> cells_;
+    std::vector<int32_t> oversized_;
+    mutable std::mutex indexMutex_;
+};
+
+#endif //SPINEHM_SPINESPATIALINDEX_H
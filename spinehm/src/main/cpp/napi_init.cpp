@@ -72,9 +72,14 @@ static napi_value Init(napi_env env, napi_value exports) {
         {"createSpineInstance", nullptr, SpineNapi::CreateSpineInstance, nullptr, nullptr, nullptr, napi_default, nullptr},
         {"destroySpineInstance", nullptr, SpineNapi::DestroySpineInstance, nullptr, nullptr, nullptr, napi_default, nullptr},
         {"setEventCallback", nullptr, SpineNapi::SetEventCallback, nullptr, nullptr, nullptr, napi_default, nullptr},
+        {"getEventStats", nullptr, SpineNapi::GetEventStats, nullptr, nullptr, nullptr, napi_default, nullptr},
+        {"setEventBatchCallback", nullptr, SpineNapi::SetEventBatchCallback, nullptr, nullptr, nullptr, napi_default, nullptr},
+        {"flushEvents", nullptr, SpineNapi::FlushEvents, nullptr, nullptr, nullptr, napi_default, nullptr},
         {"loadSpineData", nullptr, SpineNapi::LoadSpineData, nullptr, nullptr, nullptr, napi_default, nullptr},
+        {"loadSpineBundle", nullptr, SpineNapi::LoadSpineBundle, nullptr, nullptr, nullptr, napi_default, nullptr},
         {"setAnimation", nullptr, SpineNapi::SetAnimation, nullptr, nullptr, nullptr, napi_default, nullptr},
         {"addAnimation", nullptr, SpineNapi::AddAnimation, nullptr, nullptr, nullptr, napi_default, nullptr},
+        {"preloadAnimations", nullptr, SpineNapi::PreloadAnimations, nullptr, nullptr, nullptr, napi_default, nullptr},
         {"setSkin", nullptr, SpineNapi::SetSkin, nullptr, nullptr, nullptr, napi_default, nullptr},
         {"setMix", nullptr, SpineNapi::SetMix, nullptr, nullptr, nullptr, napi_default, nullptr},
         {"setTimeScale", nullptr, SpineNapi::SetTimeScale, nullptr, nullptr, nullptr, napi_default, nullptr},
@@ -83,13 +88,48 @@ static napi_value Init(napi_env env, napi_value exports) {
         {"clearTracks", nullptr, SpineNapi::ClearTracks, nullptr, nullptr, nullptr, napi_default, nullptr},
         {"clearTrack", nullptr, SpineNapi::ClearTrack, nullptr, nullptr, nullptr, napi_default, nullptr},
         {"updateViewSize", nullptr, SpineNapi::UpdateViewSize, nullptr, nullptr, nullptr, napi_default, nullptr},
+        {"setScale", nullptr, SpineNapi::SetScale, nullptr, nullptr, nullptr, napi_default, nullptr},
         {"getAnimations", nullptr, SpineNapi::GetAnimations, nullptr, nullptr, nullptr, napi_default, nullptr},
         {"getSkins", nullptr, SpineNapi::GetSkins, nullptr, nullptr, nullptr, napi_default, nullptr},
         {"cleanup", nullptr, SpineNapi::Cleanup, nullptr, nullptr, nullptr, napi_default, nullptr},
         {"update", nullptr, SpineNapi::Update, nullptr, nullptr, nullptr, napi_default, nullptr},
         {"render", nullptr, SpineNapi::Render, nullptr, nullptr, nullptr, napi_default, nullptr},
+        {"setFrameBudget", nullptr, SpineNapi::SetFrameBudget, nullptr, nullptr, nullptr, napi_default, nullptr},
+        {"setSchedulePriority", nullptr, SpineNapi::SetSchedulePriority, nullptr, nullptr, nullptr, napi_default, nullptr},
+        {"runFrame", nullptr, SpineNapi::RunFrame, nullptr, nullptr, nullptr, napi_default, nullptr},
+        {"getFrameSchedulerStats", nullptr, SpineNapi::GetFrameSchedulerStats, nullptr, nullptr, nullptr, napi_default, nullptr},
+        {"createClock", nullptr, SpineNapi::CreateClock, nullptr, nullptr, nullptr, napi_default, nullptr},
+        {"destroyClock", nullptr, SpineNapi::DestroyClock, nullptr, nullptr, nullptr, napi_default, nullptr},
+        {"setClockTimeScale", nullptr, SpineNapi::SetClockTimeScale, nullptr, nullptr, nullptr, napi_default, nullptr},
+        {"setClockPaused", nullptr, SpineNapi::SetClockPaused, nullptr, nullptr, nullptr, napi_default, nullptr},
+        {"attachToClock", nullptr, SpineNapi::AttachToClock, nullptr, nullptr, nullptr, napi_default, nullptr},
+        {"tickClock", nullptr, SpineNapi::TickClock, nullptr, nullptr, nullptr, napi_default, nullptr},
+        {"setSceneTransform", nullptr, SpineNapi::SetSceneTransform, nullptr, nullptr, nullptr, napi_default, nullptr},
+        {"hitTest", nullptr, SpineNapi::HitTest, nullptr, nullptr, nullptr, napi_default, nullptr},
+        {"joinPoseGroup", nullptr, SpineNapi::JoinPoseGroup, nullptr, nullptr, nullptr, napi_default, nullptr},
+        {"leavePoseGroup", nullptr, SpineNapi::LeavePoseGroup, nullptr, nullptr, nullptr, napi_default, nullptr},
+        {"setTint", nullptr, SpineNapi::SetTint, nullptr, nullptr, nullptr, napi_default, nullptr},
+        {"setPremultipliedAlpha", nullptr, SpineNapi::SetPremultipliedAlpha, nullptr, nullptr, nullptr, napi_default, nullptr},
+        {"setVisibleRect", nullptr, SpineNapi::SetVisibleRect, nullptr, nullptr, nullptr, napi_default, nullptr},
+        {"clearVisibleRect", nullptr, SpineNapi::ClearVisibleRect, nullptr, nullptr, nullptr, napi_default, nullptr},
+        {"setBitmapCacheBudget", nullptr, SpineNapi::SetBitmapCacheBudget, nullptr, nullptr, nullptr, napi_default, nullptr},
+        {"setParallelSkinningThreshold", nullptr, SpineNapi::SetParallelSkinningThreshold, nullptr, nullptr, nullptr, napi_default, nullptr},
+        {"getRenderStats", nullptr, SpineNapi::GetRenderStats, nullptr, nullptr, nullptr, napi_default, nullptr},
+        {"configureInstancePool", nullptr, SpineNapi::ConfigureInstancePool, nullptr, nullptr, nullptr, napi_default, nullptr},
+        {"getInstancePoolStats", nullptr, SpineNapi::GetInstancePoolStats, nullptr, nullptr, nullptr, napi_default, nullptr},
+        {"setMemoryBudget", nullptr, SpineNapi::SetMemoryBudget, nullptr, nullptr, nullptr, napi_default, nullptr},
+        {"getMemoryStats", nullptr, SpineNapi::GetMemoryStats, nullptr, nullptr, nullptr, napi_default, nullptr},
+        {"startTrace", nullptr, SpineNapi::StartTrace, nullptr, nullptr, nullptr, napi_default, nullptr},
+        {"stopTrace", nullptr, SpineNapi::StopTrace, nullptr, nullptr, nullptr, napi_default, nullptr},
+        {"startCommandRecording", nullptr, SpineNapi::StartCommandRecording, nullptr, nullptr, nullptr, napi_default, nullptr},
+        {"stopCommandRecording", nullptr, SpineNapi::StopCommandRecording, nullptr, nullptr, nullptr, napi_default, nullptr},
+#ifdef SPINEHM_BENCHMARKS
+        {"benchmarkNapiMarshaling", nullptr, SpineNapi::BenchmarkNapiMarshaling, nullptr, nullptr, nullptr, napi_default, nullptr},
+#endif
     };
     napi_define_properties(env, exports, sizeof(desc) / sizeof(desc[0]), desc);
+    // 主线程和每个 Worker 各自加载一次模块，各有独立的实例、事件缓冲和帧调度
+    SpineInstanceRegistry::getInstance().RegisterEnv(env);
     return exports;
 }
 EXTERN_C_END
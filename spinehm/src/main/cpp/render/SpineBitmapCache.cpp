@@ -0,0 +1,170 @@
+//
+// Created on 2026/10/19.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+/**
+ * SpineBitmapCache.cpp - 静态帧位图缓存实现
+ */
+
+#include "SpineBitmapCache.h"
+#include "common/SpineMemoryTracker.h"
+
+namespace {
+// 全局预算淘汰顺序：位图只需重新光栅化一帧，最先淘汰
+constexpr int32_t kBitmapEvictPriority = 0;
+}
+
+SpineBitmapCache& SpineBitmapCache::getInstance() {
+    static SpineBitmapCache instance;
+    return instance;
+}
+
+SpineBitmapCache::SpineBitmapCache() {
+    SpineMemoryTracker::getInstance().RegisterEvictor(kBitmapEvictPriority, [](size_t bytesToFree) {
+        SpineBitmapCache& cache = SpineBitmapCache::getInstance();
+        std::lock_guard<std::mutex> lock(cache.cacheMutex_);
+        return cache.EvictLocked(cache.usageBytes_ > bytesToFree ? cache.usageBytes_ - bytesToFree : 0, nullptr);
+    });
+}
+
+void SpineBitmapCache::SetBudget(size_t budgetBytes) {
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    budgetBytes_ = budgetBytes;
+    EvictLocked(budgetBytes_, nullptr);
+}
+
+size_t SpineBitmapCache::GetBudget() const {
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    return budgetBytes_;
+}
+
+size_t SpineBitmapCache::GetUsage() const {
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    return usageBytes_;
+}
+
+size_t SpineBitmapCache::GetBytes(const SpineManager* owner) const {
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+
+    auto it = entries_.find(owner);
+    return it == entries_.end() ? 0 : it->second.bitmap->GetByteSize();
+}
+
+std::shared_ptr<SpineBitmap> SpineBitmapCache::Find(const SpineManager* owner) {
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+
+    auto it = entries_.find(owner);
+    if (it == entries_.end()) {
+        return nullptr;
+    }
+
+    lru_.splice(lru_.begin(), lru_, it->second.lruIt);
+    return it->second.bitmap;
+}
+
+std::shared_ptr<SpineBitmap> SpineBitmapCache::Acquire(const SpineManager* owner, int32_t width, int32_t height) {
+    std::shared_ptr<SpineBitmap> bitmap;
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex_);
+        bitmap = AcquireLocked(owner, width, height);
+    }
+
+    // 新位图可能使总内存超出全局预算（淘汰函数需要获取 cacheMutex_，在锁外调用）
+    SpineMemoryTracker::getInstance().EnforceBudget();
+    return bitmap;
+}
+
+std::shared_ptr<SpineBitmap> SpineBitmapCache::AcquireLocked(const SpineManager* owner, int32_t width,
+                                                             int32_t height) {
+    if (width <= 0 || height <= 0) {
+        return nullptr;
+    }
+
+    auto it = entries_.find(owner);
+    if (it != entries_.end()) {
+        SpineBitmap* bitmap = it->second.bitmap.get();
+        if (bitmap->width == width && bitmap->height == height) {
+            lru_.splice(lru_.begin(), lru_, it->second.lruIt);
+            return it->second.bitmap;
+        }
+
+        // 尺寸变化，释放旧位图
+        usageBytes_ -= bitmap->GetByteSize();
+        SpineMemoryTracker::getInstance().Sub(SpineMemoryCategory::kBitmapCache, bitmap->GetByteSize());
+        lru_.erase(it->second.lruIt);
+        entries_.erase(it);
+    }
+
+    size_t bytes = static_cast<size_t>(width) * static_cast<size_t>(height) * sizeof(uint32_t);
+    if (bytes > budgetBytes_) {
+        return nullptr;
+    }
+
+    // 为新位图腾出空间
+    if (usageBytes_ + bytes > budgetBytes_) {
+        EvictLocked(budgetBytes_ - bytes, owner);
+    }
+
+    auto bitmap = std::make_shared<SpineBitmap>();
+    bitmap->width = width;
+    bitmap->height = height;
+    bitmap->pixels.resize(static_cast<size_t>(width) * static_cast<size_t>(height));
+
+    lru_.push_front(owner);
+    entries_[owner] = Entry{bitmap, lru_.begin()};
+    usageBytes_ += bytes;
+    SpineMemoryTracker::getInstance().Add(SpineMemoryCategory::kBitmapCache, bytes);
+    return bitmap;
+}
+
+void SpineBitmapCache::Invalidate(const SpineManager* owner) {
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+
+    auto it = entries_.find(owner);
+    if (it != entries_.end()) {
+        it->second.bitmap->valid = false;
+    }
+}
+
+void SpineBitmapCache::Release(const SpineManager* owner) {
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+
+    auto it = entries_.find(owner);
+    if (it == entries_.end()) {
+        return;
+    }
+
+    usageBytes_ -= it->second.bitmap->GetByteSize();
+    SpineMemoryTracker::getInstance().Sub(SpineMemoryCategory::kBitmapCache, it->second.bitmap->GetByteSize());
+    lru_.erase(it->second.lruIt);
+    entries_.erase(it);
+}
+
+size_t SpineBitmapCache::Trim(size_t targetBytes) {
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    return EvictLocked(targetBytes, nullptr);
+}
+
+size_t SpineBitmapCache::EvictLocked(size_t targetBytes, const SpineManager* keep) {
+    size_t freed = 0;
+
+    // 从表尾（最久未使用）开始淘汰；正在使用的位图由 shared_ptr 保活到本帧结束
+    auto it = lru_.end();
+    while (usageBytes_ > targetBytes && it != lru_.begin()) {
+        --it;
+        if (*it == keep) {
+            continue;
+        }
+
+        auto entryIt = entries_.find(*it);
+        size_t bytes = entryIt->second.bitmap->GetByteSize();
+        usageBytes_ -= bytes;
+        freed += bytes;
+        SpineMemoryTracker::getInstance().Sub(SpineMemoryCategory::kBitmapCache, bytes);
+        entries_.erase(entryIt);
+        it = lru_.erase(it);
+    }
+    return freed;
+}
@@ -0,0 +1,139 @@
+//
+// Created on 2026/10/19.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#ifndef SPINEHM_SPINEBITMAPCACHE_H
+#define SPINEHM_SPINEBITMAPCACHE_H
+/**
+ * SpineBitmapCache - 静态帧位图缓存
+ * 暂停或姿态未变化的实例只光栅化一次，之后每帧直接贴图
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+// Skia 相关头文件（待集成）
+// #include <include/core/SkImage.h>
+
+class SpineManager;
+
+/**
+ * 缓存位图（RGBA8888，按视图尺寸分配）
+ */
+struct SpineBitmap {
+    int32_t width = 0;
+    int32_t height = 0;
+    std::vector<uint32_t> pixels;
+
+    // 是否已光栅化出有效内容
+    bool valid = false;
+
+    // Skia 相关成员（待实现）
+    // sk_sp<SkImage> image;
+
+    size_t GetByteSize() const { return pixels.size() * sizeof(uint32_t); }
+};
+
+/**
+ * 位图缓存
+ * 所有实例共享一个内存预算，超出预算时淘汰最久未使用的位图
+ */
+class SpineBitmapCache {
+public:
+    static SpineBitmapCache& getInstance();
+
+    /**
+     * 设置内存预算
+     * @param budgetBytes 预算字节数，0 表示禁用位图缓存
+     */
+    void SetBudget(size_t budgetBytes);
+
+    /**
+     * 获取内存预算
+     */
+    size_t GetBudget() const;
+
+    /**
+     * 获取当前占用字节数
+     */
+    size_t GetUsage() const;
+
+    /**
+     * 获取实例位图占用的字节数（不改变淘汰顺序）
+     * @param owner 所属实例
+     */
+    size_t GetBytes(const SpineManager* owner) const;
+
+    /**
+     * 查找实例的缓存位图并标记为最近使用
+     * @param owner 所属实例
+     * @return 位图，不存在时返回 nullptr
+     */
+    std::shared_ptr<SpineBitmap> Find(const SpineManager* owner);
+
+    /**
+     * 为实例分配指定尺寸的位图，尺寸不变时复用已有位图
+     * @param owner 所属实例
+     * @param width 宽度
+     * @param height 高度
+     * @return 位图，超出预算时返回 nullptr
+     */
+    std::shared_ptr<SpineBitmap> Acquire(const SpineManager* owner, int32_t width, int32_t height);
+
+    /**
+     * 使实例的位图内容失效（保留内存以便复用）
+     * @param owner 所属实例
+     */
+    void Invalidate(const SpineManager* owner);
+
+    /**
+     * 释放实例的位图
+     * @param owner 所属实例
+     */
+    void Release(const SpineManager* owner);
+
+    /**
+     * 淘汰位图直到占用不超过目标值
+     * @param targetBytes 目标字节数
+     * @return 释放的字节数
+     */
+    size_t Trim(size_t targetBytes);
+
+private:
+    SpineBitmapCache();
+
+    /**
+     * 按最近最少使用淘汰位图（调用方需持有 cacheMutex_）
+     * @param targetBytes 目标字节数
+     * @param keep 不参与淘汰的实例
+     * @return 释放的字节数
+     */
+    size_t EvictLocked(size_t targetBytes, const SpineManager* keep);
+
+    /**
+     * 分配位图（调用方需持有 cacheMutex_）
+     */
+    std::shared_ptr<SpineBitmap> AcquireLocked(const SpineManager* owner, int32_t width, int32_t height);
+
+    struct Entry {
+        std::shared_ptr<SpineBitmap> bitmap;
+        std::list<const SpineManager*>::iterator lruIt;
+    };
+
+    // 默认预算 32MB
+    size_t budgetBytes_ = 32 * 1024 * 1024;
+    size_t usageBytes_ = 0;
+
+    std::unordered_map<const SpineManager*, Entry> entries_;
+    std::list<const SpineManager*> lru_;  // 表头为最近使用
+    mutable std::mutex cacheMutex_;
+};
+
+#endif //SPINEHM_SPINEBITMAPCACHE_H
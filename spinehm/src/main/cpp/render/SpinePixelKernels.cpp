@@ -0,0 +1,156 @@
+//
+// Created on 2026/10/19.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+/**
+ * SpinePixelKernels.cpp - 图集页面像素转换内核实现
+ * 乘积 p = c * a 按 (p + 128 + ((p + 128) >> 8)) >> 8 取整，等于 c * a / 255 四舍五入，
+ * 中间值不超过 16 位，向量实现在 16 位通道上按同一公式计算。
+ */
+
+#include "SpinePixelKernels.h"
+#include "render/SpineVertexKernels.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define SPINE_KERNELS_SSE2 1
+#endif
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#define SPINE_KERNELS_AVX2 1
+#endif
+
+#if defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define SPINE_KERNELS_NEON 1
+#endif
+
+namespace {
+
+inline uint8_t MulDiv255(uint32_t c, uint32_t a) {
+    uint32_t t = c * a + 128;
+    return static_cast<uint8_t>((t + (t >> 8)) >> 8);
+}
+
+#if SPINE_KERNELS_SSE2
+
+// 16 位通道上的 RGBA 乘以 AAA255 并按 1/255 取整
+inline __m128i PremultiplyWords(__m128i px) {
+    const __m128i alphaLane = _mm_set_epi16(-1, 0, 0, 0, -1, 0, 0, 0);
+    const __m128i round = _mm_set1_epi16(128);
+    __m128i alpha = _mm_shufflehi_epi16(_mm_shufflelo_epi16(px, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+    __m128i factor = _mm_or_si128(_mm_andnot_si128(alphaLane, alpha), _mm_and_si128(alphaLane, _mm_set1_epi16(255)));
+    __m128i t = _mm_add_epi16(_mm_mullo_epi16(px, factor), round);
+    return _mm_srli_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), 8);
+}
+
+void PremultiplyRgbaSse2(const uint8_t* src, uint8_t* dst, size_t pixelCount) {
+    const __m128i zero = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 4 <= pixelCount; i += 4) {
+        __m128i px = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * 4));
+        __m128i lo = PremultiplyWords(_mm_unpacklo_epi8(px, zero));
+        __m128i hi = PremultiplyWords(_mm_unpackhi_epi8(px, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i * 4), _mm_packus_epi16(lo, hi));
+    }
+    SpinePixelKernels::PremultiplyRgbaScalar(src + i * 4, dst + i * 4, pixelCount - i);
+}
+
+#endif // SPINE_KERNELS_SSE2
+
+#if SPINE_KERNELS_AVX2
+
+__attribute__((target("avx2")))
+inline __m256i PremultiplyWordsAvx2(__m256i px) {
+    const __m256i alphaLane = _mm256_set_epi16(-1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0);
+    const __m256i round = _mm256_set1_epi16(128);
+    __m256i alpha =
+        _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(px, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+    __m256i factor =
+        _mm256_or_si256(_mm256_andnot_si256(alphaLane, alpha), _mm256_and_si256(alphaLane, _mm256_set1_epi16(255)));
+    __m256i t = _mm256_add_epi16(_mm256_mullo_epi16(px, factor), round);
+    return _mm256_srli_epi16(_mm256_add_epi16(t, _mm256_srli_epi16(t, 8)), 8);
+}
+
+__attribute__((target("avx2")))
+void PremultiplyRgbaAvx2(const uint8_t* src, uint8_t* dst, size_t pixelCount) {
+    const __m256i zero = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 8 <= pixelCount; i += 8) {
+        // 解包与打包都按 128 位分半进行，像素顺序不变
+        __m256i px = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i * 4));
+        __m256i lo = PremultiplyWordsAvx2(_mm256_unpacklo_epi8(px, zero));
+        __m256i hi = PremultiplyWordsAvx2(_mm256_unpackhi_epi8(px, zero));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i * 4), _mm256_packus_epi16(lo, hi));
+    }
+    SpinePixelKernels::PremultiplyRgbaScalar(src + i * 4, dst + i * 4, pixelCount - i);
+}
+
+#endif // SPINE_KERNELS_AVX2
+
+#if SPINE_KERNELS_NEON
+
+// (p + ((p + 128) >> 8) + 128) >> 8，与标量公式相同
+inline uint8x8_t MulDiv255Neon(uint8x8_t c, uint8x8_t a) {
+    uint16x8_t p = vmull_u8(c, a);
+    return vraddhn_u16(p, vrshrq_n_u16(p, 8));
+}
+
+void PremultiplyRgbaNeon(const uint8_t* src, uint8_t* dst, size_t pixelCount) {
+    size_t i = 0;
+    for (; i + 8 <= pixelCount; i += 8) {
+        uint8x8x4_t px = vld4_u8(src + i * 4);
+        px.val[0] = MulDiv255Neon(px.val[0], px.val[3]);
+        px.val[1] = MulDiv255Neon(px.val[1], px.val[3]);
+        px.val[2] = MulDiv255Neon(px.val[2], px.val[3]);
+        vst4_u8(dst + i * 4, px);
+    }
+    SpinePixelKernels::PremultiplyRgbaScalar(src + i * 4, dst + i * 4, pixelCount - i);
+}
+
+#endif // SPINE_KERNELS_NEON
+
+} // namespace
+
+namespace SpinePixelKernels {
+
+void PremultiplyRgbaScalar(const uint8_t* src, uint8_t* dst, size_t pixelCount) {
+    for (size_t i = 0; i < pixelCount; ++i) {
+        const uint8_t* s = src + i * 4;
+        uint8_t* d = dst + i * 4;
+        const uint32_t a = s[3];
+        d[0] = MulDiv255(s[0], a);
+        d[1] = MulDiv255(s[1], a);
+        d[2] = MulDiv255(s[2], a);
+        d[3] = static_cast<uint8_t>(a);
+    }
+}
+
+void PremultiplyRgba(const uint8_t* src, uint8_t* dst, size_t pixelCount) {
+    using SpineVertexKernels::SimdLevel;
+    switch (SpineVertexKernels::GetSimdLevel()) {
+#if SPINE_KERNELS_AVX2
+        case SimdLevel::kAvx2:
+            PremultiplyRgbaAvx2(src, dst, pixelCount);
+            return;
+#endif
+#if SPINE_KERNELS_SSE2
+        case SimdLevel::kSse2:
+            PremultiplyRgbaSse2(src, dst, pixelCount);
+            return;
+#endif
+#if SPINE_KERNELS_NEON
+        case SimdLevel::kNeon:
+            PremultiplyRgbaNeon(src, dst, pixelCount);
+            return;
+#endif
+        default:
+            PremultiplyRgbaScalar(src, dst, pixelCount);
+            return;
+    }
+}
+
+} // namespace SpinePixelKernels
@@ -0,0 +1,34 @@
+//
+// Created on 2026/10/19.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#ifndef SPINEHM_SPINEPIXELKERNELS_H
+#define SPINEHM_SPINEPIXELKERNELS_H
+/**
+ * SpinePixelKernels - 图集页面像素转换内核
+ * 按 SpineVertexKernels 的指令集级别选择 AVX2 / SSE2 / NEON 实现，整数运算，结果与标量逐字节一致。
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+namespace SpinePixelKernels {
+
+/**
+ * 预乘 Alpha：RGB 各分量乘以 A / 255 并四舍五入，A 不变
+ * @param src RGBA8888 像素
+ * @param dst 输出（可与 src 相同）
+ * @param pixelCount 像素数
+ */
+void PremultiplyRgba(const uint8_t* src, uint8_t* dst, size_t pixelCount);
+
+/**
+ * 标量实现（作为对比基准）
+ */
+void PremultiplyRgbaScalar(const uint8_t* src, uint8_t* dst, size_t pixelCount);
+
+} // namespace SpinePixelKernels
+
+#endif //SPINEHM_SPINEPIXELKERNELS_H
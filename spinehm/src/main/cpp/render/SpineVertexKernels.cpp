@@ -0,0 +1,537 @@
+//
+// Created on 2026/10/19.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+/**
+ * SpineVertexKernels.cpp - 世界顶点计算内核实现
+ * 本文件以 -ffp-contract=off 编译（见 CMakeLists.txt），保证标量与向量实现逐位一致。
+ */
+
+#include "SpineVertexKernels.h"
+#include <atomic>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define SPINE_KERNELS_SSE2 1
+#endif
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#define SPINE_KERNELS_AVX2 1
+#endif
+
+// armv7 的 NEON 会把非规格化数刷成 0，与标量结果不一致，只在 aarch64 上启用
+#if defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define SPINE_KERNELS_NEON 1
+#endif
+
+namespace SpineVertexKernels {
+
+namespace {
+
+std::atomic<int> g_simdLevel{-1};
+
+SimdLevel CurrentLevel() {
+    int level = g_simdLevel.load(std::memory_order_relaxed);
+    if (level < 0) {
+        level = static_cast<int>(DetectSimdLevel());
+        g_simdLevel.store(level, std::memory_order_relaxed);
+    }
+    return static_cast<SimdLevel>(level);
+}
+
+/**
+ * 将交错的 x、y 结果按输出间隔写出
+ */
+inline void ScatterPairs(const float* pairs, size_t count, float* out, size_t stride) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i * stride] = pairs[i * 2];
+        out[i * stride + 1] = pairs[i * 2 + 1];
+    }
+}
+
+inline float DeformAt(const float* deform, int32_t index, int32_t component) {
+    return index >= 0 ? deform[index + component] : 0.0f;
+}
+
+#if SPINE_KERNELS_SSE2
+
+void TransformVerticesSse2(const BoneTransform& bone, const float* local, size_t count, float* out, size_t stride) {
+    const __m128 a = _mm_set1_ps(bone.a);
+    const __m128 b = _mm_set1_ps(bone.b);
+    const __m128 c = _mm_set1_ps(bone.c);
+    const __m128 d = _mm_set1_ps(bone.d);
+    const __m128 worldX = _mm_set1_ps(bone.worldX);
+    const __m128 worldY = _mm_set1_ps(bone.worldY);
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128 v01 = _mm_loadu_ps(local + i * 2);
+        __m128 v23 = _mm_loadu_ps(local + i * 2 + 4);
+        __m128 x = _mm_shuffle_ps(v01, v23, _MM_SHUFFLE(2, 0, 2, 0));
+        __m128 y = _mm_shuffle_ps(v01, v23, _MM_SHUFFLE(3, 1, 3, 1));
+
+        __m128 ox = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, a), _mm_mul_ps(y, b)), worldX);
+        __m128 oy = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, c), _mm_mul_ps(y, d)), worldY);
+
+        __m128 lo = _mm_unpacklo_ps(ox, oy);
+        __m128 hi = _mm_unpackhi_ps(ox, oy);
+        if (stride == 2) {
+            _mm_storeu_ps(out + i * 2, lo);
+            _mm_storeu_ps(out + i * 2 + 4, hi);
+        } else {
+            float pairs[8];
+            _mm_storeu_ps(pairs, lo);
+            _mm_storeu_ps(pairs + 4, hi);
+            ScatterPairs(pairs, 4, out + i * stride, stride);
+        }
+    }
+
+    TransformVerticesScalar(bone, local + i * 2, count - i, out + i * stride, stride);
+}
+
+void SkinVertices4Sse2(const BoneTransform* bones, const SkinnedVertex4* vertices, size_t count,
+                       const float* deform, float* out, size_t stride) {
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const SkinnedVertex4* v = vertices + i;
+
+        // 转置后 x[k] 为 4 个顶点的第 k 个影响
+        __m128 x[4] = {_mm_loadu_ps(v[0].x), _mm_loadu_ps(v[1].x), _mm_loadu_ps(v[2].x), _mm_loadu_ps(v[3].x)};
+        __m128 y[4] = {_mm_loadu_ps(v[0].y), _mm_loadu_ps(v[1].y), _mm_loadu_ps(v[2].y), _mm_loadu_ps(v[3].y)};
+        __m128 w[4] = {_mm_loadu_ps(v[0].weights), _mm_loadu_ps(v[1].weights), _mm_loadu_ps(v[2].weights),
+                       _mm_loadu_ps(v[3].weights)};
+        _MM_TRANSPOSE4_PS(x[0], x[1], x[2], x[3]);
+        _MM_TRANSPOSE4_PS(y[0], y[1], y[2], y[3]);
+        _MM_TRANSPOSE4_PS(w[0], w[1], w[2], w[3]);
+
+        __m128 wx = _mm_setzero_ps();
+        __m128 wy = _mm_setzero_ps();
+        for (int k = 0; k < 4; ++k) {
+            const BoneTransform& b0 = bones[v[0].bones[k]];
+            const BoneTransform& b1 = bones[v[1].bones[k]];
+            const BoneTransform& b2 = bones[v[2].bones[k]];
+            const BoneTransform& b3 = bones[v[3].bones[k]];
+
+            __m128 ma = _mm_loadu_ps(&b0.a);
+            __m128 mb = _mm_loadu_ps(&b1.a);
+            __m128 mc = _mm_loadu_ps(&b2.a);
+            __m128 md = _mm_loadu_ps(&b3.a);
+            _MM_TRANSPOSE4_PS(ma, mb, mc, md);
+            __m128 worldX = _mm_setr_ps(b0.worldX, b1.worldX, b2.worldX, b3.worldX);
+            __m128 worldY = _mm_setr_ps(b0.worldY, b1.worldY, b2.worldY, b3.worldY);
+
+            __m128 vx = x[k];
+            __m128 vy = y[k];
+            if (deform) {
+                vx = _mm_add_ps(vx, _mm_setr_ps(DeformAt(deform, v[0].deformIndex[k], 0),
+                                                DeformAt(deform, v[1].deformIndex[k], 0),
+                                                DeformAt(deform, v[2].deformIndex[k], 0),
+                                                DeformAt(deform, v[3].deformIndex[k], 0)));
+                vy = _mm_add_ps(vy, _mm_setr_ps(DeformAt(deform, v[0].deformIndex[k], 1),
+                                                DeformAt(deform, v[1].deformIndex[k], 1),
+                                                DeformAt(deform, v[2].deformIndex[k], 1),
+                                                DeformAt(deform, v[3].deformIndex[k], 1)));
+            }
+
+            __m128 px = _mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, ma), _mm_mul_ps(vy, mb)), worldX);
+            __m128 py = _mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, mc), _mm_mul_ps(vy, md)), worldY);
+            wx = _mm_add_ps(wx, _mm_mul_ps(px, w[k]));
+            wy = _mm_add_ps(wy, _mm_mul_ps(py, w[k]));
+        }
+
+        __m128 lo = _mm_unpacklo_ps(wx, wy);
+        __m128 hi = _mm_unpackhi_ps(wx, wy);
+        if (stride == 2) {
+            _mm_storeu_ps(out + i * 2, lo);
+            _mm_storeu_ps(out + i * 2 + 4, hi);
+        } else {
+            float pairs[8];
+            _mm_storeu_ps(pairs, lo);
+            _mm_storeu_ps(pairs + 4, hi);
+            ScatterPairs(pairs, 4, out + i * stride, stride);
+        }
+    }
+
+    SkinVertices4Scalar(bones, vertices + i, count - i, deform, out + i * stride, stride);
+}
+
+#endif // SPINE_KERNELS_SSE2
+
+#if SPINE_KERNELS_AVX2
+
+__attribute__((target("avx2")))
+void TransformVerticesAvx2(const BoneTransform& bone, const float* local, size_t count, float* out, size_t stride) {
+    const __m256 a = _mm256_set1_ps(bone.a);
+    const __m256 b = _mm256_set1_ps(bone.b);
+    const __m256 c = _mm256_set1_ps(bone.c);
+    const __m256 d = _mm256_set1_ps(bone.d);
+    const __m256 worldX = _mm256_set1_ps(bone.worldX);
+    const __m256 worldY = _mm256_set1_ps(bone.worldY);
+
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256 v0 = _mm256_loadu_ps(local + i * 2);
+        __m256 v1 = _mm256_loadu_ps(local + i * 2 + 8);
+        // 每个 128 位通道内取偶/奇元素，顶点顺序在下方交错时还原
+        __m256 x = _mm256_shuffle_ps(v0, v1, _MM_SHUFFLE(2, 0, 2, 0));
+        __m256 y = _mm256_shuffle_ps(v0, v1, _MM_SHUFFLE(3, 1, 3, 1));
+
+        __m256 ox = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, a), _mm256_mul_ps(y, b)), worldX);
+        __m256 oy = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, c), _mm256_mul_ps(y, d)), worldY);
+
+        __m256 lo = _mm256_unpacklo_ps(ox, oy);
+        __m256 hi = _mm256_unpackhi_ps(ox, oy);
+        if (stride == 2) {
+            _mm256_storeu_ps(out + i * 2, lo);
+            _mm256_storeu_ps(out + i * 2 + 8, hi);
+        } else {
+            float pairs[16];
+            _mm256_storeu_ps(pairs, lo);
+            _mm256_storeu_ps(pairs + 8, hi);
+            ScatterPairs(pairs, 8, out + i * stride, stride);
+        }
+    }
+
+    TransformVerticesScalar(bone, local + i * 2, count - i, out + i * stride, stride);
+}
+
+__attribute__((target("avx2")))
+void SkinVertices4Avx2(const BoneTransform* bones, const SkinnedVertex4* vertices, size_t count,
+                       const float* deform, float* out, size_t stride) {
+    constexpr int kVertexFloats = static_cast<int>(sizeof(SkinnedVertex4) / sizeof(float));
+    constexpr int kBoneFloats = static_cast<int>(sizeof(BoneTransform) / sizeof(float));
+    const __m256i vertexOffsets = _mm256_setr_epi32(0, kVertexFloats, 2 * kVertexFloats, 3 * kVertexFloats,
+                                                    4 * kVertexFloats, 5 * kVertexFloats, 6 * kVertexFloats,
+                                                    7 * kVertexFloats);
+    const __m256i boneFloats = _mm256_set1_epi32(kBoneFloats);
+    const float* boneBase = &bones[0].a;
+
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const float* vbase = reinterpret_cast<const float*>(vertices + i);
+        const int* ibase = reinterpret_cast<const int*>(vertices + i);
+
+        __m256 wx = _mm256_setzero_ps();
+        __m256 wy = _mm256_setzero_ps();
+        for (int k = 0; k < 4; ++k) {
+            __m256i boneIndex = _mm256_i32gather_epi32(ibase + offsetof(SkinnedVertex4, bones) / 4 + k,
+                                                       vertexOffsets, 4);
+            __m256i boneOffset = _mm256_mullo_epi32(boneIndex, boneFloats);
+            __m256 ma = _mm256_i32gather_ps(boneBase + 0, boneOffset, 4);
+            __m256 mb = _mm256_i32gather_ps(boneBase + 1, boneOffset, 4);
+            __m256 mc = _mm256_i32gather_ps(boneBase + 2, boneOffset, 4);
+            __m256 md = _mm256_i32gather_ps(boneBase + 3, boneOffset, 4);
+            __m256 worldX = _mm256_i32gather_ps(boneBase + 4, boneOffset, 4);
+            __m256 worldY = _mm256_i32gather_ps(boneBase + 5, boneOffset, 4);
+
+            __m256 vx = _mm256_i32gather_ps(vbase + offsetof(SkinnedVertex4, x) / 4 + k, vertexOffsets, 4);
+            __m256 vy = _mm256_i32gather_ps(vbase + offsetof(SkinnedVertex4, y) / 4 + k, vertexOffsets, 4);
+            __m256 weight = _mm256_i32gather_ps(vbase + offsetof(SkinnedVertex4, weights) / 4 + k, vertexOffsets, 4);
+            if (deform) {
+                __m256i deformIndex = _mm256_i32gather_epi32(ibase + offsetof(SkinnedVertex4, deformIndex) / 4 + k,
+                                                             vertexOffsets, 4);
+                __m256 mask = _mm256_castsi256_ps(_mm256_cmpgt_epi32(deformIndex, _mm256_set1_epi32(-1)));
+                vx = _mm256_add_ps(vx, _mm256_mask_i32gather_ps(_mm256_setzero_ps(), deform, deformIndex, mask, 4));
+                vy = _mm256_add_ps(vy, _mm256_mask_i32gather_ps(_mm256_setzero_ps(), deform + 1, deformIndex, mask, 4));
+            }
+
+            __m256 px = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(vx, ma), _mm256_mul_ps(vy, mb)), worldX);
+            __m256 py = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(vx, mc), _mm256_mul_ps(vy, md)), worldY);
+            wx = _mm256_add_ps(wx, _mm256_mul_ps(px, weight));
+            wy = _mm256_add_ps(wy, _mm256_mul_ps(py, weight));
+        }
+
+        // unpack 结果为 (v0 v1 | v4 v5) 与 (v2 v3 | v6 v7)，跨通道重排回顶点顺序
+        __m256 ul = _mm256_unpacklo_ps(wx, wy);
+        __m256 uh = _mm256_unpackhi_ps(wx, wy);
+        __m256 lo = _mm256_permute2f128_ps(ul, uh, 0x20);
+        __m256 hi = _mm256_permute2f128_ps(ul, uh, 0x31);
+        if (stride == 2) {
+            _mm256_storeu_ps(out + i * 2, lo);
+            _mm256_storeu_ps(out + i * 2 + 8, hi);
+        } else {
+            float pairs[16];
+            _mm256_storeu_ps(pairs, lo);
+            _mm256_storeu_ps(pairs + 8, hi);
+            ScatterPairs(pairs, 8, out + i * stride, stride);
+        }
+    }
+
+    SkinVertices4Scalar(bones, vertices + i, count - i, deform, out + i * stride, stride);
+}
+
+#endif // SPINE_KERNELS_AVX2
+
+#if SPINE_KERNELS_NEON
+
+inline void TransposeNeon(float32x4_t& r0, float32x4_t& r1, float32x4_t& r2, float32x4_t& r3) {
+    float32x4x2_t t01 = vtrnq_f32(r0, r1);
+    float32x4x2_t t23 = vtrnq_f32(r2, r3);
+    r0 = vcombine_f32(vget_low_f32(t01.val[0]), vget_low_f32(t23.val[0]));
+    r1 = vcombine_f32(vget_low_f32(t01.val[1]), vget_low_f32(t23.val[1]));
+    r2 = vcombine_f32(vget_high_f32(t01.val[0]), vget_high_f32(t23.val[0]));
+    r3 = vcombine_f32(vget_high_f32(t01.val[1]), vget_high_f32(t23.val[1]));
+}
+
+void TransformVerticesNeon(const BoneTransform& bone, const float* local, size_t count, float* out, size_t stride) {
+    const float32x4_t a = vdupq_n_f32(bone.a);
+    const float32x4_t b = vdupq_n_f32(bone.b);
+    const float32x4_t c = vdupq_n_f32(bone.c);
+    const float32x4_t d = vdupq_n_f32(bone.d);
+    const float32x4_t worldX = vdupq_n_f32(bone.worldX);
+    const float32x4_t worldY = vdupq_n_f32(bone.worldY);
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        float32x4x2_t xy = vld2q_f32(local + i * 2);
+
+        float32x4x2_t result;
+        result.val[0] = vaddq_f32(vaddq_f32(vmulq_f32(xy.val[0], a), vmulq_f32(xy.val[1], b)), worldX);
+        result.val[1] = vaddq_f32(vaddq_f32(vmulq_f32(xy.val[0], c), vmulq_f32(xy.val[1], d)), worldY);
+        if (stride == 2) {
+            vst2q_f32(out + i * 2, result);
+        } else {
+            float pairs[8];
+            vst2q_f32(pairs, result);
+            ScatterPairs(pairs, 4, out + i * stride, stride);
+        }
+    }
+
+    TransformVerticesScalar(bone, local + i * 2, count - i, out + i * stride, stride);
+}
+
+void SkinVertices4Neon(const BoneTransform* bones, const SkinnedVertex4* vertices, size_t count,
+                       const float* deform, float* out, size_t stride) {
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const SkinnedVertex4* v = vertices + i;
+
+        float32x4_t x[4] = {vld1q_f32(v[0].x), vld1q_f32(v[1].x), vld1q_f32(v[2].x), vld1q_f32(v[3].x)};
+        float32x4_t y[4] = {vld1q_f32(v[0].y), vld1q_f32(v[1].y), vld1q_f32(v[2].y), vld1q_f32(v[3].y)};
+        float32x4_t w[4] = {vld1q_f32(v[0].weights), vld1q_f32(v[1].weights), vld1q_f32(v[2].weights),
+                            vld1q_f32(v[3].weights)};
+        TransposeNeon(x[0], x[1], x[2], x[3]);
+        TransposeNeon(y[0], y[1], y[2], y[3]);
+        TransposeNeon(w[0], w[1], w[2], w[3]);
+
+        float32x4_t wx = vdupq_n_f32(0.0f);
+        float32x4_t wy = vdupq_n_f32(0.0f);
+        for (int k = 0; k < 4; ++k) {
+            const BoneTransform& b0 = bones[v[0].bones[k]];
+            const BoneTransform& b1 = bones[v[1].bones[k]];
+            const BoneTransform& b2 = bones[v[2].bones[k]];
+            const BoneTransform& b3 = bones[v[3].bones[k]];
+
+            float32x4_t ma = vld1q_f32(&b0.a);
+            float32x4_t mb = vld1q_f32(&b1.a);
+            float32x4_t mc = vld1q_f32(&b2.a);
+            float32x4_t md = vld1q_f32(&b3.a);
+            TransposeNeon(ma, mb, mc, md);
+            const float worldXs[4] = {b0.worldX, b1.worldX, b2.worldX, b3.worldX};
+            const float worldYs[4] = {b0.worldY, b1.worldY, b2.worldY, b3.worldY};
+            float32x4_t worldX = vld1q_f32(worldXs);
+            float32x4_t worldY = vld1q_f32(worldYs);
+
+            float32x4_t vx = x[k];
+            float32x4_t vy = y[k];
+            if (deform) {
+                const float dx[4] = {DeformAt(deform, v[0].deformIndex[k], 0), DeformAt(deform, v[1].deformIndex[k], 0),
+                                     DeformAt(deform, v[2].deformIndex[k], 0), DeformAt(deform, v[3].deformIndex[k], 0)};
+                const float dy[4] = {DeformAt(deform, v[0].deformIndex[k], 1), DeformAt(deform, v[1].deformIndex[k], 1),
+                                     DeformAt(deform, v[2].deformIndex[k], 1), DeformAt(deform, v[3].deformIndex[k], 1)};
+                vx = vaddq_f32(vx, vld1q_f32(dx));
+                vy = vaddq_f32(vy, vld1q_f32(dy));
+            }
+
+            // 分开的乘、加（不用 vmlaq/vfmaq），与标量舍入一致
+            float32x4_t px = vaddq_f32(vaddq_f32(vmulq_f32(vx, ma), vmulq_f32(vy, mb)), worldX);
+            float32x4_t py = vaddq_f32(vaddq_f32(vmulq_f32(vx, mc), vmulq_f32(vy, md)), worldY);
+            wx = vaddq_f32(wx, vmulq_f32(px, w[k]));
+            wy = vaddq_f32(wy, vmulq_f32(py, w[k]));
+        }
+
+        float32x4x2_t result = {{wx, wy}};
+        if (stride == 2) {
+            vst2q_f32(out + i * 2, result);
+        } else {
+            float pairs[8];
+            vst2q_f32(pairs, result);
+            ScatterPairs(pairs, 4, out + i * stride, stride);
+        }
+    }
+
+    SkinVertices4Scalar(bones, vertices + i, count - i, deform, out + i * stride, stride);
+}
+
+#endif // SPINE_KERNELS_NEON
+
+} // namespace
+
+// ==================== 指令集选择 ====================
+
+SimdLevel DetectSimdLevel() {
+#if SPINE_KERNELS_AVX2
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return SimdLevel::kAvx2;
+    }
+#endif
+#if SPINE_KERNELS_SSE2
+    return SimdLevel::kSse2;
+#elif SPINE_KERNELS_NEON
+    return SimdLevel::kNeon;
+#else
+    return SimdLevel::kScalar;
+#endif
+}
+
+SimdLevel GetSimdLevel() {
+    return CurrentLevel();
+}
+
+SimdLevel SetSimdLevel(SimdLevel level) {
+    const SimdLevel detected = DetectSimdLevel();
+    bool supported = level == SimdLevel::kScalar || level == detected ||
+                     (level == SimdLevel::kSse2 && detected == SimdLevel::kAvx2);
+    SimdLevel active = supported ? level : detected;
+    g_simdLevel.store(static_cast<int>(active), std::memory_order_relaxed);
+    return active;
+}
+
+const char* GetSimdLevelName(SimdLevel level) {
+    switch (level) {
+        case SimdLevel::kSse2:
+            return "sse2";
+        case SimdLevel::kAvx2:
+            return "avx2";
+        case SimdLevel::kNeon:
+            return "neon";
+        default:
+            return "scalar";
+    }
+}
+
+// ==================== 对外接口 ====================
+
+void TransformVertices(const BoneTransform& bone, const float* local, size_t count, float* out, size_t stride) {
+    switch (CurrentLevel()) {
+#if SPINE_KERNELS_AVX2
+        case SimdLevel::kAvx2:
+            TransformVerticesAvx2(bone, local, count, out, stride);
+            return;
+#endif
+#if SPINE_KERNELS_SSE2
+        case SimdLevel::kSse2:
+            TransformVerticesSse2(bone, local, count, out, stride);
+            return;
+#endif
+#if SPINE_KERNELS_NEON
+        case SimdLevel::kNeon:
+            TransformVerticesNeon(bone, local, count, out, stride);
+            return;
+#endif
+        default:
+            TransformVerticesScalar(bone, local, count, out, stride);
+            return;
+    }
+}
+
+void SkinVertices4(const BoneTransform* bones, const SkinnedVertex4* vertices, size_t count, const float* deform,
+                   float* out, size_t stride) {
+    switch (CurrentLevel()) {
+#if SPINE_KERNELS_AVX2
+        case SimdLevel::kAvx2:
+            SkinVertices4Avx2(bones, vertices, count, deform, out, stride);
+            return;
+#endif
+#if SPINE_KERNELS_SSE2
+        case SimdLevel::kSse2:
+            SkinVertices4Sse2(bones, vertices, count, deform, out, stride);
+            return;
+#endif
+#if SPINE_KERNELS_NEON
+        case SimdLevel::kNeon:
+            SkinVertices4Neon(bones, vertices, count, deform, out, stride);
+            return;
+#endif
+        default:
+            SkinVertices4Scalar(bones, vertices, count, deform, out, stride);
+            return;
+    }
+}
+
+void TransformVerticesScalar(const BoneTransform& bone, const float* local, size_t count, float* out, size_t stride) {
+    for (size_t i = 0; i < count; ++i) {
+        const float x = local[i * 2];
+        const float y = local[i * 2 + 1];
+        out[i * stride] = x * bone.a + y * bone.b + bone.worldX;
+        out[i * stride + 1] = x * bone.c + y * bone.d + bone.worldY;
+    }
+}
+
+void SkinVertices4Scalar(const BoneTransform* bones, const SkinnedVertex4* vertices, size_t count,
+                         const float* deform, float* out, size_t stride) {
+    for (size_t i = 0; i < count; ++i) {
+        const SkinnedVertex4& v = vertices[i];
+        float wx = 0.0f;
+        float wy = 0.0f;
+        for (int k = 0; k < 4; ++k) {
+            const BoneTransform& bone = bones[v.bones[k]];
+            float vx = v.x[k];
+            float vy = v.y[k];
+            if (deform) {
+                vx = vx + DeformAt(deform, v.deformIndex[k], 0);
+                vy = vy + DeformAt(deform, v.deformIndex[k], 1);
+            }
+            wx = wx + (vx * bone.a + vy * bone.b + bone.worldX) * v.weights[k];
+            wy = wy + (vx * bone.c + vy * bone.d + bone.worldY) * v.weights[k];
+        }
+        out[i * stride] = wx;
+        out[i * stride + 1] = wy;
+    }
+}
+
+bool PackWeightedVertices(const int32_t* boneData, size_t boneDataSize, const float* vertexData,
+                          size_t vertexDataSize, std::vector<SkinnedVertex4>* out) {
+    out->clear();
+
+    size_t b = 0;
+    size_t v = 0;
+    int32_t influence = 0;
+    while (b < boneDataSize) {
+        const int32_t n = boneData[b++];
+        if (n <= 0 || n > 4 || b + n > boneDataSize || v + static_cast<size_t>(n) * 3 > vertexDataSize) {
+            out->clear();
+            return false;
+        }
+
+        SkinnedVertex4 packed;
+        for (int32_t k = 0; k < 4; ++k) {
+            if (k < n) {
+                packed.bones[k] = boneData[b + k];
+                packed.x[k] = vertexData[v];
+                packed.y[k] = vertexData[v + 1];
+                packed.weights[k] = vertexData[v + 2];
+                packed.deformIndex[k] = influence * 2;
+                v += 3;
+                influence++;
+            } else {
+                // 填充的影响权重为 0，指向本顶点的第一根骨骼以保证下标有效
+                packed.bones[k] = packed.bones[0];
+                packed.x[k] = 0.0f;
+                packed.y[k] = 0.0f;
+                packed.weights[k] = 0.0f;
+                packed.deformIndex[k] = -1;
+            }
+        }
+        b += n;
+        out->push_back(packed);
+    }
+    return true;
+}
+
+} // namespace SpineVertexKernels
@@ -0,0 +1,118 @@
+//
+// Created on 2026/10/19.
+//
+// Node APIs are not fully supported. To solve the compilation error of the interface cannot be found,
+// please include "napi/native_api.h".
+
+#ifndef SPINEHM_SPINEVERTEXKERNELS_H
+#define SPINEHM_SPINEVERTEXKERNELS_H
+/**
+ * SpineVertexKernels - 世界顶点计算内核
+ * 区域/非加权网格的顶点变换与最多 4 骨骼的加权蒙皮，
+ * 运行时按 CPU 选择 AVX2 / SSE2 / NEON 实现，不支持时使用标量实现。
+ *
+ * 所有实现按与标量相同的顺序做乘加（本文件禁止 FMA 合并），结果逐位一致。
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace SpineVertexKernels {
+
+/**
+ * 骨骼世界变换（对应 spine::Bone 的 a、b、c、d、worldX、worldY）
+ */
+struct BoneTransform {
+    float a;
+    float b;
+    float c;
+    float d;
+    float worldX;
+    float worldY;
+};
+
+/**
+ * 固定 4 影响的加权顶点（加载时由 Spine 的变长格式打包，不足 4 个的影响权重为 0）
+ */
+struct SkinnedVertex4 {
+    int32_t bones[4];
+    float x[4];
+    float y[4];
+    float weights[4];
+    int32_t deformIndex[4];  // 在顶点变形数组中的下标，填充的影响为 -1
+};
+
+/**
+ * 指令集级别
+ */
+enum class SimdLevel {
+    kScalar = 0,
+    kSse2,
+    kAvx2,
+    kNeon,
+};
+
+/**
+ * 检测当前 CPU 支持的最高级别
+ */
+SimdLevel DetectSimdLevel();
+
+/**
+ * 获取当前使用的级别
+ */
+SimdLevel GetSimdLevel();
+
+/**
+ * 指定使用的级别（用于与标量结果对比或基准测试），不支持的级别回退到检测结果
+ * @param level 指令集级别
+ * @return 实际使用的级别
+ */
+SimdLevel SetSimdLevel(SimdLevel level);
+
+const char* GetSimdLevelName(SimdLevel level);
+
+/**
+ * 非加权顶点变换：out = (x * a + y * b + worldX, x * c + y * d + worldY)
+ * @param bone 骨骼世界变换
+ * @param local 局部坐标（x、y 交错）
+ * @param count 顶点数
+ * @param out 输出缓冲（直接写入批次顶点缓冲）
+ * @param stride 输出中相邻顶点的间隔（浮点数，至少为 2）
+ */
+void TransformVertices(const BoneTransform& bone, const float* local, size_t count, float* out, size_t stride);
+
+/**
+ * 加权蒙皮：out = Σ (vx * a + vy * b + worldX) * weight，按影响顺序累加
+ * @param bones 骨骼世界变换数组
+ * @param vertices 加权顶点
+ * @param count 顶点数
+ * @param deform 顶点变形偏移（可为 nullptr）
+ * @param out 输出缓冲
+ * @param stride 输出中相邻顶点的间隔（浮点数，至少为 2）
+ */
+void SkinVertices4(const BoneTransform* bones, const SkinnedVertex4* vertices, size_t count, const float* deform,
+                   float* out, size_t stride);
+
+/**
+ * 标量实现（作为对比基准）
+ */
+void TransformVerticesScalar(const BoneTransform& bone, const float* local, size_t count, float* out, size_t stride);
+void SkinVertices4Scalar(const BoneTransform* bones, const SkinnedVertex4* vertices, size_t count,
+                         const float* deform, float* out, size_t stride);
+
+/**
+ * 将 Spine 的变长加权格式打包为固定 4 影响格式
+ * @param boneData Spine 的骨骼数组（每个顶点：影响数 n，随后 n 个骨骼下标）
+ * @param boneDataSize 骨骼数组长度
+ * @param vertexData Spine 的顶点数组（每个影响：x、y、weight）
+ * @param vertexDataSize 顶点数组长度
+ * @param out 输出
+ * @return 是否打包成功（存在超过 4 个影响的顶点时返回 false，应使用通用路径）
+ */
+bool PackWeightedVertices(const int32_t* boneData, size_t boneDataSize, const float* vertexData,
+                          size_t vertexDataSize, std::vector<SkinnedVertex4>* out);
+
+} // namespace SpineVertexKernels
+
+#endif //SPINEHM_SPINEVERTEXKERNELS_H
@@ -6,8 +6,18 @@
 #include "spine_napi.h"
 #include <iostream>
 #include <memory>
+#include <algorithm>
+#include <cstring>
 #include "manager/SpineManager.h"
 #include "common/common.h"
+#include "render/SpineBitmapCache.h"
+#include "common/SpineCommandLog.h"
+#include "common/SpineEventBuffer.h"
+#include "common/SpineMemoryTracker.h"
+#include "common/SpineTrace.h"
+#include "manager/SpineClock.h"
+#include "manager/SpineFrameScheduler.h"
+#include "manager/SpineSpatialIndex.h"
 
 using namespace std;
 
@@ -18,6 +28,17 @@ static void GlobalSpineEventCallback(int32_t instanceId, const SpineAnimationEve
     SpineInstanceRegistry::getInstance().TriggerEvent(instanceId, event);
 }
 
+/**
+ * 录制一条命令（未录制时不构造命令）
+ */
+template <typename MakeCommand>
+static void RecordCommand(MakeCommand makeCommand) {
+    SpineCommandRecorder& recorder = SpineCommandRecorder::getInstance();
+    if (recorder.IsRecording()) {
+        recorder.Record(makeCommand());
+    }
+}
+
 /**
  * NAPI 模块初始化
  */
@@ -39,14 +60,18 @@ namespace SpineNapi {
 napi_value CreateSpineInstance(napi_env env, napi_callback_info info) {
     size_t argc = 1;
     napi_value args[1];
-    // napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
     
     string surfaceId = "";
     if (argc > 0) {
         SpineNapiUtils::ParseString(env, args[0], &surfaceId);
     }
     
-    int32_t instanceId = SpineInstanceFactory::CreateInstance(surfaceId);
+    SPINE_TRACE_SCOPE("napi.createSpineInstance", -1);
+    int32_t instanceId = SpineInstanceFactory::CreateInstance(env, surfaceId);
+    if (instanceId >= 0) {
+        RecordCommand([&] { return SpineCommand::Create(instanceId); });
+    }
     return SpineNapiUtils::CreateInt32(env, instanceId);
 }
 
@@ -56,14 +81,16 @@ napi_value CreateSpineInstance(napi_env env, napi_callback_info info) {
 napi_value DestroySpineInstance(napi_env env, napi_callback_info info) {
     size_t argc = 1;
     napi_value args[1];
-    // napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
     
     int32_t instanceId;
-    if (!SpineNapiUtils::ParseInt32(env, args[0], &instanceId)) {
+    if (argc < 1 || !SpineNapiUtils::ParseInt32(env, args[0], &instanceId)) {
         return SpineNapiUtils::ThrowTypeError(env, "Invalid instance ID");
     }
     
-    bool success = SpineInstanceFactory::DestroyInstance(instanceId);
+    SPINE_TRACE_SCOPE("napi.destroySpineInstance", instanceId);
+    RecordCommand([&] { return SpineCommand::Destroy(instanceId); });
+    bool success = SpineInstanceFactory::DestroyInstance(env, instanceId);
     return SpineNapiUtils::CreateBool(env, success);
 }
 
@@ -71,138 +98,1349 @@ napi_value DestroySpineInstance(napi_env env, napi_callback_info info) {
  * 设置事件回调
  */
 napi_value SetEventCallback(napi_env env, napi_callback_info info) {
+    size_t argc = 4;
+    napi_value args[4];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+    
+    int32_t instanceId;
+    if (argc < 2 || !SpineNapiUtils::ParseInt32(env, args[0], &instanceId)) {
+        return SpineNapiUtils::ThrowTypeError(env, "Invalid instance ID");
+    }
+    
+    // 可选的订阅掩码和用户事件名称白名单，未传时订阅全部事件
+    int32_t typeMask = static_cast<int32_t>(kSpineEventMaskAll);
+    std::vector<string> eventNames;
+    if (argc > 2 && !SpineNapiUtils::IsNullOrUndefined(env, args[2]) &&
+        !SpineNapiUtils::ParseInt32(env, args[2], &typeMask)) {
+        return SpineNapiUtils::ThrowTypeError(env, "Invalid event type mask");
+    }
+    if (argc > 3 && !SpineNapiUtils::IsNullOrUndefined(env, args[3]) &&
+        !SpineNapiUtils::ParseStringArray(env, args[3], &eventNames)) {
+        return SpineNapiUtils::ThrowTypeError(env, "Invalid event names");
+    }
+    SpineManager* manager = SpineInstanceRegistry::getInstance().GetInstance(env, instanceId);
+    if (!manager) {
+        return SpineNapiUtils::ThrowError(env, "Invalid instance ID");
+    }
+    
+    // 回调注册成功后才更新订阅，失败时保留原来的过滤条件
+    bool success = SpineInstanceRegistry::getInstance().SetEventCallback(env, instanceId, args[1]);
+    if (success) {
+        manager->SetEventFilter(static_cast<uint32_t>(typeMask), eventNames);
+    }
+    return SpineNapiUtils::CreateBool(env, success);
+}
+
+/**
+ * 获取事件投递统计
+ */
+napi_value GetEventStats(napi_env env, napi_callback_info info) {
+    size_t argc = 1;
+    napi_value args[1];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+    
+    int32_t instanceId;
+    if (argc < 1 || !SpineNapiUtils::ParseInt32(env, args[0], &instanceId)) {
+        return SpineNapiUtils::ThrowTypeError(env, "Invalid instance ID");
+    }
+    SPINE_TRACE_SCOPE("napi.getEventStats", instanceId);
+    SpineManager* manager = SpineInstanceRegistry::getInstance().GetInstance(env, instanceId);
+    if (!manager) {
+        return SpineNapiUtils::ThrowError(env, "Invalid instance ID");
+    }
+
+    SpineEventStats stats = manager->GetEventStats();
+    napi_value result = SpineNapiUtils::CreateObject(env);
+    SpineNapiUtils::SetNamedNumber(env, result, "delivered", static_cast<double>(stats.delivered));
+    SpineNapiUtils::SetNamedNumber(env, result, "filtered", static_cast<double>(stats.filtered));
+    return result;
+}
+
+/**
+ * 设置合并事件回调，传 null 恢复逐个事件投递
+ */
+napi_value SetEventBatchCallback(napi_env env, napi_callback_info info) {
+    size_t argc = 1;
+    napi_value args[1];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+    
+    if (argc < 1) {
+        return SpineNapiUtils::ThrowTypeError(env, "Invalid event batch callback");
+    }
+    bool disable = SpineNapiUtils::IsNullOrUndefined(env, args[0]);
+    if (!disable) {
+        napi_valuetype type;
+        if (napi_typeof(env, args[0], &type) != napi_ok || type != napi_function) {
+            return SpineNapiUtils::ThrowTypeError(env, "Invalid event batch callback");
+        }
+    }
+    
+    // 每个环境一个合并回调，只收到本环境实例的事件
+    bool success = SpineInstanceRegistry::getInstance().SetEventBatchCallback(env, disable ? nullptr : args[0]);
+    return SpineNapiUtils::CreateBool(env, success);
+}
+
+/**
+ * 把本帧本环境所有实例的事件一次性交给合并事件回调
+ * 回调参数：(records: ArrayBuffer, newStrings: string[], dropped: number)
+ */
+napi_value FlushEvents(napi_env env, napi_callback_info info) {
+    SPINE_TRACE_SCOPE("napi.flushEvents", -1);
+    napi_value callback;
+    std::shared_ptr<SpineEventBuffer> eventBuffer = SpineInstanceRegistry::getInstance().GetEventBuffer(env);
+    if (!eventBuffer || !SpineInstanceRegistry::getInstance().GetEventBatchCallback(env, &callback)) {
+        return SpineNapiUtils::CreateInt32(env, 0);
+    }
+    
+    // 每个 JS 线程一份，复用容量
+    thread_local SpineEventBatch batch;
+    size_t count = eventBuffer->Drain(&batch);
+    if (count == 0 && batch.newStrings.empty() && batch.dropped == 0) {
+        return SpineNapiUtils::CreateInt32(env, 0);
+    }
+    
+    size_t byteLength = count * sizeof(SpineEventRecord);
+    void* data = nullptr;
+    napi_value argv[3];
+    if (napi_create_arraybuffer(env, byteLength, &data, &argv[0]) != napi_ok) {
+        return SpineNapiUtils::ThrowError(env, "Failed to allocate event buffer");
+    }
+    if (byteLength > 0) {
+        memcpy(data, batch.records.data(), byteLength);
+    }
+    argv[1] = SpineNapiUtils::CreateStringArray(env, batch.newStrings);
+    napi_create_double(env, static_cast<double>(batch.dropped), &argv[2]);
+    
+    napi_value global;
+    napi_get_global(env, &global);
+    napi_call_function(env, global, callback, 3, argv, nullptr);
+    return SpineNapiUtils::CreateInt32(env, static_cast<int32_t>(count));
+}
+
+/**
+ * 加载 Spine 数据
+ */
+napi_value LoadSpineData(napi_env env, napi_callback_info info) {
+    size_t argc = 4;
+    napi_value args[4];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+    
+    int32_t instanceId;
+    string spineDataPath, atlasDataPath;
+    SpineLoadOptions options;
+    
+    if (argc < 4 ||
+        !SpineNapiUtils::ParseInt32(env, args[0], &instanceId) ||
+        !SpineNapiUtils::ParseString(env, args[1], &spineDataPath) ||
+        !SpineNapiUtils::ParseString(env, args[2], &atlasDataPath) ||
+        !SpineNapiUtils::ParseLoadOptions(env, args[3], &options)) {
+        return SpineNapiUtils::ThrowTypeError(env, "Invalid arguments");
+    }
+    SPINE_TRACE_SCOPE("napi.loadSpineData", instanceId);
+    SpineManager* manager = SpineInstanceRegistry::getInstance().GetInstance(env, instanceId);
+    if (!manager) {
+        return SpineNapiUtils::ThrowError(env, "Invalid instance ID");
+    }
+
+    RecordCommand([&] { return SpineCommand::LoadSpineData(instanceId, spineDataPath, atlasDataPath, options); });
+    bool success = manager->LoadSpineData(spineDataPath, atlasDataPath, options);
+    return SpineNapiUtils::CreateBool(env, success);
+}
+
+/**
+ * 从资源包加载 Spine 数据
+ */
+napi_value LoadSpineBundle(napi_env env, napi_callback_info info) {
+    size_t argc = 3;
+    napi_value args[3];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+    
+    int32_t instanceId;
+    string bundlePath;
+    SpineLoadOptions options;
+    if (argc < 3 ||
+        !SpineNapiUtils::ParseInt32(env, args[0], &instanceId) ||
+        !SpineNapiUtils::ParseString(env, args[1], &bundlePath) ||
+        !SpineNapiUtils::ParseLoadOptions(env, args[2], &options)) {
+        return SpineNapiUtils::ThrowTypeError(env, "Invalid arguments");
+    }
+    SPINE_TRACE_SCOPE("napi.loadSpineBundle", instanceId);
+    SpineManager* manager = SpineInstanceRegistry::getInstance().GetInstance(env, instanceId);
+    if (!manager) {
+        return SpineNapiUtils::ThrowError(env, "Invalid instance ID");
+    }
+
+    RecordCommand([&] { return SpineCommand::LoadSpineBundle(instanceId, bundlePath, options); });
+    bool success = manager->LoadSpineBundle(bundlePath, options);
+    return SpineNapiUtils::CreateBool(env, success);
+}
+
+/**
+ * 设置动画
+ */
+napi_value SetAnimation(napi_env env, napi_callback_info info) {
+    size_t argc = 4;
+    napi_value args[4];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+    
+    int32_t instanceId, trackIndex;
+    string animationName;
+    bool loop;
+    
+    if (argc < 4 ||
+        !SpineNapiUtils::ParseInt32(env, args[0], &instanceId) ||
+        !SpineNapiUtils::ParseInt32(env, args[1], &trackIndex) ||
+        !SpineNapiUtils::ParseString(env, args[2], &animationName) ||
+        !SpineNapiUtils::ParseBool(env, args[3], &loop)) {
+        return SpineNapiUtils::ThrowTypeError(env, "Invalid arguments");
+    }
+    SPINE_TRACE_SCOPE("napi.setAnimation", instanceId);
+    SpineManager* manager = SpineInstanceRegistry::getInstance().GetInstance(env, instanceId);
+    if (!manager) {
+        return SpineNapiUtils::ThrowError(env, "Invalid instance ID");
+    }
+
+    RecordCommand([&] { return SpineCommand::SetAnimation(instanceId, trackIndex, animationName, loop); });
+    SpineInstanceRegistry::EventDeliveryScope deliveryScope(env);
+    bool success = manager->SetAnimation(trackIndex, animationName, loop);
+    return SpineNapiUtils::CreateBool(env, success);
+}
+
+/**
+ * 添加动画到队列
+ */
+napi_value AddAnimation(napi_env env, napi_callback_info info) {
+    size_t argc = 5;
+    napi_value args[5];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+    
+    int32_t instanceId, trackIndex;
+    string animationName;
+    bool loop;
+    float delay;
+    
+    if (argc < 5 ||
+        !SpineNapiUtils::ParseInt32(env, args[0], &instanceId) ||
+        !SpineNapiUtils::ParseInt32(env, args[1], &trackIndex) ||
+        !SpineNapiUtils::ParseString(env, args[2], &animationName) ||
+        !SpineNapiUtils::ParseBool(env, args[3], &loop) ||
+        !SpineNapiUtils::ParseFloat(env, args[4], &delay)) {
+        return SpineNapiUtils::ThrowTypeError(env, "Invalid arguments");
+    }
+    SPINE_TRACE_SCOPE("napi.addAnimation", instanceId);
+    SpineManager* manager = SpineInstanceRegistry::getInstance().GetInstance(env, instanceId);
+    if (!manager) {
+        return SpineNapiUtils::ThrowError(env, "Invalid instance ID");
+    }
+
+    RecordCommand([&] { return SpineCommand::AddAnimation(instanceId, trackIndex, animationName, loop, delay); });
+    SpineInstanceRegistry::EventDeliveryScope deliveryScope(env);
+    bool success = manager->AddAnimation(trackIndex, animationName, loop, delay);
+    return SpineNapiUtils::CreateBool(env, success);
+}
+
+/**
+ * 预先解码动画（以 lazyAnimations 加载时，避免首次播放时解码）
+ */
+napi_value PreloadAnimations(napi_env env, napi_callback_info info) {
+    size_t argc = 2;
+    napi_value args[2];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+    
+    int32_t instanceId;
+    vector<string> animationNames;
+    if (argc < 2 ||
+        !SpineNapiUtils::ParseInt32(env, args[0], &instanceId) ||
+        !SpineNapiUtils::ParseStringArray(env, args[1], &animationNames)) {
+        return SpineNapiUtils::ThrowTypeError(env, "Invalid arguments");
+    }
+    SPINE_TRACE_SCOPE("napi.preloadAnimations", instanceId);
+    SpineManager* manager = SpineInstanceRegistry::getInstance().GetInstance(env, instanceId);
+    if (!manager) {
+        return SpineNapiUtils::ThrowError(env, "Invalid instance ID");
+    }
+
+    bool success = manager->PreloadAnimations(animationNames);
+    return SpineNapiUtils::CreateBool(env, success);
+}
+
+/**
+ * 获取动画列表
+ */
+napi_value GetAnimations(napi_env env, napi_callback_info info) {
+    size_t argc = 1;
+    napi_value args[1];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+    
+    int32_t instanceId;
+    if (argc < 1 || !SpineNapiUtils::ParseInt32(env, args[0], &instanceId)) {
+        return SpineNapiUtils::ThrowTypeError(env, "Invalid instance ID");
+    }
+    SPINE_TRACE_SCOPE("napi.getAnimations", instanceId);
+    SpineManager* manager = SpineInstanceRegistry::getInstance().GetInstance(env, instanceId);
+    if (!manager) {
+        return SpineNapiUtils::ThrowError(env, "Invalid instance ID");
+    }
+
+    // 同一骨骼数据的实例返回同一个冻结数组，命中时不复制名称列表
+    std::shared_ptr<SpineNapiValueCache> cache = SpineInstanceRegistry::getInstance().GetValueCache(env);
+    if (!cache) {
+        return SpineNapiUtils::CreateStringArray(env, manager->GetAnimations());
+    }
+    return cache->GetNameArray(env, manager->GetSpineDataPath(), SpineNapiValueCache::NameList::kAnimations,
+                               [manager]() { return manager->GetAnimations(); });
+}
+
+/**
+ * 获取皮肤列表
+ */
+napi_value GetSkins(napi_env env, napi_callback_info info) {
+    size_t argc = 1;
+    napi_value args[1];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+    
+    int32_t instanceId;
+    if (argc < 1 || !SpineNapiUtils::ParseInt32(env, args[0], &instanceId)) {
+        return SpineNapiUtils::ThrowTypeError(env, "Invalid instance ID");
+    }
+    SPINE_TRACE_SCOPE("napi.getSkins", instanceId);
+    SpineManager* manager = SpineInstanceRegistry::getInstance().GetInstance(env, instanceId);
+    if (!manager) {
+        return SpineNapiUtils::ThrowError(env, "Invalid instance ID");
+    }
+
+    std::shared_ptr<SpineNapiValueCache> cache = SpineInstanceRegistry::getInstance().GetValueCache(env);
+    if (!cache) {
+        return SpineNapiUtils::CreateStringArray(env, manager->GetSkins());
+    }
+    return cache->GetNameArray(env, manager->GetSpineDataPath(), SpineNapiValueCache::NameList::kSkins,
+                               [manager]() { return manager->GetSkins(); });
+}
+
+/**
+ * 加入姿态共享组
+ */
+napi_value JoinPoseGroup(napi_env env, napi_callback_info info) {
     size_t argc = 2;
     napi_value args[2];
-    // napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+    
+    int32_t instanceId, groupId;
+    if (argc < 2 ||
+        !SpineNapiUtils::ParseInt32(env, args[0], &instanceId) ||
+        !SpineNapiUtils::ParseInt32(env, args[1], &groupId)) {
+        return SpineNapiUtils::ThrowTypeError(env, "Invalid arguments");
+    }
+    SPINE_TRACE_SCOPE("napi.joinPoseGroup", instanceId);
+    SpineManager* manager = SpineInstanceRegistry::getInstance().GetInstance(env, instanceId);
+    if (!manager) {
+        return SpineNapiUtils::ThrowError(env, "Invalid instance ID");
+    }
+
+    bool success = manager->JoinPoseGroup(groupId);
+    return SpineNapiUtils::CreateBool(env, success);
+}
+
+/**
+ * 离开姿态共享组
+ */
+napi_value LeavePoseGroup(napi_env env, napi_callback_info info) {
+    size_t argc = 1;
+    napi_value args[1];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
     
     int32_t instanceId;
-    if (!SpineNapiUtils::ParseInt32(env, args[0], &instanceId)) {
+    if (argc < 1 || !SpineNapiUtils::ParseInt32(env, args[0], &instanceId)) {
         return SpineNapiUtils::ThrowTypeError(env, "Invalid instance ID");
     }
+    SPINE_TRACE_SCOPE("napi.leavePoseGroup", instanceId);
+    SpineManager* manager = SpineInstanceRegistry::getInstance().GetInstance(env, instanceId);
+    if (!manager) {
+        return SpineNapiUtils::ThrowError(env, "Invalid instance ID");
+    }
+
+    manager->LeavePoseGroup();
+    return SpineNapiUtils::CreateBool(env, true);
+}
+
+/**
+ * 设置着色
+ */
+napi_value SetTint(napi_env env, napi_callback_info info) {
+    size_t argc = 5;
+    napi_value args[5];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+    
+    int32_t instanceId;
+    float r, g, b, a;
+    if (argc < 5 ||
+        !SpineNapiUtils::ParseInt32(env, args[0], &instanceId) ||
+        !SpineNapiUtils::ParseFloat(env, args[1], &r) ||
+        !SpineNapiUtils::ParseFloat(env, args[2], &g) ||
+        !SpineNapiUtils::ParseFloat(env, args[3], &b) ||
+        !SpineNapiUtils::ParseFloat(env, args[4], &a)) {
+        return SpineNapiUtils::ThrowTypeError(env, "Invalid arguments");
+    }
+    SPINE_TRACE_SCOPE("napi.setTint", instanceId);
+    SpineManager* manager = SpineInstanceRegistry::getInstance().GetInstance(env, instanceId);
+    if (!manager) {
+        return SpineNapiUtils::ThrowError(env, "Invalid instance ID");
+    }
+
+    manager->SetTint(r, g, b, a);
+    return SpineNapiUtils::CreateBool(env, true);
+}
+
+/**
+ * 设置是否预乘 Alpha（图集容器的两种页面像素都已缓存，不重新加载）
+ */
+napi_value SetPremultipliedAlpha(napi_env env, napi_callback_info info) {
+    size_t argc = 2;
+    napi_value args[2];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
     
-    // 创建回调引用
-    napi_ref callbackRef;
-    // napi_create_reference(env, args[1], 1, &callbackRef);
+    int32_t instanceId;
+    bool premultipliedAlpha;
+    if (argc < 2 ||
+        !SpineNapiUtils::ParseInt32(env, args[0], &instanceId) ||
+        !SpineNapiUtils::ParseBool(env, args[1], &premultipliedAlpha)) {
+        return SpineNapiUtils::ThrowTypeError(env, "Invalid arguments");
+    }
+    SPINE_TRACE_SCOPE("napi.setPremultipliedAlpha", instanceId);
+    SpineManager* manager = SpineInstanceRegistry::getInstance().GetInstance(env, instanceId);
+    if (!manager) {
+        return SpineNapiUtils::ThrowError(env, "Invalid instance ID");
+    }
+
+    manager->SetPremultipliedAlpha(premultipliedAlpha);
+    return SpineNapiUtils::CreateBool(env, true);
+}
+
+/**
+ * 设置视图在屏幕上可见的部分
+ */
+napi_value SetVisibleRect(napi_env env, napi_callback_info info) {
+    size_t argc = 5;
+    napi_value args[5];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
     
-    SpineInstanceRegistry::getInstance().SetEventCallback(instanceId, env, callbackRef);
+    int32_t instanceId;
+    SpineRect rect;
+    if (argc < 5 ||
+        !SpineNapiUtils::ParseInt32(env, args[0], &instanceId) ||
+        !SpineNapiUtils::ParseFloat(env, args[1], &rect.left) ||
+        !SpineNapiUtils::ParseFloat(env, args[2], &rect.top) ||
+        !SpineNapiUtils::ParseFloat(env, args[3], &rect.right) ||
+        !SpineNapiUtils::ParseFloat(env, args[4], &rect.bottom)) {
+        return SpineNapiUtils::ThrowTypeError(env, "Invalid arguments");
+    }
+    SPINE_TRACE_SCOPE("napi.setVisibleRect", instanceId);
+    SpineManager* manager = SpineInstanceRegistry::getInstance().GetInstance(env, instanceId);
+    if (!manager) {
+        return SpineNapiUtils::ThrowError(env, "Invalid instance ID");
+    }
+
+    manager->SetVisibleRect(rect);
+    return SpineNapiUtils::CreateBool(env, true);
+}
+
+/**
+ * 取消可见区域，恢复为整个视图
+ */
+napi_value ClearVisibleRect(napi_env env, napi_callback_info info) {
+    size_t argc = 1;
+    napi_value args[1];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+    
+    int32_t instanceId;
+    if (argc < 1 || !SpineNapiUtils::ParseInt32(env, args[0], &instanceId)) {
+        return SpineNapiUtils::ThrowTypeError(env, "Invalid instance ID");
+    }
+    SPINE_TRACE_SCOPE("napi.clearVisibleRect", instanceId);
+    SpineManager* manager = SpineInstanceRegistry::getInstance().GetInstance(env, instanceId);
+    if (!manager) {
+        return SpineNapiUtils::ThrowError(env, "Invalid instance ID");
+    }
+
+    manager->ClearVisibleRect();
+    return SpineNapiUtils::CreateBool(env, true);
+}
+
+/**
+ * 设置位图缓存的内存预算
+ */
+napi_value SetBitmapCacheBudget(napi_env env, napi_callback_info info) {
+    size_t argc = 1;
+    napi_value args[1];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+    
+    int64_t budgetBytes;
+    if (argc < 1 || !SpineNapiUtils::ParseInt64(env, args[0], &budgetBytes) || budgetBytes < 0) {
+        return SpineNapiUtils::ThrowTypeError(env, "Invalid budget");
+    }
+
+    SpineBitmapCache::getInstance().SetBudget(static_cast<size_t>(budgetBytes));
+    return SpineNapiUtils::CreateBool(env, true);
+}
+
+/**
+ * 设置并行蒙皮阈值
+ */
+napi_value SetParallelSkinningThreshold(napi_env env, napi_callback_info info) {
+    size_t argc = 1;
+    napi_value args[1];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+    
+    int32_t vertexCount;
+    if (argc < 1 || !SpineNapiUtils::ParseInt32(env, args[0], &vertexCount) || vertexCount < 0) {
+        return SpineNapiUtils::ThrowTypeError(env, "Invalid vertex count");
+    }
+
+    SpineManager::SetParallelSkinningThreshold(static_cast<uint32_t>(vertexCount));
+    return SpineNapiUtils::CreateBool(env, true);
+}
+
+/**
+ * 获取渲染统计
+ */
+napi_value GetRenderStats(napi_env env, napi_callback_info info) {
+    size_t argc = 1;
+    napi_value args[1];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+    
+    int32_t instanceId;
+    if (argc < 1 || !SpineNapiUtils::ParseInt32(env, args[0], &instanceId)) {
+        return SpineNapiUtils::ThrowTypeError(env, "Invalid instance ID");
+    }
+    SPINE_TRACE_SCOPE("napi.getRenderStats", instanceId);
+    SpineManager* manager = SpineInstanceRegistry::getInstance().GetInstance(env, instanceId);
+    if (!manager) {
+        return SpineNapiUtils::ThrowError(env, "Invalid instance ID");
+    }
+
+    SpineRenderStats stats = manager->GetRenderStats();
+    napi_value result = SpineNapiUtils::CreateObject(env);
+    SpineNapiUtils::SetNamedNumber(env, result, "frameCount", static_cast<double>(stats.frameCount));
+    SpineNapiUtils::SetNamedNumber(env, result, "lastPixelsTouched", static_cast<double>(stats.lastPixelsTouched));
+    SpineNapiUtils::SetNamedNumber(env, result, "totalPixelsTouched", static_cast<double>(stats.totalPixelsTouched));
+
+    napi_value damage = SpineNapiUtils::CreateObject(env);
+    SpineNapiUtils::SetNamedNumber(env, damage, "left", stats.lastDamage.left);
+    SpineNapiUtils::SetNamedNumber(env, damage, "top", stats.lastDamage.top);
+    SpineNapiUtils::SetNamedNumber(env, damage, "right", stats.lastDamage.right);
+    SpineNapiUtils::SetNamedNumber(env, damage, "bottom", stats.lastDamage.bottom);
+    napi_set_named_property(env, result, "damage", damage);
+    SpineNapiUtils::SetNamedNumber(env, result, "culledFrames", static_cast<double>(stats.culledFrames));
+    SpineNapiUtils::SetNamedNumber(env, result, "cachedFrames", static_cast<double>(stats.cachedFrames));
+    return result;
+}
+
+/**
+ * 配置实例池
+ */
+napi_value ConfigureInstancePool(napi_env env, napi_callback_info info) {
+    size_t argc = 2;
+    napi_value args[2];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+    
+    int32_t prewarmCount, maxPoolSize;
+    if (argc < 2 ||
+        !SpineNapiUtils::ParseInt32(env, args[0], &prewarmCount) ||
+        !SpineNapiUtils::ParseInt32(env, args[1], &maxPoolSize) ||
+        prewarmCount < 0 || maxPoolSize < 0) {
+        return SpineNapiUtils::ThrowTypeError(env, "Invalid arguments");
+    }
+
+    SpineInstanceFactory::ConfigurePool(static_cast<size_t>(prewarmCount), static_cast<size_t>(maxPoolSize));
+    return SpineNapiUtils::CreateBool(env, true);
+}
+
+/**
+ * 获取实例池统计
+ */
+napi_value GetInstancePoolStats(napi_env env, napi_callback_info info) {
+    SpineInstancePoolStats stats = SpineInstanceFactory::GetPoolStats();
+    uint64_t total = stats.hits + stats.misses;
+    
+    napi_value result = SpineNapiUtils::CreateObject(env);
+    SpineNapiUtils::SetNamedNumber(env, result, "hits", static_cast<double>(stats.hits));
+    SpineNapiUtils::SetNamedNumber(env, result, "misses", static_cast<double>(stats.misses));
+    SpineNapiUtils::SetNamedNumber(env, result, "hitRate",
+                                   total == 0 ? 0.0 : static_cast<double>(stats.hits) / static_cast<double>(total));
+    SpineNapiUtils::SetNamedNumber(env, result, "pooledCount", static_cast<double>(stats.pooledCount));
+    SpineNapiUtils::SetNamedNumber(env, result, "maxPoolSize", static_cast<double>(stats.maxPoolSize));
+    return result;
+}
+
+/**
+ * 开始追踪
+ */
+napi_value StartTrace(napi_env env, napi_callback_info info) {
+    return SpineNapiUtils::CreateBool(env, SpineTrace::getInstance().Start());
+}
+
+/**
+ * 停止追踪并写出 Chrome trace JSON
+ */
+napi_value StopTrace(napi_env env, napi_callback_info info) {
+    size_t argc = 1;
+    napi_value args[1];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+    
+    string path;
+    if (argc < 1 || !SpineNapiUtils::ParseString(env, args[0], &path) || path.empty()) {
+        return SpineNapiUtils::ThrowTypeError(env, "Invalid path");
+    }
+
+    return SpineNapiUtils::CreateBool(env, SpineTrace::getInstance().Stop(path));
+}
+
+/**
+ * 设置每帧 Update + Render 的时间预算
+ */
+napi_value SetFrameBudget(napi_env env, napi_callback_info info) {
+    size_t argc = 1;
+    napi_value args[1];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+    
+    double budgetMs;
+    if (argc < 1 || napi_get_value_double(env, args[0], &budgetMs) != napi_ok || budgetMs < 0.0) {
+        return SpineNapiUtils::ThrowTypeError(env, "Invalid frame budget");
+    }
+
+    std::shared_ptr<SpineFrameScheduler> scheduler = SpineInstanceRegistry::getInstance().GetScheduler(env);
+    if (!scheduler) {
+        return SpineNapiUtils::CreateBool(env, false);
+    }
+    scheduler->SetBudget(budgetMs);
+    return SpineNapiUtils::CreateBool(env, true);
+}
+
+/**
+ * 设置实例的调度优先级
+ */
+napi_value SetSchedulePriority(napi_env env, napi_callback_info info) {
+    size_t argc = 2;
+    napi_value args[2];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+    
+    int32_t instanceId, priority;
+    if (argc < 2 ||
+        !SpineNapiUtils::ParseInt32(env, args[0], &instanceId) ||
+        !SpineNapiUtils::ParseInt32(env, args[1], &priority)) {
+        return SpineNapiUtils::ThrowTypeError(env, "Invalid arguments");
+    }
+    SpineManager* manager = SpineInstanceRegistry::getInstance().GetInstance(env, instanceId);
+    if (!manager) {
+        return SpineNapiUtils::ThrowError(env, "Invalid instance ID");
+    }
+
+    manager->SetSchedulePriority(priority);
+    return SpineNapiUtils::CreateBool(env, true);
+}
+
+/**
+ * 按帧预算更新并渲染实例，返回本帧的调度结果
+ */
+napi_value RunFrame(napi_env env, napi_callback_info info) {
+    size_t argc = 2;
+    napi_value args[2];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+    
+    float deltaTime;
+    if (argc < 1 || !SpineNapiUtils::ParseFloat(env, args[0], &deltaTime)) {
+        return SpineNapiUtils::ThrowTypeError(env, "Invalid delta time");
+    }
+    // 可选的可见实例列表，未传时调度所有实例
+    std::vector<int32_t> instanceIds;
+    if (argc > 1 && !SpineNapiUtils::IsNullOrUndefined(env, args[1])) {
+        if (!SpineNapiUtils::ParseInt32Array(env, args[1], &instanceIds)) {
+            return SpineNapiUtils::ThrowTypeError(env, "Invalid instance IDs");
+        }
+    } else {
+        instanceIds = SpineInstanceRegistry::getInstance().GetInstanceIds(env);
+    }
+    
+    std::vector<std::pair<int32_t, SpineManager*>> instances;
+    instances.reserve(instanceIds.size());
+    for (int32_t instanceId : instanceIds) {
+        SpineManager* manager = SpineInstanceRegistry::getInstance().GetInstance(env, instanceId);
+        if (manager) {
+            instances.emplace_back(instanceId, manager);
+        }
+    }
+    // 每个环境独立调度，各 Worker 的帧可以并行执行
+    std::shared_ptr<SpineFrameScheduler> scheduler = SpineInstanceRegistry::getInstance().GetScheduler(env);
+    if (!scheduler) {
+        return SpineNapiUtils::ThrowError(env, "Environment not registered");
+    }
+    SpineInstanceRegistry::EventDeliveryScope deliveryScope(env);
+    SpineFrameReport report = scheduler->RunFrame(deltaTime, instances);
+
+    napi_value result = SpineNapiUtils::CreateObject(env);
+    SpineNapiUtils::SetNamedNumber(env, result, "budgetMs", report.budgetMs);
+    SpineNapiUtils::SetNamedNumber(env, result, "elapsedMs", report.elapsedMs);
+    SpineNapiUtils::SetNamedNumber(env, result, "overrunMs", report.overrunMs);
+    SpineNapiUtils::SetNamedNumber(env, result, "updated", report.updatedCount);
+    napi_value deferred;
+    napi_create_array_with_length(env, report.deferredInstanceIds.size(), &deferred);
+    for (size_t i = 0; i < report.deferredInstanceIds.size(); ++i) {
+        napi_set_element(env, deferred, static_cast<uint32_t>(i),
+                         SpineNapiUtils::CreateInt32(env, report.deferredInstanceIds[i]));
+    }
+    napi_set_named_property(env, result, "deferred", deferred);
+    return result;
+}
+
+/**
+ * 创建共享时钟
+ */
+napi_value CreateClock(napi_env env, napi_callback_info info) {
+    size_t argc = 1;
+    napi_value args[1];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+    
+    int32_t parentId = -1;
+    if (argc > 0 && !SpineNapiUtils::IsNullOrUndefined(env, args[0]) &&
+        !SpineNapiUtils::ParseInt32(env, args[0], &parentId)) {
+        return SpineNapiUtils::ThrowTypeError(env, "Invalid parent clock ID");
+    }
+
+    return SpineNapiUtils::CreateInt32(env, SpineClockRegistry::getInstance().CreateClock(env, parentId));
+}
+
+/**
+ * 销毁共享时钟
+ */
+napi_value DestroyClock(napi_env env, napi_callback_info info) {
+    size_t argc = 1;
+    napi_value args[1];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+    
+    int32_t clockId;
+    if (argc < 1 || !SpineNapiUtils::ParseInt32(env, args[0], &clockId)) {
+        return SpineNapiUtils::ThrowTypeError(env, "Invalid clock ID");
+    }
+
+    return SpineNapiUtils::CreateBool(env, SpineClockRegistry::getInstance().DestroyClock(env, clockId));
+}
+
+/**
+ * 设置时钟的时间缩放
+ */
+napi_value SetClockTimeScale(napi_env env, napi_callback_info info) {
+    size_t argc = 2;
+    napi_value args[2];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+    
+    int32_t clockId;
+    float timeScale;
+    if (argc < 2 ||
+        !SpineNapiUtils::ParseInt32(env, args[0], &clockId) ||
+        !SpineNapiUtils::ParseFloat(env, args[1], &timeScale)) {
+        return SpineNapiUtils::ThrowTypeError(env, "Invalid arguments");
+    }
+
+    return SpineNapiUtils::CreateBool(env, SpineClockRegistry::getInstance().SetTimeScale(env, clockId, timeScale));
+}
+
+/**
+ * 暂停或恢复时钟
+ */
+napi_value SetClockPaused(napi_env env, napi_callback_info info) {
+    size_t argc = 2;
+    napi_value args[2];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+    
+    int32_t clockId;
+    bool paused;
+    if (argc < 2 ||
+        !SpineNapiUtils::ParseInt32(env, args[0], &clockId) ||
+        !SpineNapiUtils::ParseBool(env, args[1], &paused)) {
+        return SpineNapiUtils::ThrowTypeError(env, "Invalid arguments");
+    }
+
+    return SpineNapiUtils::CreateBool(env, SpineClockRegistry::getInstance().SetPaused(env, clockId, paused));
+}
+
+/**
+ * 把实例挂到时钟上，clockId 为 -1 时取下
+ */
+napi_value AttachToClock(napi_env env, napi_callback_info info) {
+    size_t argc = 2;
+    napi_value args[2];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+    
+    int32_t instanceId, clockId;
+    if (argc < 2 ||
+        !SpineNapiUtils::ParseInt32(env, args[0], &instanceId) ||
+        !SpineNapiUtils::ParseInt32(env, args[1], &clockId)) {
+        return SpineNapiUtils::ThrowTypeError(env, "Invalid arguments");
+    }
+    if (!SpineInstanceRegistry::getInstance().GetInstance(env, instanceId)) {
+        return SpineNapiUtils::ThrowError(env, "Invalid instance ID");
+    }
+
+    return SpineNapiUtils::CreateBool(env, SpineClockRegistry::getInstance().Attach(env, instanceId, clockId));
+}
+
+/**
+ * 推进时钟：更新并渲染挂在该时钟及其子时钟上的所有实例
+ */
+napi_value TickClock(napi_env env, napi_callback_info info) {
+    size_t argc = 2;
+    napi_value args[2];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+    
+    int32_t clockId;
+    float deltaTime;
+    if (argc < 2 ||
+        !SpineNapiUtils::ParseInt32(env, args[0], &clockId) ||
+        !SpineNapiUtils::ParseFloat(env, args[1], &deltaTime)) {
+        return SpineNapiUtils::ThrowTypeError(env, "Invalid arguments");
+    }
+    SPINE_TRACE_SCOPE("napi.tickClock", -1);
+    
+    // 每个 JS 线程一份，复用容量
+    thread_local std::vector<std::pair<int32_t, float>> attached;
+    if (!SpineClockRegistry::getInstance().CollectInstances(env, clockId, &attached)) {
+        return SpineNapiUtils::ThrowError(env, "Invalid clock ID");
+    }
+    
+    SpineInstanceRegistry::EventDeliveryScope deliveryScope(env);
+    int32_t updated = 0;
+    for (const auto& entry : attached) {
+        SpineManager* manager = SpineInstanceRegistry::getInstance().GetInstance(env, entry.first);
+        if (!manager) {
+            continue;
+        }
+        float scaledDelta = deltaTime * entry.second;
+        RecordCommand([&] { return SpineCommand::Update(entry.first, scaledDelta); });
+        RecordCommand([&] { return SpineCommand::Simple(SpineCommandOp::kRender, entry.first); });
+        manager->Update(scaledDelta);
+        manager->Render();
+        updated++;
+    }
+    return SpineNapiUtils::CreateInt32(env, updated);
+}
+
+/**
+ * 设置实例在场景中的位置和层级，开始参与命中测试
+ */
+napi_value SetSceneTransform(napi_env env, napi_callback_info info) {
+    size_t argc = 4;
+    napi_value args[4];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+    
+    int32_t instanceId;
+    float x, y;
+    int32_t zIndex = 0;
+    if (argc < 3 ||
+        !SpineNapiUtils::ParseInt32(env, args[0], &instanceId) ||
+        !SpineNapiUtils::ParseFloat(env, args[1], &x) ||
+        !SpineNapiUtils::ParseFloat(env, args[2], &y)) {
+        return SpineNapiUtils::ThrowTypeError(env, "Invalid arguments");
+    }
+    if (argc > 3 && !SpineNapiUtils::IsNullOrUndefined(env, args[3]) &&
+        !SpineNapiUtils::ParseInt32(env, args[3], &zIndex)) {
+        return SpineNapiUtils::ThrowTypeError(env, "Invalid z index");
+    }
+    if (!SpineInstanceRegistry::getInstance().GetInstance(env, instanceId)) {
+        return SpineNapiUtils::ThrowError(env, "Invalid instance ID");
+    }
+
+    SpineSpatialIndex::getInstance().SetTransform(instanceId, x, y, zIndex);
+    return SpineNapiUtils::CreateBool(env, true);
+}
+
+/**
+ * 命中测试：返回触点下的实例及命中的包围盒附件
+ */
+napi_value HitTest(napi_env env, napi_callback_info info) {
+    size_t argc = 2;
+    napi_value args[2];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+    
+    float x, y;
+    if (argc < 2 ||
+        !SpineNapiUtils::ParseFloat(env, args[0], &x) ||
+        !SpineNapiUtils::ParseFloat(env, args[1], &y)) {
+        return SpineNapiUtils::ThrowTypeError(env, "Invalid arguments");
+    }
+    SPINE_TRACE_SCOPE("napi.hitTest", -1);
+    
+    // 每个 JS 线程一份，复用容量
+    thread_local std::vector<SpineHitResult> hits;
+    SpineSpatialIndex::getInstance().HitTest(x, y, &hits);
+    
+    // 只返回本环境的实例
+    napi_value result;
+    napi_create_array(env, &result);
+    uint32_t index = 0;
+    for (size_t i = 0; i < hits.size(); ++i) {
+        if (!SpineInstanceRegistry::getInstance().GetInstance(env, hits[i].instanceId)) {
+            continue;
+        }
+        napi_value hit = SpineNapiUtils::CreateObject(env);
+        SpineNapiUtils::SetNamedNumber(env, hit, "instanceId", hits[i].instanceId);
+        napi_set_named_property(env, hit, "attachments", SpineNapiUtils::CreateStringArray(env, hits[i].attachments));
+        napi_set_element(env, result, index++, hit);
+    }
+    return result;
+}
+
+/**
+ * 获取帧调度的累计统计
+ */
+napi_value GetFrameSchedulerStats(napi_env env, napi_callback_info info) {
+    std::shared_ptr<SpineFrameScheduler> scheduler = SpineInstanceRegistry::getInstance().GetScheduler(env);
+    SpineSchedulerStats stats = scheduler ? scheduler->GetStats() : SpineSchedulerStats();
+    napi_value result = SpineNapiUtils::CreateObject(env);
+    SpineNapiUtils::SetNamedNumber(env, result, "frames", static_cast<double>(stats.frames));
+    SpineNapiUtils::SetNamedNumber(env, result, "overrunFrames", static_cast<double>(stats.overrunFrames));
+    SpineNapiUtils::SetNamedNumber(env, result, "deferrals", static_cast<double>(stats.deferrals));
+    return result;
+}
+
+/**
+ * 开始录制命令流
+ */
+napi_value StartCommandRecording(napi_env env, napi_callback_info info) {
+    size_t argc = 1;
+    napi_value args[1];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+    
+    string path;
+    if (argc < 1 || !SpineNapiUtils::ParseString(env, args[0], &path) || path.empty()) {
+        return SpineNapiUtils::ThrowTypeError(env, "Invalid path");
+    }
+
+    return SpineNapiUtils::CreateBool(env, SpineCommandRecorder::getInstance().Start(path));
+}
+
+/**
+ * 停止录制命令流
+ */
+napi_value StopCommandRecording(napi_env env, napi_callback_info info) {
+    uint64_t commandCount = SpineCommandRecorder::getInstance().Stop();
+    napi_value result;
+    napi_create_double(env, static_cast<double>(commandCount), &result);
+    return result;
+}
+
+#ifdef SPINEHM_BENCHMARKS
+/**
+ * 名称列表封送的微基准：逐项创建与缓存两种方式各重复若干次，返回每次的平均纳秒数（仅调试构建）
+ */
+napi_value BenchmarkNapiMarshaling(napi_env env, napi_callback_info info) {
+    size_t argc = 2;
+    napi_value args[2];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+    
+    int32_t nameCount = 32;
+    int32_t iterations = 1000;
+    if ((argc > 0 && !SpineNapiUtils::IsNullOrUndefined(env, args[0]) &&
+         !SpineNapiUtils::ParseInt32(env, args[0], &nameCount)) ||
+        (argc > 1 && !SpineNapiUtils::IsNullOrUndefined(env, args[1]) &&
+         !SpineNapiUtils::ParseInt32(env, args[1], &iterations)) ||
+        nameCount <= 0 || iterations <= 0) {
+        return SpineNapiUtils::ThrowTypeError(env, "Invalid arguments");
+    }
+    
+    vector<string> names;
+    names.reserve(nameCount);
+    for (int32_t i = 0; i < nameCount; ++i) {
+        names.push_back("animation_" + std::to_string(i));
+    }
+    
+    // 独立的缓存，不影响本环境的名称缓存；每次迭代在自己的句柄作用域内，避免句柄累积
+    SpineNapiValueCache cache;
+    auto measure = [env, iterations](const std::function<void()>& body) {
+        uint64_t startNs = SpineTrace::NowNs();
+        for (int32_t i = 0; i < iterations; ++i) {
+            napi_handle_scope scope;
+            napi_open_handle_scope(env, &scope);
+            body();
+            napi_close_handle_scope(env, scope);
+        }
+        return static_cast<double>(SpineTrace::NowNs() - startNs) / iterations;
+    };
+    
+    double createStringArrayNs = measure([&]() { SpineNapiUtils::CreateStringArray(env, names); });
+    double cachedNameArrayNs = measure([&]() {
+        cache.GetNameArray(env, "benchmark", SpineNapiValueCache::NameList::kAnimations, [&names]() { return names; });
+    });
+    double createStringsNs = measure([&]() {
+        for (const string& name : names) {
+            napi_value str;
+            napi_create_string_utf8(env, name.c_str(), name.length(), &str);
+        }
+    });
+    double internedStringsNs = measure([&]() {
+        for (const string& name : names) {
+            cache.GetString(env, name);
+        }
+    });
+    cache.Release(env);
+    
+    napi_value result = SpineNapiUtils::CreateObject(env);
+    SpineNapiUtils::SetNamedNumber(env, result, "nameCount", nameCount);
+    SpineNapiUtils::SetNamedNumber(env, result, "iterations", iterations);
+    SpineNapiUtils::SetNamedNumber(env, result, "createStringArrayNs", createStringArrayNs);
+    SpineNapiUtils::SetNamedNumber(env, result, "cachedNameArrayNs", cachedNameArrayNs);
+    SpineNapiUtils::SetNamedNumber(env, result, "createStringsNs", createStringsNs);
+    SpineNapiUtils::SetNamedNumber(env, result, "internedStringsNs", internedStringsNs);
+    return result;
+}
+#endif // SPINEHM_BENCHMARKS
+
+/**
+ * 设置全局内存预算
+ */
+napi_value SetMemoryBudget(napi_env env, napi_callback_info info) {
+    size_t argc = 1;
+    napi_value args[1];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+    
+    int64_t budgetBytes;
+    if (argc < 1 || !SpineNapiUtils::ParseInt64(env, args[0], &budgetBytes) || budgetBytes < 0) {
+        return SpineNapiUtils::ThrowTypeError(env, "Invalid budget");
+    }
+
+    SpineMemoryTracker::getInstance().SetBudget(static_cast<size_t>(budgetBytes));
+    return SpineNapiUtils::CreateBool(env, true);
+}
+
+/**
+ * 获取内存统计
+ */
+napi_value GetMemoryStats(napi_env env, napi_callback_info info) {
+    SpineMemoryTracker& tracker = SpineMemoryTracker::getInstance();
+    SpineMemoryUsage usage = tracker.GetUsage();
+    
+    napi_value result = SpineNapiUtils::CreateObject(env);
+    SpineNapiUtils::SetNamedNumber(env, result, "totalBytes", static_cast<double>(usage.Total()));
+    SpineNapiUtils::SetNamedNumber(env, result, "budgetBytes", static_cast<double>(tracker.GetBudget()));
+    SpineNapiUtils::SetNamedNumber(env, result, "evictedBytes", static_cast<double>(tracker.GetEvictedBytes()));
+    
+    napi_value categories = SpineNapiUtils::CreateObject(env);
+    for (size_t i = 0; i < kSpineMemoryCategoryCount; ++i) {
+        SpineNapiUtils::SetNamedNumber(env, categories,
+                                       SpineMemoryTracker::GetCategoryName(static_cast<SpineMemoryCategory>(i)),
+                                       static_cast<double>(usage.bytes[i]));
+    }
+    napi_set_named_property(env, result, "categories", categories);
+    
+    napi_value instances;
+    napi_create_array(env, &instances);
+    uint32_t index = 0;
+    for (int32_t instanceId : SpineInstanceRegistry::getInstance().GetInstanceIds(env)) {
+        SpineManager* manager = SpineInstanceRegistry::getInstance().GetInstance(env, instanceId);
+        if (!manager) {
+            continue;
+        }
+        
+        SpineMemoryUsage instanceUsage = manager->GetMemoryUsage();
+        napi_value instance = SpineNapiUtils::CreateObject(env);
+        SpineNapiUtils::SetNamedNumber(env, instance, "instanceId", instanceId);
+        SpineNapiUtils::SetNamedNumber(env, instance, "totalBytes", static_cast<double>(instanceUsage.Total()));
+        for (size_t i = 0; i < kSpineMemoryCategoryCount; ++i) {
+            if (instanceUsage.bytes[i] != 0) {
+                SpineNapiUtils::SetNamedNumber(env, instance,
+                                               SpineMemoryTracker::GetCategoryName(static_cast<SpineMemoryCategory>(i)),
+                                               static_cast<double>(instanceUsage.bytes[i]));
+            }
+        }
+        napi_set_element(env, instances, index++, instance);
+    }
+    napi_set_named_property(env, result, "instances", instances);
+    return result;
+}
+
+/**
+ * 设置皮肤
+ */
+napi_value SetSkin(napi_env env, napi_callback_info info) {
+    size_t argc = 2;
+    napi_value args[2];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+    
+    int32_t instanceId;
+    string skinName;
+    if (argc < 2 ||
+        !SpineNapiUtils::ParseInt32(env, args[0], &instanceId) ||
+        !SpineNapiUtils::ParseString(env, args[1], &skinName)) {
+        return SpineNapiUtils::ThrowTypeError(env, "Invalid arguments");
+    }
+    SPINE_TRACE_SCOPE("napi.setSkin", instanceId);
+    SpineManager* manager = SpineInstanceRegistry::getInstance().GetInstance(env, instanceId);
+    if (!manager) {
+        return SpineNapiUtils::ThrowError(env, "Invalid instance ID");
+    }
+
+    RecordCommand([&] { return SpineCommand::SetSkin(instanceId, skinName); });
+    bool success = manager->SetSkin(skinName);
+    return SpineNapiUtils::CreateBool(env, success);
+}
+
+/**
+ * 设置动画混合时间
+ */
+napi_value SetMix(napi_env env, napi_callback_info info) {
+    size_t argc = 4;
+    napi_value args[4];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+    
+    int32_t instanceId;
+    string fromAnimation, toAnimation;
+    float duration;
+    if (argc < 4 ||
+        !SpineNapiUtils::ParseInt32(env, args[0], &instanceId) ||
+        !SpineNapiUtils::ParseString(env, args[1], &fromAnimation) ||
+        !SpineNapiUtils::ParseString(env, args[2], &toAnimation) ||
+        !SpineNapiUtils::ParseFloat(env, args[3], &duration)) {
+        return SpineNapiUtils::ThrowTypeError(env, "Invalid arguments");
+    }
+    SPINE_TRACE_SCOPE("napi.setMix", instanceId);
+    SpineManager* manager = SpineInstanceRegistry::getInstance().GetInstance(env, instanceId);
+    if (!manager) {
+        return SpineNapiUtils::ThrowError(env, "Invalid instance ID");
+    }
+
+    RecordCommand([&] { return SpineCommand::SetMix(instanceId, fromAnimation, toAnimation, duration); });
+    manager->SetMix(fromAnimation, toAnimation, duration);
+    return SpineNapiUtils::CreateBool(env, true);
+}
+
+/**
+ * 设置时间缩放
+ */
+napi_value SetTimeScale(napi_env env, napi_callback_info info) {
+    size_t argc = 2;
+    napi_value args[2];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+    
+    int32_t instanceId;
+    float timeScale;
+    if (argc < 2 ||
+        !SpineNapiUtils::ParseInt32(env, args[0], &instanceId) ||
+        !SpineNapiUtils::ParseFloat(env, args[1], &timeScale)) {
+        return SpineNapiUtils::ThrowTypeError(env, "Invalid arguments");
+    }
+    SPINE_TRACE_SCOPE("napi.setTimeScale", instanceId);
+    SpineManager* manager = SpineInstanceRegistry::getInstance().GetInstance(env, instanceId);
+    if (!manager) {
+        return SpineNapiUtils::ThrowError(env, "Invalid instance ID");
+    }
+
+    RecordCommand([&] { return SpineCommand::SetTimeScale(instanceId, timeScale); });
+    manager->SetTimeScale(timeScale);
+    return SpineNapiUtils::CreateBool(env, true);
+}
+
+/**
+ * 暂停动画
+ */
+napi_value Pause(napi_env env, napi_callback_info info) {
+    size_t argc = 1;
+    napi_value args[1];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+    
+    int32_t instanceId;
+    if (argc < 1 || !SpineNapiUtils::ParseInt32(env, args[0], &instanceId)) {
+        return SpineNapiUtils::ThrowTypeError(env, "Invalid instance ID");
+    }
+    SPINE_TRACE_SCOPE("napi.pause", instanceId);
+    SpineManager* manager = SpineInstanceRegistry::getInstance().GetInstance(env, instanceId);
+    if (!manager) {
+        return SpineNapiUtils::ThrowError(env, "Invalid instance ID");
+    }
+
+    RecordCommand([&] { return SpineCommand::Simple(SpineCommandOp::kPause, instanceId); });
+    manager->Pause();
+    return SpineNapiUtils::CreateBool(env, true);
+}
+
+/**
+ * 恢复动画
+ */
+napi_value Resume(napi_env env, napi_callback_info info) {
+    size_t argc = 1;
+    napi_value args[1];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+    
+    int32_t instanceId;
+    if (argc < 1 || !SpineNapiUtils::ParseInt32(env, args[0], &instanceId)) {
+        return SpineNapiUtils::ThrowTypeError(env, "Invalid instance ID");
+    }
+    SPINE_TRACE_SCOPE("napi.resume", instanceId);
+    SpineManager* manager = SpineInstanceRegistry::getInstance().GetInstance(env, instanceId);
+    if (!manager) {
+        return SpineNapiUtils::ThrowError(env, "Invalid instance ID");
+    }
+
+    RecordCommand([&] { return SpineCommand::Simple(SpineCommandOp::kResume, instanceId); });
+    manager->Resume();
+    return SpineNapiUtils::CreateBool(env, true);
+}
+
+/**
+ * 清除所有轨道
+ */
+napi_value ClearTracks(napi_env env, napi_callback_info info) {
+    size_t argc = 1;
+    napi_value args[1];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+    
+    int32_t instanceId;
+    if (argc < 1 || !SpineNapiUtils::ParseInt32(env, args[0], &instanceId)) {
+        return SpineNapiUtils::ThrowTypeError(env, "Invalid instance ID");
+    }
+    SPINE_TRACE_SCOPE("napi.clearTracks", instanceId);
+    SpineManager* manager = SpineInstanceRegistry::getInstance().GetInstance(env, instanceId);
+    if (!manager) {
+        return SpineNapiUtils::ThrowError(env, "Invalid instance ID");
+    }
+
+    RecordCommand([&] { return SpineCommand::Simple(SpineCommandOp::kClearTracks, instanceId); });
+    SpineInstanceRegistry::EventDeliveryScope deliveryScope(env);
+    manager->ClearTracks();
+    return SpineNapiUtils::CreateBool(env, true);
+}
+
+/**
+ * 清除指定轨道
+ */
+napi_value ClearTrack(napi_env env, napi_callback_info info) {
+    size_t argc = 2;
+    napi_value args[2];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+    
+    int32_t instanceId, trackIndex;
+    if (argc < 2 ||
+        !SpineNapiUtils::ParseInt32(env, args[0], &instanceId) ||
+        !SpineNapiUtils::ParseInt32(env, args[1], &trackIndex)) {
+        return SpineNapiUtils::ThrowTypeError(env, "Invalid arguments");
+    }
+    SPINE_TRACE_SCOPE("napi.clearTrack", instanceId);
+    SpineManager* manager = SpineInstanceRegistry::getInstance().GetInstance(env, instanceId);
+    if (!manager) {
+        return SpineNapiUtils::ThrowError(env, "Invalid instance ID");
+    }
+
+    RecordCommand([&] { return SpineCommand::ClearTrack(instanceId, trackIndex); });
+    SpineInstanceRegistry::EventDeliveryScope deliveryScope(env);
+    manager->ClearTrack(trackIndex);
     return SpineNapiUtils::CreateBool(env, true);
 }
 
 /**
- * 加载 Spine 数据
+ * 更新视图尺寸
  */
-napi_value LoadSpineData(napi_env env, napi_callback_info info) {
-    size_t argc = 4;
-    napi_value args[4];
-    // napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
-    
-    int32_t instanceId;
-    string spineDataPath, atlasDataPath;
-    SpineLoadOptions options;
+napi_value UpdateViewSize(napi_env env, napi_callback_info info) {
+    size_t argc = 3;
+    napi_value args[3];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
     
-    if (!SpineNapiUtils::ParseInt32(env, args[0], &instanceId) ||
-        !SpineNapiUtils::ParseString(env, args[1], &spineDataPath) ||
-        !SpineNapiUtils::ParseString(env, args[2], &atlasDataPath) ||
-        !SpineNapiUtils::ParseLoadOptions(env, args[3], &options)) {
+    int32_t instanceId, width, height;
+    if (argc < 3 ||
+        !SpineNapiUtils::ParseInt32(env, args[0], &instanceId) ||
+        !SpineNapiUtils::ParseInt32(env, args[1], &width) ||
+        !SpineNapiUtils::ParseInt32(env, args[2], &height)) {
         return SpineNapiUtils::ThrowTypeError(env, "Invalid arguments");
     }
-    SpineManager* manager = SpineInstanceRegistry::getInstance().GetInstance(instanceId);
+    SPINE_TRACE_SCOPE("napi.updateViewSize", instanceId);
+    SpineManager* manager = SpineInstanceRegistry::getInstance().GetInstance(env, instanceId);
     if (!manager) {
         return SpineNapiUtils::ThrowError(env, "Invalid instance ID");
     }
 
-    bool success = manager->LoadSpineData(spineDataPath, atlasDataPath, options);
-    return SpineNapiUtils::CreateBool(env, success);
+    RecordCommand([&] { return SpineCommand::UpdateViewSize(instanceId, width, height); });
+    manager->UpdateViewSize(width, height);
+    return SpineNapiUtils::CreateBool(env, true);
 }
 
 /**
- * 设置动画
+ * 设置显示缩放（配置了图集变体时可能在后台切换变体）
  */
-napi_value SetAnimation(napi_env env, napi_callback_info info) {
-    size_t argc = 4;
-    napi_value args[4];
-    // napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
-    
-    int32_t instanceId, trackIndex;
-    string animationName;
-    bool loop;
+napi_value SetScale(napi_env env, napi_callback_info info) {
+    size_t argc = 2;
+    napi_value args[2];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
     
-    if (!SpineNapiUtils::ParseInt32(env, args[0], &instanceId) ||
-        !SpineNapiUtils::ParseInt32(env, args[1], &trackIndex) ||
-        !SpineNapiUtils::ParseString(env, args[2], &animationName) ||
-        !SpineNapiUtils::ParseBool(env, args[3], &loop)) {
+    int32_t instanceId;
+    float scale;
+    if (argc < 2 ||
+        !SpineNapiUtils::ParseInt32(env, args[0], &instanceId) ||
+        !SpineNapiUtils::ParseFloat(env, args[1], &scale)) {
         return SpineNapiUtils::ThrowTypeError(env, "Invalid arguments");
     }
-    SpineManager* manager = SpineInstanceRegistry::getInstance().GetInstance(instanceId);
+    SPINE_TRACE_SCOPE("napi.setScale", instanceId);
+    SpineManager* manager = SpineInstanceRegistry::getInstance().GetInstance(env, instanceId);
     if (!manager) {
         return SpineNapiUtils::ThrowError(env, "Invalid instance ID");
     }
 
-    bool success = manager->SetAnimation(trackIndex, animationName, loop);
-    return SpineNapiUtils::CreateBool(env, success);
+    RecordCommand([&] { return SpineCommand::SetScale(instanceId, scale); });
+    manager->SetScale(scale);
+    return SpineNapiUtils::CreateBool(env, true);
 }
 
 /**
- * 添加动画到队列
+ * 更新动画（每帧调用）
  */
-napi_value AddAnimation(napi_env env, napi_callback_info info) {
-    size_t argc = 5;
-    napi_value args[5];
-    
-    int32_t instanceId, trackIndex;
-    string animationName;
-    bool loop;
-    float delay;
+napi_value Update(napi_env env, napi_callback_info info) {
+    size_t argc = 2;
+    napi_value args[2];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
     
-    if (!SpineNapiUtils::ParseInt32(env, args[0], &instanceId) ||
-        !SpineNapiUtils::ParseInt32(env, args[1], &trackIndex) ||
-        !SpineNapiUtils::ParseString(env, args[2], &animationName) ||
-        !SpineNapiUtils::ParseBool(env, args[3], &loop) ||
-        !SpineNapiUtils::ParseFloat(env, args[4], &delay)) {
+    int32_t instanceId;
+    float deltaTime;
+    if (argc < 2 ||
+        !SpineNapiUtils::ParseInt32(env, args[0], &instanceId) ||
+        !SpineNapiUtils::ParseFloat(env, args[1], &deltaTime)) {
         return SpineNapiUtils::ThrowTypeError(env, "Invalid arguments");
     }
-    SpineManager* manager = SpineInstanceRegistry::getInstance().GetInstance(instanceId);
+    SPINE_TRACE_SCOPE("napi.update", instanceId);
+    SpineManager* manager = SpineInstanceRegistry::getInstance().GetInstance(env, instanceId);
     if (!manager) {
         return SpineNapiUtils::ThrowError(env, "Invalid instance ID");
     }
 
-    bool success = manager->AddAnimation(trackIndex, animationName, loop, delay);
-    return SpineNapiUtils::CreateBool(env, success);
+    // 与帧调度器一致，按实例所挂时钟链的有效缩放推进（暂停的时钟为 0）；
+    // 录制缩放后的增量，重放时不需要重建时钟
+    const float scaledDelta = deltaTime * SpineClockRegistry::getInstance().GetEffectiveScale(instanceId);
+    RecordCommand([&] { return SpineCommand::Update(instanceId, scaledDelta); });
+    SpineInstanceRegistry::EventDeliveryScope deliveryScope(env);
+    manager->Update(scaledDelta);
+    return SpineNapiUtils::CreateBool(env, true);
 }
 
 /**
- * 获取动画列表
+ * 渲染（每帧调用）
  */
-napi_value GetAnimations(napi_env env, napi_callback_info info) {
+napi_value Render(napi_env env, napi_callback_info info) {
     size_t argc = 1;
     napi_value args[1];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
     
     int32_t instanceId;
-    if (!SpineNapiUtils::ParseInt32(env, args[0], &instanceId)) {
+    if (argc < 1 || !SpineNapiUtils::ParseInt32(env, args[0], &instanceId)) {
         return SpineNapiUtils::ThrowTypeError(env, "Invalid instance ID");
     }
-    SpineManager* manager = SpineInstanceRegistry::getInstance().GetInstance(instanceId);
+    SPINE_TRACE_SCOPE("napi.render", instanceId);
+    SpineManager* manager = SpineInstanceRegistry::getInstance().GetInstance(env, instanceId);
     if (!manager) {
         return SpineNapiUtils::ThrowError(env, "Invalid instance ID");
     }
 
-    vector<string> animations = manager->GetAnimations();
-    return SpineNapiUtils::CreateStringArray(env, animations);
+    RecordCommand([&] { return SpineCommand::Simple(SpineCommandOp::kRender, instanceId); });
+    manager->Render();
+    return SpineNapiUtils::CreateBool(env, true);
 }
 
 // 其他函数的实现类似，这里省略...
-napi_value SetSkin(napi_env env, napi_callback_info info) { return nullptr; }
-napi_value SetMix(napi_env env, napi_callback_info info) { return nullptr; }
-napi_value SetTimeScale(napi_env env, napi_callback_info info) { return nullptr; }
-napi_value Pause(napi_env env, napi_callback_info info) { return nullptr; }
-napi_value Resume(napi_env env, napi_callback_info info) { return nullptr; }
-napi_value ClearTracks(napi_env env, napi_callback_info info) { return nullptr; }
-napi_value ClearTrack(napi_env env, napi_callback_info info) { return nullptr; }
-napi_value UpdateViewSize(napi_env env, napi_callback_info info) { return nullptr; }
-napi_value GetSkins(napi_env env, napi_callback_info info) { return nullptr; }
 napi_value Cleanup(napi_env env, napi_callback_info info) { return nullptr; }
-napi_value Update(napi_env env, napi_callback_info info) { return nullptr; }
-napi_value Render(napi_env env, napi_callback_info info) { return nullptr; }
 
 } // namespace SpineNapi
 
@@ -233,6 +1471,11 @@ inline bool ParseInt32(napi_env env, napi_value value, int32_t* result) {
                  "Expected an int32");
 }
 
+inline bool ParseInt64(napi_env env, napi_value value, int64_t* result) {
+    return Check(napi_get_value_int64(env, value, result), env,
+                 "Expected an integer");
+}
+
 inline bool ParseFloat(napi_env env, napi_value value, float* result) {
     double d;
     if (!Check(napi_get_value_double(env, value, &d), env,
@@ -263,6 +1506,58 @@ inline bool ParseString(napi_env env, napi_value value, string* result) {
     return true;
 }
 
+inline bool IsNullOrUndefined(napi_env env, napi_value value) {
+    napi_valuetype vt;
+    if (napi_typeof(env, value, &vt) != napi_ok) {
+        return false;
+    }
+    return vt == napi_null || vt == napi_undefined;
+}
+
+inline bool ParseStringArray(napi_env env, napi_value value, vector<string>* result) {
+    bool isArray = false;
+    if (!Check(napi_is_array(env, value, &isArray), env) || !isArray)
+        return false;
+
+    uint32_t length = 0;
+    if (!Check(napi_get_array_length(env, value, &length), env))
+        return false;
+
+    result->clear();
+    result->reserve(length);
+    for (uint32_t i = 0; i < length; ++i) {
+        napi_value element;
+        string item;
+        if (!Check(napi_get_element(env, value, i, &element), env) ||
+            !ParseString(env, element, &item))
+            return false;
+        result->push_back(std::move(item));
+    }
+    return true;
+}
+
+inline bool ParseInt32Array(napi_env env, napi_value value, vector<int32_t>* result) {
+    bool isArray = false;
+    if (!Check(napi_is_array(env, value, &isArray), env) || !isArray)
+        return false;
+
+    uint32_t length = 0;
+    if (!Check(napi_get_array_length(env, value, &length), env))
+        return false;
+
+    result->clear();
+    result->reserve(length);
+    for (uint32_t i = 0; i < length; ++i) {
+        napi_value element;
+        int32_t item;
+        if (!Check(napi_get_element(env, value, i, &element), env) ||
+            !ParseInt32(env, element, &item))
+            return false;
+        result->push_back(item);
+    }
+    return true;
+}
+
 /* ---------- 解析自定义选项对象 ---------- */
 inline bool ParseLoadOptions(napi_env env,
                              napi_value value,
@@ -297,6 +1592,64 @@ inline bool ParseLoadOptions(napi_env env,
     if (get_prop("debugMode", &v))
         ParseBool(env, v, &options->debugMode);
 
+    /* quantizeTimelines: boolean */
+    if (get_prop("quantizeTimelines", &v))
+        ParseBool(env, v, &options->quantizeTimelines);
+
+    /* batchTimelines: boolean */
+    if (get_prop("batchTimelines", &v))
+        ParseBool(env, v, &options->batchTimelines);
+
+    /* lazyAnimations: boolean */
+    if (get_prop("lazyAnimations", &v))
+        ParseBool(env, v, &options->lazyAnimations);
+
+    /* quantizeTolerance: { time?, rotate?, translate?, ... }，未给出的类型使用默认误差 */
+    napi_value tolerance;
+    napi_valuetype toleranceType;
+    if (get_prop("quantizeTolerance", &tolerance) &&
+        Check(napi_typeof(env, tolerance, &toleranceType), env) && toleranceType == napi_object) {
+        SpineQuantizeTolerance& target = options->quantizeTolerance;
+        const std::pair<const char*, float*> fields[] = {
+            {"time", &target.time},           {"rotate", &target.rotate}, {"translate", &target.translate},
+            {"scale", &target.scale},         {"shear", &target.shear},   {"color", &target.color},
+            {"deform", &target.deform},       {"constraint", &target.constraint},
+        };
+        for (const auto& field : fields) {
+            bool has_prop = false;
+            if (Check(napi_has_named_property(env, tolerance, field.first, &has_prop), env) && has_prop &&
+                Check(napi_get_named_property(env, tolerance, field.first, &v), env))
+                ParseFloat(env, v, field.second);
+        }
+    }
+
+    /* atlasVariants: [{ atlasPath, scale }]，缺少字段的变体忽略 */
+    napi_value variants;
+    bool isArray = false;
+    if (get_prop("atlasVariants", &variants) && Check(napi_is_array(env, variants, &isArray), env) && isArray) {
+        uint32_t length = 0;
+        Check(napi_get_array_length(env, variants, &length), env);
+        options->atlasVariants.clear();
+        for (uint32_t i = 0; i < length; ++i) {
+            napi_value element;
+            napi_valuetype elementType;
+            if (!Check(napi_get_element(env, variants, i, &element), env) ||
+                !Check(napi_typeof(env, element, &elementType), env) || elementType != napi_object)
+                continue;
+            SpineAtlasVariant variant;
+            bool hasPath = false;
+            bool hasScale = false;
+            if (Check(napi_has_named_property(env, element, "atlasPath", &hasPath), env) && hasPath &&
+                Check(napi_get_named_property(env, element, "atlasPath", &v), env))
+                hasPath = ParseString(env, v, &variant.atlasPath);
+            if (Check(napi_has_named_property(env, element, "scale", &hasScale), env) && hasScale &&
+                Check(napi_get_named_property(env, element, "scale", &v), env))
+                hasScale = ParseFloat(env, v, &variant.scale);
+            if (hasPath && hasScale)
+                options->atlasVariants.push_back(std::move(variant));
+        }
+    }
+
     return true;  // 任何字段出错都会提前抛异常
 }
 
@@ -313,6 +1666,19 @@ inline napi_value CreateInt32(napi_env env, int32_t value) {
     return result;
 }
 
+inline napi_value CreateObject(napi_env env) {
+    napi_value result;
+    Check(napi_create_object(env, &result), env);
+    return result;
+}
+
+inline void SetNamedNumber(napi_env env, napi_value object, const char* name, double value) {
+    napi_value number;
+    if (Check(napi_create_double(env, value, &number), env)) {
+        Check(napi_set_named_property(env, object, name, number), env);
+    }
+}
+
 inline napi_value CreateStringArray(napi_env env,
                                     const vector<string>& strings) {
     napi_value array;
@@ -347,110 +1713,550 @@ inline napi_value ThrowTypeError(napi_env env, const string& message) {
 }  // namespace SpineNapiUtils
 
 
+/**
+ * SpineNapiValueCache 实现
+ */
+namespace {
+// 名称来自已加载的骨骼数据，数量有限；超出上限说明键不是名称，不再驻留
+constexpr size_t kMaxInternedStrings = 4096;
+// 同时缓存名称数组的骨骼数据数，超出时整体清空
+constexpr size_t kMaxNameArrays = 256;
+}
+
+napi_value SpineNapiValueCache::GetString(napi_env env, const std::string& value) {
+    napi_value result = nullptr;
+    auto it = strings_.find(value);
+    if (it != strings_.end() && napi_get_reference_value(env, it->second, &result) == napi_ok && result != nullptr) {
+        return result;
+    }
+    
+    if (napi_create_string_utf8(env, value.c_str(), value.length(), &result) != napi_ok) {
+        return nullptr;
+    }
+    if (it == strings_.end() && strings_.size() < kMaxInternedStrings) {
+        napi_ref ref = nullptr;
+        if (napi_create_reference(env, result, 1, &ref) == napi_ok) {
+            strings_.emplace(value, ref);
+        }
+    }
+    return result;
+}
+
+napi_value SpineNapiValueCache::GetNameArray(napi_env env, const std::string& dataKey, NameList list,
+                                             const std::function<std::vector<std::string>()>& getNames) {
+    napi_value result = nullptr;
+    std::string key;
+    if (!dataKey.empty()) {
+        key.reserve(dataKey.length() + 1);
+        key.push_back(static_cast<char>('0' + static_cast<uint8_t>(list)));
+        key.append(dataKey);
+        auto it = arrays_.find(key);
+        if (it != arrays_.end() && napi_get_reference_value(env, it->second, &result) == napi_ok &&
+            result != nullptr) {
+            return result;
+        }
+    }
+    
+    std::vector<std::string> names = getNames();
+    if (napi_create_array_with_length(env, names.size(), &result) != napi_ok) {
+        return nullptr;
+    }
+    for (size_t i = 0; i < names.size(); ++i) {
+        napi_set_element(env, result, static_cast<uint32_t>(i), GetString(env, names[i]));
+    }
+    if (key.empty()) {
+        return result;
+    }
+    
+    // 共享的数组冻结后才能安全地返回给多个调用方
+    napi_object_freeze(env, result);
+    if (arrays_.size() >= kMaxNameArrays) {
+        for (auto& entry : arrays_) {
+            napi_delete_reference(env, entry.second);
+        }
+        arrays_.clear();
+    }
+    napi_ref ref = nullptr;
+    if (napi_create_reference(env, result, 1, &ref) == napi_ok) {
+        auto it = arrays_.find(key);
+        if (it != arrays_.end()) {
+            napi_delete_reference(env, it->second);
+            it->second = ref;
+        } else {
+            arrays_.emplace(std::move(key), ref);
+        }
+    }
+    return result;
+}
+
+void SpineNapiValueCache::Release(napi_env env) {
+    for (auto& entry : strings_) {
+        napi_delete_reference(env, entry.second);
+    }
+    for (auto& entry : arrays_) {
+        napi_delete_reference(env, entry.second);
+    }
+    strings_.clear();
+    arrays_.clear();
+}
+
+
 /**
  * SpineInstanceRegistry 实现
  */
+namespace {
+/**
+ * 等待投递到 JS 线程的单个事件（event.eventData 指向本对象内的副本）
+ */
+struct PendingEvent {
+    SpineAnimationEvent event;
+    SpineEventData eventData;
+};
+
+void SetNamedString(napi_env env, napi_value object, const char* name, const string& value) {
+    napi_value str;
+    napi_create_string_utf8(env, value.c_str(), value.length(), &str);
+    napi_set_named_property(env, object, name, str);
+}
+
+PendingEvent* CreatePendingEvent(const SpineAnimationEvent& event) {
+    auto* pending = new PendingEvent();
+    pending->event = event;
+    pending->event.eventData = nullptr;
+    if (event.eventData) {
+        pending->eventData = *event.eventData;
+        pending->event.eventData = &pending->eventData;
+    }
+    return pending;
+}
+
+/**
+ * 当前线程的同步投递状态（每个 JS 线程一份）
+ */
+struct SyncDeliveryState {
+    int depth = 0;
+    std::vector<std::pair<int32_t, std::unique_ptr<PendingEvent>>> queue;
+};
+
+thread_local SyncDeliveryState syncDelivery;
+}
+
 SpineInstanceRegistry& SpineInstanceRegistry::getInstance() {
     static SpineInstanceRegistry instance;
     return instance;
 }
 
-int32_t SpineInstanceRegistry::RegisterInstance(std::unique_ptr<SpineManager> manager) {
+void SpineInstanceRegistry::RegisterEnv(napi_env env) {
+    {
+        lock_guard<mutex> lock(instancesMutex_);
+        if (envs_.count(env) != 0) {
+            return;
+        }
+        EnvData data;
+        data.jsThread = std::this_thread::get_id();
+        data.eventBuffer = std::make_shared<SpineEventBuffer>();
+        data.scheduler = std::make_shared<SpineFrameScheduler>();
+        data.valueCache = std::make_shared<SpineNapiValueCache>();
+        envs_.emplace(env, std::move(data));
+    }
+    napi_add_env_cleanup_hook(env, OnEnvCleanup, env);
+}
+
+std::shared_ptr<SpineEventBuffer> SpineInstanceRegistry::GetEventBuffer(napi_env env) {
+    lock_guard<mutex> lock(instancesMutex_);
+    
+    auto it = envs_.find(env);
+    return it != envs_.end() ? it->second.eventBuffer : nullptr;
+}
+
+std::shared_ptr<SpineFrameScheduler> SpineInstanceRegistry::GetScheduler(napi_env env) {
+    lock_guard<mutex> lock(instancesMutex_);
+    
+    auto it = envs_.find(env);
+    return it != envs_.end() ? it->second.scheduler : nullptr;
+}
+
+std::shared_ptr<SpineNapiValueCache> SpineInstanceRegistry::GetValueCache(napi_env env) {
+    lock_guard<mutex> lock(instancesMutex_);
+    
+    auto it = envs_.find(env);
+    return it != envs_.end() ? it->second.valueCache : nullptr;
+}
+
+int32_t SpineInstanceRegistry::RegisterInstance(napi_env env, std::unique_ptr<SpineManager> manager) {
     lock_guard<mutex> lock(instancesMutex_);
     
     int32_t instanceId = nextInstanceId_++;
     InstanceData data;
     data.manager = std::move(manager);
+    data.manager->SetInstanceId(instanceId);
+    data.env = env;
     data.surfaceId = data.manager->GetSurfaceId();
-    data.renderThreadId = this_thread::get_id();
+    // 池中复用的管理器可能来自其他环境，总是换成本环境的缓冲
+    auto envIt = envs_.find(env);
+    data.manager->SetEventBuffer(envIt != envs_.end() ? envIt->second.eventBuffer : nullptr);
     
     instances_[instanceId] = std::move(data);
     return instanceId;
 }
 
-bool SpineInstanceRegistry::UnregisterInstance(int32_t instanceId) {
+bool SpineInstanceRegistry::UnregisterInstance(napi_env env, int32_t instanceId) {
+    return TakeInstance(env, instanceId) != nullptr;
+}
+
+std::unique_ptr<SpineManager> SpineInstanceRegistry::TakeInstance(napi_env env, int32_t instanceId) {
     lock_guard<mutex> lock(instancesMutex_);
     
     auto it = instances_.find(instanceId);
-    if (it != instances_.end()) {
-        // 清理回调引用
-        if (it->second.callbackRef != nullptr) {
-            // napi_delete_reference(it->second.env, it->second.callbackRef);
+    if (it == instances_.end() || it->second.env != env) {
+        return nullptr;
+    }
+    
+    // 清理回调
+    ReleaseEventCallbackLocked(it->second);
+    std::unique_ptr<SpineManager> manager = std::move(it->second.manager);
+    instances_.erase(it);
+    return manager;
+}
+
+std::vector<int32_t> SpineInstanceRegistry::GetInstanceIds(napi_env env) {
+    lock_guard<mutex> lock(instancesMutex_);
+    
+    std::vector<int32_t> instanceIds;
+    instanceIds.reserve(instances_.size());
+    for (const auto& entry : instances_) {
+        if (entry.second.env == env) {
+            instanceIds.push_back(entry.first);
         }
-        instances_.erase(it);
-        return true;
     }
-    return false;
+    std::sort(instanceIds.begin(), instanceIds.end());
+    return instanceIds;
 }
 
-SpineManager* SpineInstanceRegistry::GetInstance(int32_t instanceId) {
+SpineManager* SpineInstanceRegistry::GetInstance(napi_env env, int32_t instanceId) {
     lock_guard<mutex> lock(instancesMutex_);
     
     auto it = instances_.find(instanceId);
-    if (it != instances_.end()) {
+    if (it != instances_.end() && it->second.env == env) {
         return it->second.manager.get();
     }
     return nullptr;
 }
 
-void SpineInstanceRegistry::SetEventCallback(int32_t instanceId, napi_env env, napi_ref callbackRef) {
+bool SpineInstanceRegistry::SetEventCallback(napi_env env, int32_t instanceId, napi_value callback) {
+    SpineManager* manager = nullptr;
+    {
+        lock_guard<mutex> lock(instancesMutex_);
+        
+        auto it = instances_.find(instanceId);
+        if (it == instances_.end() || it->second.env != env) {
+            return false;
+        }
+        ReleaseEventCallbackLocked(it->second);
+        
+        // 事件可能在任意线程产生（帧调度、并行蒙皮），统一经线程安全函数投递到本环境的 JS 线程
+        napi_value name;
+        napi_create_string_utf8(env, "SpineEventCallback", NAPI_AUTO_LENGTH, &name);
+        napi_threadsafe_function eventCallback = nullptr;
+        if (napi_create_threadsafe_function(env, callback, nullptr, name, 0, 1, nullptr, nullptr, nullptr,
+                                            CallEventCallback, &eventCallback) != napi_ok) {
+            return false;
+        }
+        // 不阻止环境（Worker）退出
+        napi_unref_threadsafe_function(env, eventCallback);
+        it->second.eventCallback = eventCallback;
+        napi_create_reference(env, callback, 1, &it->second.eventCallbackRef);
+        manager = it->second.manager.get();
+    }
+    
+    // 在注册表锁外设置：管理器持有自身锁时会回调 TriggerEvent
+    manager->SetGlobalEventCallback(GlobalSpineEventCallback, instanceId);
+    return true;
+}
+
+void SpineInstanceRegistry::TriggerEvent(int32_t instanceId, const SpineAnimationEvent& event) {
+    napi_threadsafe_function eventCallback = nullptr;
+    bool deliverSync = false;
+    {
+        lock_guard<mutex> lock(instancesMutex_);
+        
+        auto it = instances_.find(instanceId);
+        if (it == instances_.end() || it->second.eventCallback == nullptr) {
+            return;
+        }
+        
+        auto envIt = envs_.find(it->second.env);
+        deliverSync = syncDelivery.depth > 0 && envIt != envs_.end() &&
+                      envIt->second.jsThread == std::this_thread::get_id();
+        if (!deliverSync) {
+            // 持有一个线程引用：释放注册表锁后回调被替换或实例被销毁，线程安全函数仍然有效
+            if (napi_acquire_threadsafe_function(it->second.eventCallback) != napi_ok) {
+                return;
+            }
+            eventCallback = it->second.eventCallback;
+        }
+    }
+    
+    std::unique_ptr<PendingEvent> pending(CreatePendingEvent(event));
+    if (deliverSync) {
+        // 产生事件时调用方持有实例锁，回调可能再次操作该实例，暂存到范围结束时调用
+        syncDelivery.queue.emplace_back(instanceId, std::move(pending));
+        return;
+    }
+    
+    // 在注册表锁外入队：队列满或环境正在退出时不阻塞其他线程的注册表操作
+    if (napi_call_threadsafe_function(eventCallback, pending.get(), napi_tsfn_nonblocking) == napi_ok) {
+        pending.release();
+    }
+    napi_release_threadsafe_function(eventCallback, napi_tsfn_release);
+}
+
+void SpineInstanceRegistry::DeliverEvent(napi_env env, int32_t instanceId, void* pendingEvent) {
+    std::unique_ptr<PendingEvent> pending(static_cast<PendingEvent*>(pendingEvent));
+    napi_value callback = nullptr;
+    {
+        lock_guard<mutex> lock(instancesMutex_);
+        
+        // 之前的回调可能已销毁实例或移除回调
+        auto it = instances_.find(instanceId);
+        if (it == instances_.end() || it->second.env != env || it->second.eventCallbackRef == nullptr ||
+            napi_get_reference_value(env, it->second.eventCallbackRef, &callback) != napi_ok) {
+            return;
+        }
+    }
+    CallEventCallback(env, callback, nullptr, pending.release());
+}
+
+SpineInstanceRegistry::EventDeliveryScope::EventDeliveryScope(napi_env env) : env_(env) {
+    syncDelivery.depth++;
+}
+
+SpineInstanceRegistry::EventDeliveryScope::~EventDeliveryScope() {
+    if (--syncDelivery.depth > 0) {
+        return;
+    }
+    
+    // 回调中调用的入口有自己的范围，在其结束时投递新产生的事件
+    std::vector<std::pair<int32_t, std::unique_ptr<PendingEvent>>> queue;
+    queue.swap(syncDelivery.queue);
+    SpineInstanceRegistry& registry = getInstance();
+    for (auto& entry : queue) {
+        bool exceptionPending = false;
+        if (napi_is_exception_pending(env_, &exceptionPending) == napi_ok && exceptionPending) {
+            // 回调抛出异常后不再调用 JS，异常交给调用方，剩余事件丢弃
+            break;
+        }
+        registry.DeliverEvent(env_, entry.first, entry.second.release());
+    }
+}
+
+bool SpineInstanceRegistry::SetEventBatchCallback(napi_env env, napi_value callback) {
     lock_guard<mutex> lock(instancesMutex_);
     
-    auto it = instances_.find(instanceId);
-    if (it != instances_.end()) {
-        it->second.env = env;
-        it->second.callbackRef = callbackRef;
-         // 设置全局C++回调到管理器
-        it->second.manager->SetGlobalEventCallback(GlobalSpineEventCallback, instanceId);
+    auto it = envs_.find(env);
+    if (it == envs_.end()) {
+        return false;
+    }
+    EnvData& data = it->second;
+    if (data.eventBatchCallbackRef != nullptr) {
+        napi_delete_reference(env, data.eventBatchCallbackRef);
+        data.eventBatchCallbackRef = nullptr;
     }
+    if (callback != nullptr) {
+        napi_create_reference(env, callback, 1, &data.eventBatchCallbackRef);
+    }
+    data.eventBuffer->SetEnabled(callback != nullptr);
+    return true;
 }
 
-void SpineInstanceRegistry::TriggerEvent(int32_t instanceId, const SpineAnimationEvent& event) {
+bool SpineInstanceRegistry::GetEventBatchCallback(napi_env env, napi_value* callback) {
     lock_guard<mutex> lock(instancesMutex_);
     
-    auto it = instances_.find(instanceId);
-    if (it != instances_.end() && it->second.callbackRef != nullptr) {
-        // 这里需要在主线程中调用JavaScript回调
-        // 创建事件对象并调用回调
-        // napi_value eventObj;
-        // napi_create_object(it->second.env, &eventObj);
-        // ... 设置事件属性
-        // napi_call_function(it->second.env, ..., it->second.callbackRef, ...);
+    auto it = envs_.find(env);
+    if (it == envs_.end() || it->second.eventBatchCallbackRef == nullptr) {
+        return false;
     }
+    return napi_get_reference_value(env, it->second.eventBatchCallbackRef, callback) == napi_ok;
 }
 
-SpineInstanceRegistry::~SpineInstanceRegistry() {
-    // 清理所有实例
-    for (auto& pair : instances_) {
-        if (pair.second.callbackRef != nullptr) {
-            // napi_delete_reference(pair.second.env, pair.second.callbackRef);
-        }
+void SpineInstanceRegistry::OnEnvCleanup(void* arg) {
+    napi_env env = static_cast<napi_env>(arg);
+    SpineInstanceRegistry& registry = getInstance();
+    
+    // 销毁会再次进入注册表，在锁外逐个进行
+    for (int32_t instanceId : registry.GetInstanceIds(env)) {
+        SpineInstanceFactory::DestroyInstance(env, instanceId);
+    }
+    // 时钟属于创建它的环境，随环境一起销毁
+    SpineClockRegistry::getInstance().DestroyClocks(env);
+    
+    lock_guard<mutex> lock(registry.instancesMutex_);
+    auto it = registry.envs_.find(env);
+    if (it == registry.envs_.end()) {
+        return;
+    }
+    if (it->second.eventBatchCallbackRef != nullptr) {
+        napi_delete_reference(env, it->second.eventBatchCallbackRef);
+    }
+    it->second.valueCache->Release(env);
+    registry.envs_.erase(it);
+}
+
+void SpineInstanceRegistry::CallEventCallback(napi_env env, napi_value callback, void* context, void* data) {
+    std::unique_ptr<PendingEvent> pending(static_cast<PendingEvent*>(data));
+    // 回调已释放（实例销毁或环境退出）时只释放事件
+    if (env == nullptr || callback == nullptr) {
+        return;
+    }
+    
+    const SpineAnimationEvent& event = pending->event;
+    napi_value eventObj = SpineNapiUtils::CreateObject(env);
+    SetNamedString(env, eventObj, "type", GetSpineEventTypeName(event.type));
+    SpineNapiUtils::SetNamedNumber(env, eventObj, "trackIndex", event.trackIndex);
+    SetNamedString(env, eventObj, "animation", event.animation);
+    if (event.eventData) {
+        const SpineEventData& eventData = *event.eventData;
+        napi_value dataObj = SpineNapiUtils::CreateObject(env);
+        SetNamedString(env, dataObj, "name", eventData.name);
+        SpineNapiUtils::SetNamedNumber(env, dataObj, "intValue", eventData.intValue);
+        SpineNapiUtils::SetNamedNumber(env, dataObj, "floatValue", eventData.floatValue);
+        SetNamedString(env, dataObj, "stringValue", eventData.stringValue);
+        SpineNapiUtils::SetNamedNumber(env, dataObj, "time", eventData.time);
+        SpineNapiUtils::SetNamedNumber(env, dataObj, "balance", eventData.balance);
+        SpineNapiUtils::SetNamedNumber(env, dataObj, "volume", eventData.volume);
+        napi_set_named_property(env, eventObj, "eventData", dataObj);
+    }
+    
+    napi_value global;
+    napi_get_global(env, &global);
+    napi_call_function(env, global, callback, 1, &eventObj, nullptr);
+}
+
+void SpineInstanceRegistry::ReleaseEventCallbackLocked(InstanceData& data) {
+    if (data.eventCallback != nullptr) {
+        // 已排队的事件照常投递，之后线程安全函数自行销毁
+        napi_release_threadsafe_function(data.eventCallback, napi_tsfn_release);
+        data.eventCallback = nullptr;
     }
+    if (data.eventCallbackRef != nullptr) {
+        // 只在所属环境的 JS 线程上调用（设置回调、销毁实例、环境清理）
+        napi_delete_reference(data.env, data.eventCallbackRef);
+        data.eventCallbackRef = nullptr;
+    }
+}
+
+SpineInstanceRegistry::~SpineInstanceRegistry() {
+    // 进程退出时各环境已经销毁（清理钩子已释放回调），这里不再调用 NAPI
 }
 
 /**
  * SpineInstanceFactory 实现
  */
-int32_t SpineInstanceFactory::CreateInstance(const string& surfaceId) {
+int32_t SpineInstanceFactory::CreateInstance(napi_env env, const string& surfaceId) {
     try {
-        // 创建独立的渲染上下文
-        auto renderContext = std::make_unique<SpineRenderContext>(surfaceId);
-//        renderContext->eglDisplay = CreateRenderContext(surfaceId);
-//        renderContext->isValid = (renderContext->eglDisplay != nullptr);
+        // 优先复用实例池中的空闲实例
+        std::unique_ptr<SpineManager> manager;
+        {
+            InstancePool& pool = GetPool();
+            lock_guard<mutex> lock(pool.mutex);
+            if (!pool.freeList.empty()) {
+                manager = std::move(pool.freeList.back());
+                pool.freeList.pop_back();
+                pool.hits++;
+            } else {
+                pool.misses++;
+            }
+        }
         
-        // 创建 SpineManager 实例
-        auto manager = make_unique<SpineManager>(surfaceId, std::move(renderContext));
+        if (manager) {
+            manager->SetSurfaceId(surfaceId);
+        } else {
+            manager = NewManager(surfaceId);
+        }
         
         // 注册到注册表
-        return SpineInstanceRegistry::getInstance().RegisterInstance(std::move(manager));
+        return SpineInstanceRegistry::getInstance().RegisterInstance(env, std::move(manager));
     } catch (const exception& e) {
         // 错误处理
         return -1;
     }
 }
 
-bool SpineInstanceFactory::DestroyInstance(int32_t instanceId) {
-    return SpineInstanceRegistry::getInstance().UnregisterInstance(instanceId);
+bool SpineInstanceFactory::DestroyInstance(napi_env env, int32_t instanceId) {
+    std::unique_ptr<SpineManager> manager = SpineInstanceRegistry::getInstance().TakeInstance(env, instanceId);
+    if (!manager) {
+        return false;
+    }
+    
+    // 重置后放回实例池，池满时直接释放
+    SpineClockRegistry::getInstance().Detach(instanceId);
+    SpineSpatialIndex::getInstance().Remove(instanceId);
+    manager->Reset();
+    
+    InstancePool& pool = GetPool();
+    lock_guard<mutex> lock(pool.mutex);
+    if (pool.freeList.size() < pool.maxPoolSize) {
+        pool.freeList.push_back(std::move(manager));
+    }
+    return true;
+}
+
+void SpineInstanceFactory::ConfigurePool(size_t prewarmCount, size_t maxPoolSize) {
+    InstancePool& pool = GetPool();
+    
+    size_t toCreate = 0;
+    {
+        lock_guard<mutex> lock(pool.mutex);
+        pool.maxPoolSize = std::max(maxPoolSize, prewarmCount);
+        if (pool.freeList.size() > pool.maxPoolSize) {
+            pool.freeList.resize(pool.maxPoolSize);
+        }
+        if (prewarmCount > pool.freeList.size()) {
+            toCreate = prewarmCount - pool.freeList.size();
+        }
+    }
+    
+    // 在锁外构造，避免阻塞正在创建实例的线程
+    std::vector<std::unique_ptr<SpineManager>> created;
+    created.reserve(toCreate);
+    for (size_t i = 0; i < toCreate; ++i) {
+        created.push_back(NewManager(""));
+    }
+    
+    lock_guard<mutex> lock(pool.mutex);
+    for (auto& manager : created) {
+        if (pool.freeList.size() >= pool.maxPoolSize) {
+            break;
+        }
+        pool.freeList.push_back(std::move(manager));
+    }
+}
+
+SpineInstancePoolStats SpineInstanceFactory::GetPoolStats() {
+    InstancePool& pool = GetPool();
+    lock_guard<mutex> lock(pool.mutex);
+    
+    SpineInstancePoolStats stats;
+    stats.hits = pool.hits;
+    stats.misses = pool.misses;
+    stats.pooledCount = pool.freeList.size();
+    stats.maxPoolSize = pool.maxPoolSize;
+    return stats;
+}
+
+SpineInstanceFactory::InstancePool& SpineInstanceFactory::GetPool() {
+    static InstancePool pool;
+    return pool;
+}
+
+std::unique_ptr<SpineManager> SpineInstanceFactory::NewManager(const string& surfaceId) {
+    // 创建独立的渲染上下文
+    auto renderContext = std::make_unique<SpineRenderContext>(surfaceId);
+//    renderContext->eglDisplay = CreateRenderContext(surfaceId);
+//    renderContext->isValid = (renderContext->eglDisplay != nullptr);
+    
+    // 创建 SpineManager 实例
+    return make_unique<SpineManager>(surfaceId, std::move(renderContext));
 }
 
 void* SpineInstanceFactory::CreateRenderContext(const string& surfaceId) {
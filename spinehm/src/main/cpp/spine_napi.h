@@ -17,6 +17,8 @@
 #include <thread>
 #include <atomic>
 #include "manager/SpineManager.h"
+#include "manager/SpineFrameScheduler.h"
+#include "common/SpineEventBuffer.h"
 
 using namespace std;
 
@@ -38,13 +40,18 @@ napi_value DestroySpineInstance(napi_env env, napi_callback_info info);
 
 // 渲染设置
 napi_value SetEventCallback(napi_env env, napi_callback_info info);
+napi_value GetEventStats(napi_env env, napi_callback_info info);
+napi_value SetEventBatchCallback(napi_env env, napi_callback_info info);
+napi_value FlushEvents(napi_env env, napi_callback_info info);
 
 // 数据加载
 napi_value LoadSpineData(napi_env env, napi_callback_info info);
+napi_value LoadSpineBundle(napi_env env, napi_callback_info info);
 
 // 动画控制
 napi_value SetAnimation(napi_env env, napi_callback_info info);
 napi_value AddAnimation(napi_env env, napi_callback_info info);
+napi_value PreloadAnimations(napi_env env, napi_callback_info info);
 napi_value SetSkin(napi_env env, napi_callback_info info);
 napi_value SetMix(napi_env env, napi_callback_info info);
 napi_value SetTimeScale(napi_env env, napi_callback_info info);
@@ -57,6 +64,57 @@ napi_value ClearTrack(napi_env env, napi_callback_info info);
 
 // 视图管理
 napi_value UpdateViewSize(napi_env env, napi_callback_info info);
+napi_value SetScale(napi_env env, napi_callback_info info);
+napi_value SetVisibleRect(napi_env env, napi_callback_info info);
+napi_value ClearVisibleRect(napi_env env, napi_callback_info info);
+
+// 姿态共享
+napi_value JoinPoseGroup(napi_env env, napi_callback_info info);
+napi_value LeavePoseGroup(napi_env env, napi_callback_info info);
+napi_value SetTint(napi_env env, napi_callback_info info);
+napi_value SetPremultipliedAlpha(napi_env env, napi_callback_info info);
+
+// 缓存配置
+napi_value SetBitmapCacheBudget(napi_env env, napi_callback_info info);
+napi_value SetParallelSkinningThreshold(napi_env env, napi_callback_info info);
+
+// 统计信息
+napi_value GetRenderStats(napi_env env, napi_callback_info info);
+
+// 实例池
+napi_value ConfigureInstancePool(napi_env env, napi_callback_info info);
+napi_value GetInstancePoolStats(napi_env env, napi_callback_info info);
+
+// 内存统计
+napi_value SetMemoryBudget(napi_env env, napi_callback_info info);
+napi_value GetMemoryStats(napi_env env, napi_callback_info info);
+
+// 性能追踪
+napi_value StartTrace(napi_env env, napi_callback_info info);
+napi_value StopTrace(napi_env env, napi_callback_info info);
+napi_value StartCommandRecording(napi_env env, napi_callback_info info);
+napi_value StopCommandRecording(napi_env env, napi_callback_info info);
+#ifdef SPINEHM_BENCHMARKS
+napi_value BenchmarkNapiMarshaling(napi_env env, napi_callback_info info);
+#endif
+
+// 帧调度
+napi_value SetFrameBudget(napi_env env, napi_callback_info info);
+napi_value SetSchedulePriority(napi_env env, napi_callback_info info);
+napi_value RunFrame(napi_env env, napi_callback_info info);
+napi_value GetFrameSchedulerStats(napi_env env, napi_callback_info info);
+
+// 共享时钟
+napi_value CreateClock(napi_env env, napi_callback_info info);
+napi_value DestroyClock(napi_env env, napi_callback_info info);
+napi_value SetClockTimeScale(napi_env env, napi_callback_info info);
+napi_value SetClockPaused(napi_env env, napi_callback_info info);
+napi_value AttachToClock(napi_env env, napi_callback_info info);
+napi_value TickClock(napi_env env, napi_callback_info info);
+
+// 命中测试
+napi_value SetSceneTransform(napi_env env, napi_callback_info info);
+napi_value HitTest(napi_env env, napi_callback_info info);
 
 // 信息获取
 napi_value GetAnimations(napi_env env, napi_callback_info info);
@@ -78,14 +136,20 @@ namespace SpineNapiUtils {
 
 // 参数解析
 inline bool ParseInt32(napi_env env, napi_value value, int32_t* result);
+inline bool ParseInt64(napi_env env, napi_value value, int64_t* result);
 inline bool ParseFloat(napi_env env, napi_value value, float* result);
 inline bool ParseBool(napi_env env, napi_value value, bool* result);
 inline bool ParseString(napi_env env, napi_value value, std::string* result);
+inline bool ParseStringArray(napi_env env, napi_value value, std::vector<std::string>* result);
+inline bool ParseInt32Array(napi_env env, napi_value value, std::vector<int32_t>* result);
+inline bool IsNullOrUndefined(napi_env env, napi_value value);
 inline bool ParseLoadOptions(napi_env env, napi_value value, SpineLoadOptions* options);
 
 // 返回值创建
 inline napi_value CreateBool(napi_env env, bool value);
 inline napi_value CreateInt32(napi_env env, int32_t value);
+inline napi_value CreateObject(napi_env env);
+inline void SetNamedNumber(napi_env env, napi_value object, const char* name, double value);
 inline napi_value CreateStringArray(napi_env env, const std::vector<std::string>& strings);
 
 // 错误处理
@@ -94,59 +158,203 @@ inline napi_value ThrowTypeError(napi_env env, const std::string& message);
 
 } // namespace SpineNapiUtils
 
+/**
+ * 名称值缓存 - 按环境持有常用字符串和名称数组的持久引用
+ * 动画和皮肤名称在加载同一骨骼数据的实例间相同，重复查询直接返回缓存的数组，不再逐项创建字符串。
+ * 名称数组按骨骼数据路径缓存，返回前冻结（多个调用方共享同一数组，需要修改时自行复制）；
+ * 数组元素为驻留的字符串，不同骨骼数据的同名动画共用同一个字符串。
+ * 引用只能在所属环境的 JS 线程上使用，因此不加锁。
+ */
+class SpineNapiValueCache {
+public:
+    enum class NameList : uint8_t {
+        kAnimations,
+        kSkins,
+    };
+    
+    SpineNapiValueCache() = default;
+    SpineNapiValueCache(const SpineNapiValueCache&) = delete;
+    SpineNapiValueCache& operator=(const SpineNapiValueCache&) = delete;
+    
+    /**
+     * 获取驻留的字符串，驻留表已满时创建新字符串
+     */
+    napi_value GetString(napi_env env, const std::string& value);
+    
+    /**
+     * 获取骨骼数据的名称数组（元素为驻留的字符串）
+     * @param dataKey 骨骼数据路径，为空时不缓存
+     * @param list 名称类别
+     * @param getNames 未命中时获取名称
+     */
+    napi_value GetNameArray(napi_env env, const std::string& dataKey, NameList list,
+                            const std::function<std::vector<std::string>()>& getNames);
+    
+    /**
+     * 释放全部引用（环境销毁时调用）
+     */
+    void Release(napi_env env);
+    
+    size_t GetStringCount() const { return strings_.size(); }
+    size_t GetArrayCount() const { return arrays_.size(); }
+    
+private:
+    std::unordered_map<std::string, napi_ref> strings_;
+    std::unordered_map<std::string, napi_ref> arrays_;  // 键为类别前缀 + 骨骼数据路径
+};
+
 /**
  * 实例注册表 - 线程安全的实例管理
+ * 模块可以在多个 napi_env（主线程和各 ArkTS Worker）中加载，每个环境初始化时登记并挂上清理钩子。
+ * 实例归创建它的环境所有，只能从该环境访问；环境销毁时释放它的全部实例和回调。
+ * 实例ID在进程内唯一（时钟、命中测试等模块按ID索引）。
  */
 class SpineInstanceRegistry {
 public:
     static SpineInstanceRegistry& getInstance();
     
-    // 实例注册和注销
-    int32_t RegisterInstance(std::unique_ptr<SpineManager> manager);
-    bool UnregisterInstance(int32_t instanceId);
-    SpineManager* GetInstance(int32_t instanceId);
+    // 环境管理
+    void RegisterEnv(napi_env env);
+    std::shared_ptr<SpineEventBuffer> GetEventBuffer(napi_env env);
+    std::shared_ptr<SpineFrameScheduler> GetScheduler(napi_env env);
+    std::shared_ptr<SpineNapiValueCache> GetValueCache(napi_env env);
     
-    // 回调管理
-    void SetEventCallback(int32_t instanceId, napi_env env, napi_ref callbackRef);
+    // 实例注册和注销（只能访问本环境创建的实例）
+    int32_t RegisterInstance(napi_env env, std::unique_ptr<SpineManager> manager);
+    bool UnregisterInstance(napi_env env, int32_t instanceId);
+    std::unique_ptr<SpineManager> TakeInstance(napi_env env, int32_t instanceId);
+    SpineManager* GetInstance(napi_env env, int32_t instanceId);
+    std::vector<int32_t> GetInstanceIds(napi_env env);
+    
+    // 回调管理（回调总是在所属环境的 JS 线程上调用）
+    bool SetEventCallback(napi_env env, int32_t instanceId, napi_value callback);
     void TriggerEvent(int32_t instanceId, const SpineAnimationEvent& event);
+    bool SetEventBatchCallback(napi_env env, napi_value callback);
+    bool GetEventBatchCallback(napi_env env, napi_value* callback);
+    
+    /**
+     * 同步投递范围（在驱动动画状态的 NAPI 入口中声明）
+     * 范围内由所属环境 JS 线程产生的事件先暂存，最外层范围结束时（实例锁已释放）直接调用回调，
+     * 不经过线程安全函数排队；其他线程产生的事件仍经线程安全函数投递
+     */
+    class EventDeliveryScope {
+    public:
+        explicit EventDeliveryScope(napi_env env);
+        ~EventDeliveryScope();
+        
+        EventDeliveryScope(const EventDeliveryScope&) = delete;
+        EventDeliveryScope& operator=(const EventDeliveryScope&) = delete;
+        
+    private:
+        napi_env env_;
+    };
     
 private:
     SpineInstanceRegistry() : nextInstanceId_(1) {}
     ~SpineInstanceRegistry();
     
+    struct EnvData {
+        std::shared_ptr<SpineEventBuffer> eventBuffer;     // 本环境实例的合并事件
+        std::shared_ptr<SpineFrameScheduler> scheduler;    // 本环境的帧调度
+        std::shared_ptr<SpineNapiValueCache> valueCache;   // 本环境的名称值缓存
+        napi_ref eventBatchCallbackRef = nullptr;
+        std::thread::id jsThread;                          // 环境的 JS 线程（登记时的线程）
+    };
+    
     struct InstanceData {
         std::unique_ptr<SpineManager> manager;
-        napi_env env = nullptr;
-        napi_ref callbackRef = nullptr;
-        std::string surfaceId;           // 独立的渲染表面
-        std::thread::id renderThreadId;  // 渲染线程ID
+        napi_env env = nullptr;                            // 所属环境
+        napi_threadsafe_function eventCallback = nullptr;  // 投递到所属环境 JS 线程的事件回调
+        napi_ref eventCallbackRef = nullptr;               // 同一回调的引用，在 JS 线程上同步调用
+        std::string surfaceId;                             // 独立的渲染表面
     };
     
+    /**
+     * 环境销毁时的清理钩子（arg 为 napi_env）
+     */
+    static void OnEnvCleanup(void* arg);
+    
+    /**
+     * 在所属环境的 JS 线程上调用事件回调（data 为待投递的事件，调用后释放）
+     */
+    static void CallEventCallback(napi_env env, napi_value callback, void* context, void* data);
+    
+    void ReleaseEventCallbackLocked(InstanceData& data);
+    
+    /**
+     * 在 JS 线程上直接调用实例的事件回调（实例已销毁或回调已移除时丢弃）
+     */
+    void DeliverEvent(napi_env env, int32_t instanceId, void* pendingEvent);
+    
+    std::unordered_map<napi_env, EnvData> envs_;
     std::unordered_map<int32_t, InstanceData> instances_;
     std::atomic<int32_t> nextInstanceId_;
-    mutable std::mutex instancesMutex_;  // 保护实例映射表
+    mutable std::mutex instancesMutex_;  // 保护环境和实例映射表
+};
+
+/**
+ * 实例池统计
+ */
+struct SpineInstancePoolStats {
+    uint64_t hits = 0;        // 从实例池复用的次数
+    uint64_t misses = 0;      // 新建实例的次数
+    size_t pooledCount = 0;   // 当前空闲实例数
+    size_t maxPoolSize = 0;
 };
 
 /**
  * Spine 实例工厂 - 负责创建完全独立的实例
+ * 销毁的实例重置后放回实例池，创建时优先复用
  */
 class SpineInstanceFactory {
 public:
     /**
      * 创建独立的 Spine 实例
+     * @param env 所属环境
      * @param surfaceId 渲染表面ID
      * @return 实例ID，失败返回 -1
      */
-    static int32_t CreateInstance(const string& surfaceId = "");
+    static int32_t CreateInstance(napi_env env, const string& surfaceId = "");
     
     /**
      * 销毁实例
+     * @param env 所属环境
      * @param instanceId 实例ID
-     * @return 是否成功
+     * @return 是否成功（实例不存在或不属于该环境时返回 false）
+     */
+    static bool DestroyInstance(napi_env env, int32_t instanceId);
+    
+    /**
+     * 配置实例池
+     * @param prewarmCount 预先创建的空闲实例数
+     * @param maxPoolSize 池中最多保留的空闲实例数
+     */
+    static void ConfigurePool(size_t prewarmCount, size_t maxPoolSize);
+    
+    /**
+     * 获取实例池统计
+     * @return 命中、未命中次数和空闲实例数
      */
-    static bool DestroyInstance(int32_t instanceId);
+    static SpineInstancePoolStats GetPoolStats();
     
 private:
+    struct InstancePool {
+        std::vector<std::unique_ptr<SpineManager>> freeList;
+        size_t maxPoolSize = 8;
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        std::mutex mutex;
+    };
+    
+    static InstancePool& GetPool();
+    
+    /**
+     * 创建新的实例（含独立的渲染上下文）
+     * @param surfaceId 渲染表面ID
+     * @return 实例
+     */
+    static std::unique_ptr<SpineManager> NewManager(const string& surfaceId);
+    
     /**
      * 为每个实例创建独立的渲染上下文
      * @param surfaceId 渲染表面ID
@@ -5,6 +5,33 @@ export interface SpineLoadOptions {
   scale: number;
   premultipliedAlpha: boolean;
   debugMode: boolean;
+  quantizeTimelines?: boolean;                 // 关键帧以 16 位量化存储，采样时解码
+  quantizeTolerance?: SpineQuantizeTolerance;
+  batchTimelines?: boolean;                    // 关键帧时间相同的骨骼时间轴合并批量采样
+  lazyAnimations?: boolean;                    // 动画在首次使用时解码（仅 JSON 骨骼数据）
+  atlasVariants?: SpineAtlasVariant[];         // 低分辨率图集变体，按显示缩放选择
+}
+
+/**
+ * 图集变体：同一图集按较低分辨率打包的版本（区域名称相同）
+ */
+export interface SpineAtlasVariant {
+  atlasPath: string;    // .atlas 或 .satlas 路径
+  scale: number;        // 相对原图集的分辨率，如 0.5、0.25
+}
+
+/**
+ * 关键帧量化的允许误差（按时间轴类型），超出误差的时间轴保留浮点
+ */
+export interface SpineQuantizeTolerance {
+  time?: number;        // 关键帧时间（秒），默认 0.0005
+  rotate?: number;      // 旋转（度），默认 0.02
+  translate?: number;   // 平移（骨骼坐标单位），默认 0.01
+  scale?: number;       // 缩放，默认 0.0005
+  shear?: number;       // 斜切（度），默认 0.02
+  color?: number;       // 颜色分量（0~1），默认 0.001
+  deform?: number;      // 网格变形偏移，默认 0.01
+  constraint?: number;  // 约束的混合值等其他数值，默认 0.0005
 }
 
 /**
@@ -30,11 +57,137 @@ export interface SpineAnimationEvent {
   eventData?: SpineEventData;
 }
 
+/**
+ * 矩形区域（视图坐标）
+ */
+export interface SpineRect {
+  left: number;
+  top: number;
+  right: number;
+  bottom: number;
+}
+
+/**
+ * 渲染统计
+ */
+export interface SpineRenderStats {
+  frameCount: number;
+  lastPixelsTouched: number;
+  totalPixelsTouched: number;
+  damage: SpineRect;
+  culledFrames: number;   // 按动画包围盒表判断不可见、跳过姿态计算的帧数
+  cachedFrames: number;   // 姿态未变、从缓存位图贴回损坏区域的帧数
+}
+
+/**
+ * 实例池统计
+ */
+export interface SpineInstancePoolStats {
+  hits: number;
+  misses: number;
+  hitRate: number;
+  pooledCount: number;
+  maxPoolSize: number;
+}
+
+/**
+ * 各类别内存字节数
+ */
+export interface SpineMemoryCategories {
+  skeletonData: number;
+  atlas: number;
+  texture: number;
+  pose: number;
+  renderBuffer: number;
+  bitmapCache: number;
+}
+
+/**
+ * 单个实例的内存用量（只包含非零类别）
+ */
+export interface SpineInstanceMemory {
+  instanceId: number;
+  totalBytes: number;
+  skeletonData?: number;
+  pose?: number;
+  renderBuffer?: number;
+  bitmapCache?: number;
+}
+
+/**
+ * 单帧调度结果
+ */
+export interface SpineFrameReport {
+  budgetMs: number;
+  elapsedMs: number;
+  overrunMs: number;      // 超出预算的时间，未超出为 0
+  updated: number;
+  deferred: number[];     // 本帧推迟的实例ID，帧间隔累计到下次更新
+}
+
+/**
+ * 帧调度累计统计
+ */
+export interface SpineFrameSchedulerStats {
+  frames: number;
+  overrunFrames: number;
+  deferrals: number;
+}
+
+/**
+ * 命中测试结果
+ */
+export interface SpineHitResult {
+  instanceId: number;
+  attachments: string[];  // 命中的包围盒附件名称，只命中实例包围盒时为空
+}
+
+/**
+ * 内存统计
+ */
+export interface SpineMemoryStats {
+  totalBytes: number;
+  budgetBytes: number;
+  evictedBytes: number;
+  categories: SpineMemoryCategories;
+  instances: SpineInstanceMemory[];
+}
+
+/**
+ * 名称列表封送的微基准结果（每次迭代处理全部名称的平均纳秒数）
+ */
+export interface SpineMarshalingBenchmark {
+  nameCount: number;
+  iterations: number;
+  createStringArrayNs: number;   // 每次新建字符串数组（CreateStringArray）
+  cachedNameArrayNs: number;     // 从名称缓存取数组
+  createStringsNs: number;       // 逐个新建字符串
+  internedStringsNs: number;     // 逐个取驻留字符串
+}
+
+/**
+ * 事件投递统计
+ */
+export interface SpineEventStats {
+  delivered: number;   // 已投递的事件数
+  filtered: number;    // 被订阅掩码或名称白名单丢弃的事件数（未设置回调时的事件不计入）
+}
+
 /**
  * 事件回调函数类型
  */
 export type SpineEventCallback = (event: SpineAnimationEvent) => void;
 
+/**
+ * 合并事件回调函数类型
+ * records 为连续的事件记录，每条 8 个 32 位字段：
+ * instanceId, type, trackIndex, animationId, eventId, intValue, floatValue（float32）, stringValueId
+ * type 与 setEventCallback 的掩码位序一致（start=0 ... event=5），字符串 ID 为 -1 表示无
+ * newStrings 为上次回调后新驻留的字符串，按 ID 顺序追加到接收方的字符串表
+ * dropped 为未及时 flush、缓冲写满后丢弃的事件数
+ */
+export type SpineEventBatchCallback = (records: ArrayBuffer, newStrings: string[], dropped: number) => void;
+
 /**
  * Spine Native 模块接口
  */
@@ -42,6 +195,7 @@ declare namespace spineNative {
 
   /**
    * 创建 Spine 实例
+   * 实例归创建它的线程（主线程或 Worker）所有，其他线程传入该ID视为无效；线程退出时自动销毁
    * @returns 实例ID，失败返回 -1
    */
   function createSpineInstance(surfaceId: string): number;
@@ -55,11 +209,38 @@ declare namespace spineNative {
 
   /**
    * 设置事件回调
+   * 未订阅的事件在原生侧直接丢弃，不会创建 JS 对象
+   * update、tickClock、runFrame、setAnimation、addAnimation、clearTrack(s) 产生的事件在调用返回前同步回调，
+   * 其他线程产生的事件异步投递到本线程
    * @param instanceId 实例ID
    * @param callback 事件回调函数
+   * @param typeMask 事件类型掩码（start=1, interrupt=2, end=4, complete=8, dispose=16, event=32），默认订阅全部
+   * @param eventNames 用户事件名称白名单，默认不限制（只作用于 event 类型）
+   * @returns 是否成功
+   */
+  function setEventCallback(instanceId: number, callback: SpineEventCallback, typeMask?: number,
+    eventNames?: string[]): boolean;
+
+  /**
+   * 获取事件投递统计
+   * @param instanceId 实例ID
+   * @returns 已投递和被订阅过滤的事件数
+   */
+  function getEventStats(instanceId: number): SpineEventStats;
+
+  /**
+   * 设置合并事件回调，设置后已订阅实例的事件写入每帧缓冲，不再逐个回调
+   * 每个线程各自设置，只收到本线程创建的实例的事件
+   * @param callback 合并事件回调，传 null 恢复逐个投递
    * @returns 是否成功
    */
-  function setEventCallback(instanceId: number, callback: SpineEventCallback): boolean;
+  function setEventBatchCallback(callback: SpineEventBatchCallback | null): boolean;
+
+  /**
+   * 把缓冲中所有实例的事件通过一次合并事件回调投递出去（每帧调用一次）
+   * @returns 投递的事件数
+   */
+  function flushEvents(): number;
 
   /**
    * 加载 Spine 数据
@@ -76,6 +257,16 @@ declare namespace spineNative {
     options: SpineLoadOptions
   ): boolean;
 
+  /**
+   * 从资源包加载 Spine 数据
+   * 资源包（.sbundle，由 tools/spine_bundle_pack 生成）包含骨骼数据和图集容器，只打开、映射一次文件
+   * @param instanceId 实例ID
+   * @param bundlePath 资源包路径
+   * @param options 加载选项
+   * @returns 是否成功
+   */
+  function loadSpineBundle(instanceId: number, bundlePath: string, options: SpineLoadOptions): boolean;
+
   /**
    * 设置动画
    * @param instanceId 实例ID
@@ -108,6 +299,14 @@ declare namespace spineNative {
     delay: number
   ): boolean;
 
+  /**
+   * 预先解码动画（以 lazyAnimations 加载时避免首次播放时解码）
+   * @param instanceId 实例ID
+   * @param animationNames 动画名称列表
+   * @returns 是否全部存在
+   */
+  function preloadAnimations(instanceId: number, animationNames: string[]): boolean;
+
   /**
    * 设置皮肤
    * @param instanceId 实例ID
@@ -177,17 +376,27 @@ declare namespace spineNative {
    */
   function updateViewSize(instanceId: number, width: number, height: number): boolean;
 
+  /**
+   * 设置显示缩放（配置了图集变体时按缩放在后台切换变体）
+   * @param instanceId 实例ID
+   * @param scale 缩放比例
+   * @returns 是否成功
+   */
+  function setScale(instanceId: number, scale: number): boolean;
+
   /**
    * 获取动画列表
+   * 加载同一骨骼数据的实例返回同一个冻结数组，需要修改时先复制
    * @param instanceId 实例ID
-   * @returns 动画名称数组
+   * @returns 动画名称数组（只读）
    */
   function getAnimations(instanceId: number): string[];
 
   /**
    * 获取皮肤列表
+   * 加载同一骨骼数据的实例返回同一个冻结数组，需要修改时先复制
    * @param instanceId 实例ID
-   * @returns 皮肤名称数组
+   * @returns 皮肤名称数组（只读）
    */
   function getSkins(instanceId: number): string[];
 
@@ -201,7 +410,7 @@ declare namespace spineNative {
   /**
    * 更新动画（每帧调用）
    * @param instanceId 实例ID
-   * @param deltaTime 帧间隔时间（秒）
+   * @param deltaTime 帧间隔时间（秒），按实例所挂时钟链的有效缩放推进
    * @returns 是否成功
    */
   function update(instanceId: number, deltaTime: number): boolean;
@@ -212,6 +421,245 @@ declare namespace spineNative {
    * @returns 是否成功
    */
   function render(instanceId: number): boolean;
+
+  /**
+   * 设置每帧 Update + Render 的时间预算（所有实例共享）
+   * @param budgetMs 预算（毫秒），0 表示不限制
+   * @returns 是否成功
+   */
+  function setFrameBudget(budgetMs: number): boolean;
+
+  /**
+   * 设置实例的调度优先级，预算不足时优先级高的实例先更新
+   * @param instanceId 实例ID
+   * @param priority 优先级，默认 0，越大越优先
+   * @returns 是否成功
+   */
+  function setSchedulePriority(instanceId: number, priority: number): boolean;
+
+  /**
+   * 按帧预算更新并渲染实例（替代逐实例的 update + render，每帧调用一次）
+   * 按优先级、视图面积和推迟帧数排序，预算内放不下的实例推迟并累计帧间隔
+   * @param deltaTime 帧时间间隔（秒）
+   * @param instanceIds 可见实例ID，默认本线程的所有实例；未列出的实例不更新，调度状态被丢弃
+   * @returns 本帧调度结果
+   */
+  function runFrame(deltaTime: number, instanceIds?: number[]): SpineFrameReport;
+
+  /**
+   * 获取帧调度的累计统计
+   */
+  function getFrameSchedulerStats(): SpineFrameSchedulerStats;
+
+  /**
+   * 创建共享时钟
+   * 时钟属于当前线程（主线程或 Worker），只能在该线程上使用，线程退出时自动销毁
+   * @param parentId 父时钟ID，默认为根时钟；有效缩放为时钟链上所有缩放的乘积
+   * @returns 时钟ID，父时钟不存在或由其他线程创建时返回 -1
+   */
+  function createClock(parentId?: number): number;
+
+  /**
+   * 销毁时钟，子时钟改挂到其父时钟，挂在其上的实例恢复独立计时
+   * @param clockId 时钟ID
+   * @returns 是否成功
+   */
+  function destroyClock(clockId: number): boolean;
+
+  /**
+   * 设置时钟的时间缩放（作用于所有子时钟和挂载的实例）
+   * @param clockId 时钟ID
+   * @param timeScale 时间缩放
+   * @returns 是否成功
+   */
+  function setClockTimeScale(clockId: number, timeScale: number): boolean;
+
+  /**
+   * 暂停或恢复时钟（子时钟一并停止）
+   * @param clockId 时钟ID
+   * @param paused 是否暂停
+   * @returns 是否成功
+   */
+  function setClockPaused(clockId: number, paused: boolean): boolean;
+
+  /**
+   * 把实例挂到时钟上
+   * @param instanceId 实例ID
+   * @param clockId 时钟ID，-1 表示取下
+   * @returns 是否成功
+   */
+  function attachToClock(instanceId: number, clockId: number): boolean;
+
+  /**
+   * 推进时钟：按有效缩放更新并渲染挂在该时钟及其子时钟上的所有实例
+   * runFrame 调度的实例同样按所挂时钟缩放帧间隔
+   * @param clockId 时钟ID
+   * @param deltaTime 帧时间间隔（秒）
+   * @returns 更新的实例数
+   */
+  function tickClock(clockId: number, deltaTime: number): number;
+
+  /**
+   * 设置实例在场景中的位置（视图左上角）和层级，设置后参与命中测试
+   * 包围盒在每次 Update 后发布
+   * @param instanceId 实例ID
+   * @param x 场景坐标 x
+   * @param y 场景坐标 y
+   * @param zIndex 层级，默认为 0
+   * @returns 是否成功
+   */
+  function setSceneTransform(instanceId: number, x: number, y: number, zIndex?: number): boolean;
+
+  /**
+   * 命中测试
+   * @param x 场景坐标 x
+   * @param y 场景坐标 y
+   * @returns 触点下的实例，按层级从高到低排列
+   */
+  function hitTest(x: number, y: number): SpineHitResult[];
+
+  /**
+   * 加入姿态共享组
+   * 同一骨骼、同一动画同步播放的实例可共享姿态，由组内第一个实例计算
+   * @param instanceId 实例ID
+   * @param groupId 组ID
+   * @returns 是否成功（骨骼或动画状态与组不一致时失败）
+   */
+  function joinPoseGroup(instanceId: number, groupId: number): boolean;
+
+  /**
+   * 离开姿态共享组
+   * @param instanceId 实例ID
+   * @returns 是否成功
+   */
+  function leavePoseGroup(instanceId: number): boolean;
+
+  /**
+   * 设置着色
+   * @param instanceId 实例ID
+   * @param r 红色分量（0~1）
+   * @param g 绿色分量（0~1）
+   * @param b 蓝色分量（0~1）
+   * @param a 透明度（0~1）
+   * @returns 是否成功
+   */
+  function setTint(instanceId: number, r: number, g: number, b: number, a: number): boolean;
+
+  /**
+   * 设置是否预乘 Alpha
+   * 未预乘的图集容器在两种页面像素间切换（预乘页面首次使用时转换并缓存），不重新加载；
+   * 已预乘的图集容器始终按预乘处理
+   * @param instanceId 实例ID
+   * @param premultipliedAlpha 是否预乘 Alpha
+   * @returns 是否成功
+   */
+  function setPremultipliedAlpha(instanceId: number, premultipliedAlpha: boolean): boolean;
+
+  /**
+   * 设置视图在屏幕上可见的部分（视图坐标，如滚动容器中被裁掉一部分的视图）
+   * Update 时按动画包围盒表判断骨骼与该区域不相交则跳过姿态计算，动画时间和事件照常推进
+   * @param instanceId 实例ID
+   * @param left 左
+   * @param top 上
+   * @param right 右
+   * @param bottom 下，区域为空表示完全不可见
+   * @returns 是否成功
+   */
+  function setVisibleRect(instanceId: number, left: number, top: number, right: number, bottom: number): boolean;
+
+  /**
+   * 取消可见区域，恢复为整个视图
+   * @param instanceId 实例ID
+   * @returns 是否成功
+   */
+  function clearVisibleRect(instanceId: number): boolean;
+
+  /**
+   * 设置位图缓存的内存预算（所有实例共享）
+   * 暂停或姿态未变化的实例会光栅化为位图缓存，之后每帧直接贴图
+   * @param budgetBytes 预算字节数，0 表示禁用
+   * @returns 是否成功
+   */
+  function setBitmapCacheBudget(budgetBytes: number): boolean;
+
+  /**
+   * 设置并行蒙皮阈值（所有实例共享）
+   * 顶点数不低于阈值的网格拆分到工作线程计算，结果与单线程一致
+   * @param vertexCount 顶点数阈值，0 表示禁用并行，默认 2048
+   * @returns 是否成功
+   */
+  function setParallelSkinningThreshold(vertexCount: number): boolean;
+
+  /**
+   * 获取渲染统计
+   * @param instanceId 实例ID
+   * @returns 帧数、上一帧及累计重绘像素数、上一帧损坏区域
+   */
+  function getRenderStats(instanceId: number): SpineRenderStats;
+
+  /**
+   * 配置实例池（建议在应用启动时调用）
+   * 销毁的实例重置后放回池中，创建实例时优先复用
+   * @param prewarmCount 预先创建的空闲实例数
+   * @param maxPoolSize 池中最多保留的空闲实例数
+   * @returns 是否成功
+   */
+  function configureInstancePool(prewarmCount: number, maxPoolSize: number): boolean;
+
+  /**
+   * 获取实例池统计
+   * @returns 命中、未命中次数、命中率和空闲实例数
+   */
+  function getInstancePoolStats(): SpineInstancePoolStats;
+
+  /**
+   * 设置全局内存预算
+   * 总量超出时依次淘汰位图缓存和已解压的图集页面
+   * @param budgetBytes 预算字节数，0 表示不限制
+   * @returns 是否成功
+   */
+  function setMemoryBudget(budgetBytes: number): boolean;
+
+  /**
+   * 获取内存统计
+   * 分类总量包含共享资源和实例池中的空闲实例；实例列表只包含实例自身的缓冲和位图
+   * @returns 总量、预算、累计淘汰量、各类别及各实例的字节数
+   */
+  function getMemoryStats(): SpineMemoryStats;
+
+  /**
+   * 开始记录帧阶段追踪（加载、更新、渲染各阶段及 NAPI 调用）
+   * @returns 是否成功，已在记录时返回 false
+   */
+  function startTrace(): boolean;
+
+  /**
+   * 停止记录并写出 Chrome trace 事件 JSON，可在 Perfetto 或 chrome://tracing 中打开
+   * @param path 输出文件路径（应用沙箱内可写路径）
+   * @returns 是否成功
+   */
+  function stopTrace(path: string): boolean;
+
+  /**
+   * 开始录制所有实例的命令流（创建、加载、动画控制、update/render 及时间戳）
+   * 录制的日志可在开发机上用 tools/spine_command_replay 重放并统计耗时
+   * @param path 日志文件路径（应用沙箱内可写路径）
+   * @returns 是否成功，已在录制时返回 false
+   */
+  function startCommandRecording(path: string): boolean;
+
+  /**
+   * 停止录制命令流并写出剩余数据
+   * @returns 录制的命令数
+   */
+  function stopCommandRecording(): number;
+
+  /**
+   * 名称列表封送的微基准（逐项创建字符串与使用名称缓存对比）
+   * 只在调试构建中导出，发布构建中为 undefined；由 ohosTest 运行
+   * 参数 nameCount 为名称数，默认 32；iterations 为重复次数，默认 1000
+   */
+  const benchmarkNapiMarshaling: ((nameCount?: number, iterations?: number) => SpineMarshalingBenchmark) | undefined;
 }
 
 export default spineNative; 
\ No newline at end of file
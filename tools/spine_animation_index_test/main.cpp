@@ -0,0 +1,187 @@
+//
+// Created on 2026/10/19.
+//
+
+/**
+ * spine_animation_index_test - JSON 动画索引扫描测试（ctest）
+ * 用小段 JSON 检查 SpineAnimationIndex 记录的动画范围和去掉动画后的骨骼文本：
+ * 转义的引号和连续反斜杠、代理对（😀）名称、嵌套对象中的 "animations" 键、
+ * 截断的输入和不匹配的括号（必须返回 nullptr）。
+ *
+ * 用法：
+ *   spine_animation_index_test
+ */
+
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+#include "asset/SpineAnimationIndex.h"
+
+using std::string;
+using std::vector;
+
+namespace {
+
+struct Context {
+    int failures = 0;
+    int checks = 0;
+};
+
+void Expect(Context* context, bool condition, const string& what) {
+    context->checks++;
+    if (!condition) {
+        context->failures++;
+        std::fprintf(stderr, "FAIL %s\n", what.c_str());
+    }
+}
+
+/**
+ * 期望的动画：反转义后的名称、原始键（含引号）和值
+ */
+struct ExpectedAnimation {
+    string name;
+    string key;
+    string value;
+};
+
+/**
+ * 按片段拼出文档，记录各动画的原始键和值，期望的骨骼文本为动画值替换为 {} 后的文档
+ */
+struct Fixture {
+    const char* name;
+    string prefix;                        // "animations" 的值之前
+    vector<ExpectedAnimation> animations; // 按顺序以 ", " 分隔组成 "animations" 的值
+    string suffix;                        // "animations" 的值之后
+
+    string Text() const {
+        string text = prefix + "{";
+        for (size_t i = 0; i < animations.size(); ++i) {
+            text += (i > 0 ? ", " : "") + animations[i].key + ": " + animations[i].value;
+        }
+        return text + "}" + suffix;
+    }
+
+    string SkeletonText() const { return prefix + "{}" + suffix; }
+};
+
+std::shared_ptr<const SpineAnimationIndex> Build(const string& text) {
+    // 复制到恰好大小的缓冲，越界读取可被 ASan 发现
+    std::shared_ptr<char> copy(new char[text.size() + 1], std::default_delete<char[]>());
+    std::memcpy(copy.get(), text.data(), text.size());
+    return SpineAnimationIndex::Build(copy, copy.get(), text.size());
+}
+
+void TestFixture(Context* context, const Fixture& fixture) {
+    const string text = fixture.Text();
+    std::shared_ptr<const SpineAnimationIndex> index = Build(text);
+    const string name = fixture.name;
+    Expect(context, index != nullptr, name + ": index built");
+    if (!index) {
+        return;
+    }
+    Expect(context, index->GetAnimationCount() == fixture.animations.size(), name + ": animation count");
+    Expect(context, index->GetSkeletonText() == fixture.SkeletonText(), name + ": skeleton text without animations");
+    for (size_t i = 0; i < fixture.animations.size() && i < index->GetAnimationCount(); ++i) {
+        const ExpectedAnimation& animation = fixture.animations[i];
+        Expect(context, index->GetAnimationName(i) == animation.name, name + ": name of animation " + std::to_string(i));
+        Expect(context, index->Find(animation.name) == static_cast<int32_t>(i), name + ": find " + animation.key);
+        Expect(context, index->GetAnimationTextSize(i) == animation.value.size(),
+               name + ": value range of " + animation.key);
+        Expect(context, index->GetAnimationText(i) == "{" + animation.key + ":" + animation.value + "}",
+               name + ": text of " + animation.key);
+    }
+}
+
+const string kWalk = R"({"bones": {"root": {"rotate": [{"time": 0.5, "value": 90}]}}})";
+const string kRun = R"({"events": [{"time": 0.2, "name": "step", "string": "}]\"{["}]})";
+
+vector<Fixture> Fixtures() {
+    vector<Fixture> fixtures;
+    fixtures.push_back({"plain", R"({"skeleton": {"spine": "4.2.00"}, "animations": )",
+                        {{"walk", R"("walk")", kWalk}, {"run", R"("run")", kRun}}, R"(, "skins": []})"});
+
+    // 转义的引号、连续反斜杠（偶数个反斜杠后的引号结束字符串）
+    fixtures.push_back({"escapes", R"({"bones": [{"name": "a\\"}, {"name": "b\"}\\\""}], "animations": )",
+                        {{"say \"hi\"", R"("say \"hi\"")", kWalk},
+                         {"back\\", R"("back\\")", "{}"},
+                         {"\\\"", R"("\\\"")", kRun},
+                         {"tab\t/slash", R"("tab\t\/slash")", "{}"}},
+                        R"(, "events": {"\\": {}}})"});
+
+    // 非 BMP 字符：代理对解码为 4 字节 UTF-8，BMP 转义和原始 UTF-8 字节
+    fixtures.push_back({"unicode", R"({"animations": )",
+                        {{"\xF0\x9F\x98\x80", R"("\uD83D\uDE00")", kWalk},
+                         {"\xC3\xA9t\xC3\xA9", R"("\u00e9t\u00E9")", "{}"},
+                         {"\xE8\xB7\x91", "\"\xE8\xB7\x91\"", kRun}},
+                        "}"});
+
+    // 嵌套对象和字符串中的 "animations" 不是顶层的动画
+    fixtures.push_back({"nested key",
+                        R"({"skins": [{"name": "default", "animations": {"fake": {}}}], )"
+                        R"("note": "\"animations\": {", "animations": )",
+                        {{"idle", R"("idle")", R"({"animations": {"inner": []}})"}},
+                        R"(, "extra": {"animations": {"ignored": {}}}})"});
+
+    // 重复的 "animations" 以第一个为准
+    fixtures.push_back({"duplicate key", R"({"animations": )", {{"first", R"("first")", "{}"}},
+                        R"(, "animations": {"second": {}}})"});
+
+    // 没有动画
+    fixtures.push_back({"empty animations", "{\n\t\"bones\": [],\r\n\"animations\": ", {}, "\n}"});
+    return fixtures;
+}
+
+void TestRejected(Context* context) {
+    // 截断：合法文档的每个真前缀都不是完整的对象
+    const Fixture plain = Fixtures()[0];
+    const string text = plain.Text();
+    bool truncatedRejected = true;
+    for (size_t size = 0; size < text.size(); ++size) {
+        if (Build(text.substr(0, size)) != nullptr) {
+            truncatedRejected = false;
+            std::fprintf(stderr, "prefix of %zu / %zu bytes accepted\n", size, text.size());
+            break;
+        }
+    }
+    Expect(context, truncatedRejected, "truncated input rejected");
+
+    const std::pair<const char*, const char*> cases[] = {
+        {"mismatched bracket in animation", R"({"animations": {"walk": {"bones": [1, 2}}}})"},
+        {"mismatched bracket in other value", R"({"bones": [{"name": "root"]], "animations": {}})"},
+        {"mismatched bracket in nested array", R"({"animations": {"walk": {"a": [[1], {]}}}})"},
+        {"unterminated string", R"({"animations": {"walk": {"name": "ab\"}}})"},
+        {"unterminated key", R"({"animations": {"walk\": {}}})"},
+        {"animation value not an object", R"({"animations": {"walk": []}})"},
+        {"missing colon", R"({"animations": {"walk" {}}})"},
+        {"bad escape in name", R"({"animations": {"wa\qlk": {}}})"},
+        {"short unicode escape in name", R"({"animations": {"\u12": {}}})"},
+        {"escape at end of name", "{\"animations\": {\"walk\\"},
+        {"missing comma", R"({"animations": {"walk": {} "run": {}}})"},
+        {"not an object", R"(["animations"])"},
+        {"empty", ""},
+    };
+    for (const auto& testCase : cases) {
+        Expect(context, Build(testCase.second) == nullptr, string("rejected: ") + testCase.first);
+    }
+
+    // 转义的键不按原始字节匹配 "animations"，整段留在骨骼文本中由运行时解析
+    const string escapedKey = R"({"anim\u0061tions": {"walk": {}}})";
+    std::shared_ptr<const SpineAnimationIndex> index = Build(escapedKey);
+    Expect(context, index && index->GetAnimationCount() == 0 && index->GetSkeletonText() == escapedKey,
+           "escaped animations key left in the skeleton text");
+}
+
+} // namespace
+
+int main() {
+    Context context;
+    for (const Fixture& fixture : Fixtures()) {
+        TestFixture(&context, fixture);
+    }
+    TestRejected(&context);
+
+    std::printf("%d checks, %d failures\n", context.checks, context.failures);
+    return context.failures == 0 ? 0 : 1;
+}
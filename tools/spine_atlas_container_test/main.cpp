@@ -0,0 +1,315 @@
+//
+// Created on 2026/10/19.
+//
+
+/**
+ * spine_atlas_container_test - LZ4 编解码与图集容器校验测试（ctest）
+ * LZ4：不可压缩数据、长重复、不超过 12 字节的短输入往返一致；截断的流、偏移为 0 或越过输出起点的匹配、
+ * 与实际大小不符的输出长度都必须解压失败。
+ * 图集容器：在内存中构造容器经 OpenView 校验，合法容器能读出页面像素，页面表、区域表、字符串表越界或字段不一致时打开失败。
+ *
+ * 用法：
+ *   spine_atlas_container_test [--seed <n>]
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include "asset/SpineAtlasContainer.h"
+#include "asset/SpineLz4.h"
+
+using std::string;
+using std::vector;
+using namespace SpineAtlasContainerFormat;
+
+namespace {
+
+struct Context {
+    std::mt19937 rng;
+    int failures = 0;
+    int checks = 0;
+};
+
+void Expect(Context* context, bool condition, const string& what) {
+    context->checks++;
+    if (!condition) {
+        context->failures++;
+        std::fprintf(stderr, "FAIL %s\n", what.c_str());
+    }
+}
+
+// ==================== LZ4 ====================
+
+vector<uint8_t> RandomBytes(std::mt19937& rng, size_t size) {
+    vector<uint8_t> data(size);
+    for (uint8_t& byte : data) {
+        byte = static_cast<uint8_t>(rng());
+    }
+    return data;
+}
+
+bool RoundTrip(const vector<uint8_t>& data, vector<uint8_t>* compressed) {
+    SpineLz4::Compress(data.data(), data.size(), compressed);
+    vector<uint8_t> decoded(data.size() + 1, 0xcd);
+    return SpineLz4::Decompress(compressed->data(), compressed->size(), decoded.data(), data.size()) &&
+           (data.empty() || std::memcmp(decoded.data(), data.data(), data.size()) == 0) && decoded[data.size()] == 0xcd;
+}
+
+void TestLz4RoundTrip(Context* context) {
+    vector<uint8_t> compressed;
+
+    // 不超过 12 字节时整块为字面量
+    for (size_t size = 0; size <= 13; ++size) {
+        const vector<uint8_t> zeros(size, 0);
+        Expect(context, RoundTrip(zeros, &compressed), "round trip zeros size " + std::to_string(size));
+        Expect(context, RoundTrip(RandomBytes(context->rng, size), &compressed),
+               "round trip random size " + std::to_string(size));
+    }
+
+    // 不可压缩数据：输出只比输入多长度字节
+    const vector<uint8_t> noise = RandomBytes(context->rng, 300000);
+    Expect(context, RoundTrip(noise, &compressed), "round trip incompressible");
+    Expect(context, compressed.size() <= noise.size() + noise.size() / 255 + 16, "incompressible output bound");
+
+    // 长重复：重叠复制（偏移 1、2、3）和超过 64KB 窗口的重复
+    for (size_t period : {1, 2, 3, 7, 70000}) {
+        const vector<uint8_t> pattern = RandomBytes(context->rng, period);
+        vector<uint8_t> runs(1 << 18);
+        for (size_t i = 0; i < runs.size(); ++i) {
+            runs[i] = pattern[i % period];
+        }
+        Expect(context, RoundTrip(runs, &compressed), "round trip period " + std::to_string(period));
+        if (period < 100) {
+            Expect(context, compressed.size() < runs.size() / 100, "runs compress, period " + std::to_string(period));
+        }
+    }
+
+    // 图集页面的典型内容：大片透明加少量随机块
+    vector<uint8_t> page(256 * 256 * 4, 0);
+    for (size_t block = 0; block < 64; ++block) {
+        const size_t start = context->rng() % (page.size() - 512);
+        const vector<uint8_t> bytes = RandomBytes(context->rng, 512);
+        std::memcpy(page.data() + start, bytes.data(), bytes.size());
+    }
+    Expect(context, RoundTrip(page, &compressed), "round trip sparse page");
+}
+
+void TestLz4Corruption(Context* context) {
+    vector<uint8_t> data(4000);
+    for (size_t i = 0; i < data.size(); ++i) {
+        data[i] = static_cast<uint8_t>((i / 16) % 7 == 0 ? context->rng() : i % 13);
+    }
+    vector<uint8_t> compressed;
+    SpineLz4::Compress(data.data(), data.size(), &compressed);
+    vector<uint8_t> output(data.size() + 64);
+
+    // 任意位置截断
+    bool truncatedRejected = true;
+    for (size_t size = 0; size < compressed.size(); ++size) {
+        if (SpineLz4::Decompress(compressed.data(), size, output.data(), data.size())) {
+            truncatedRejected = false;
+            std::fprintf(stderr, "truncated stream of %zu / %zu bytes accepted\n", size, compressed.size());
+            break;
+        }
+    }
+    Expect(context, truncatedRejected, "truncated streams rejected");
+
+    // 输出长度与原始大小不符
+    Expect(context, !SpineLz4::Decompress(compressed.data(), compressed.size(), output.data(), data.size() - 1),
+           "output too short rejected");
+    Expect(context, !SpineLz4::Decompress(compressed.data(), compressed.size(), output.data(), data.size() + 1),
+           "output too long rejected");
+    Expect(context, SpineLz4::Decompress(compressed.data(), compressed.size(), output.data(), data.size()),
+           "exact output size accepted");
+
+    // 手工构造：4 字节字面量 "abcd" 后接匹配（长度 4），再接 5 字节字面量的最后一个序列
+    auto makeStream = [](uint16_t offset) {
+        return vector<uint8_t>{0x40, 'a', 'b', 'c', 'd', static_cast<uint8_t>(offset & 0xff),
+                               static_cast<uint8_t>(offset >> 8), 0x50, 'v', 'w', 'x', 'y', 'z'};
+    };
+    const size_t streamOutput = 4 + 4 + 5;
+    vector<uint8_t> stream = makeStream(4);
+    Expect(context, SpineLz4::Decompress(stream.data(), stream.size(), output.data(), streamOutput) &&
+                    std::memcmp(output.data(), "abcdabcdvwxyz", streamOutput) == 0,
+           "hand-built stream decodes");
+    stream = makeStream(0);
+    Expect(context, !SpineLz4::Decompress(stream.data(), stream.size(), output.data(), streamOutput),
+           "offset 0 rejected");
+    stream = makeStream(5);
+    Expect(context, !SpineLz4::Decompress(stream.data(), stream.size(), output.data(), streamOutput),
+           "offset past output start rejected");
+    stream = makeStream(0xffff);
+    Expect(context, !SpineLz4::Decompress(stream.data(), stream.size(), output.data(), streamOutput),
+           "offset 65535 past output start rejected");
+
+    // 匹配长度越过输出末尾
+    stream = {0x4f, 'a', 'b', 'c', 'd', 0x01, 0x00, 0xff, 0xff, 0x10, 'z'};
+    Expect(context, !SpineLz4::Decompress(stream.data(), stream.size(), output.data(), 40),
+           "match past output end rejected");
+    // 扩展长度字节缺失
+    stream = {0xf0};
+    Expect(context, !SpineLz4::Decompress(stream.data(), stream.size(), output.data(), 15),
+           "missing length byte rejected");
+}
+
+// ==================== 图集容器 ====================
+
+/**
+ * 内存中的容器：两个页面（未压缩与 LZ4）、三个区域
+ */
+struct ContainerBytes {
+    std::shared_ptr<vector<uint64_t>> storage;  // 按 8 字节对齐
+    size_t size = 0;
+    vector<uint8_t> pagePixels[2];
+
+    uint8_t* Data() { return reinterpret_cast<uint8_t*>(storage->data()); }
+    Header* GetHeader() { return reinterpret_cast<Header*>(Data()); }
+    Page* GetPages() { return reinterpret_cast<Page*>(Data() + GetHeader()->pageTableOffset); }
+    Region* GetRegions() { return reinterpret_cast<Region*>(Data() + GetHeader()->regionTableOffset); }
+};
+
+size_t AlignUp(size_t value, size_t alignment) {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+ContainerBytes BuildContainer(std::mt19937& rng) {
+    ContainerBytes container;
+    const string strings = string("page0.png") + '\0' + "page1.png" + '\0' + "head" + '\0' + "body" + '\0' + "arm" + '\0';
+    const string atlasText = "page0.png\nsize: 8,4\nhead\n  bounds: 0, 0, 4, 4\n";
+
+    container.pagePixels[0] = RandomBytes(rng, 8 * 4 * 4);
+    container.pagePixels[1].assign(16 * 16 * 4, 0);
+    container.pagePixels[1][100] = 7;
+    vector<uint8_t> compressed;
+    SpineLz4::Compress(container.pagePixels[1].data(), container.pagePixels[1].size(), &compressed);
+
+    Header header = {};
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.version = kVersion;
+    header.alignment = kPageAlignment;
+    header.pageCount = 2;
+    header.regionCount = 3;
+    header.pageTableOffset = sizeof(Header);
+    header.regionTableOffset = header.pageTableOffset + 2 * sizeof(Page);
+    header.stringTableOffset = header.regionTableOffset + 3 * sizeof(Region);
+    header.stringTableSize = strings.size();
+    header.atlasTextOffset = header.stringTableOffset + strings.size();
+    header.atlasTextSize = atlasText.size();
+
+    Page pages[2] = {};
+    pages[0] = Page{0, 8, 4, kCompressionNone, AlignUp(header.atlasTextOffset + atlasText.size(), kPageAlignment),
+                    container.pagePixels[0].size(), container.pagePixels[0].size()};
+    pages[1] = Page{10, 16, 16, kCompressionLz4, AlignUp(pages[0].dataOffset + pages[0].dataSize, kPageAlignment),
+                    compressed.size(), container.pagePixels[1].size()};
+    const uint32_t regionNames[3] = {20, 25, 30};
+    Region regions[3] = {};
+    for (uint32_t i = 0; i < 3; ++i) {
+        regions[i].nameOffset = regionNames[i];
+        regions[i].pageIndex = i == 2 ? 1 : 0;
+        regions[i].width = 4;
+        regions[i].height = 4;
+        regions[i].index = -1;
+    }
+
+    container.size = static_cast<size_t>(pages[1].dataOffset + compressed.size());
+    container.storage = std::make_shared<vector<uint64_t>>(AlignUp(container.size, 8) / 8, 0);
+    uint8_t* data = container.Data();
+    std::memcpy(data, &header, sizeof(header));
+    std::memcpy(data + header.pageTableOffset, pages, sizeof(pages));
+    std::memcpy(data + header.regionTableOffset, regions, sizeof(regions));
+    std::memcpy(data + header.stringTableOffset, strings.data(), strings.size());
+    std::memcpy(data + header.atlasTextOffset, atlasText.data(), atlasText.size());
+    std::memcpy(data + pages[0].dataOffset, container.pagePixels[0].data(), container.pagePixels[0].size());
+    std::memcpy(data + pages[1].dataOffset, compressed.data(), compressed.size());
+    return container;
+}
+
+std::shared_ptr<SpineAtlasContainer> Open(ContainerBytes& container) {
+    return SpineAtlasContainer::OpenView("test.satlas", container.storage, container.Data(), container.size);
+}
+
+void TestContainer(Context* context) {
+    ContainerBytes valid = BuildContainer(context->rng);
+    std::shared_ptr<SpineAtlasContainer> opened = Open(valid);
+    Expect(context, opened != nullptr, "valid container opens");
+    if (opened) {
+        Expect(context, opened->GetPageCount() == 2 && opened->FindPage("page1.png") == 1, "page table read");
+        const uint8_t* raw = opened->GetPagePixels(0);
+        const uint8_t* decoded = opened->GetPagePixels(1);
+        Expect(context, raw && std::memcmp(raw, valid.pagePixels[0].data(), valid.pagePixels[0].size()) == 0,
+               "uncompressed page pixels");
+        Expect(context,
+               decoded && std::memcmp(decoded, valid.pagePixels[1].data(), valid.pagePixels[1].size()) == 0,
+               "LZ4 page pixels");
+        Expect(context, opened->GetPagePixels(2) == nullptr, "page index out of range");
+    }
+
+    // 每个用例在一份新的合法容器上改动一处
+    const std::pair<const char*, std::function<void(ContainerBytes&)>> cases[] = {
+        {"bad magic", [](ContainerBytes& c) { c.GetHeader()->magic[0] = 'X'; }},
+        {"bad version", [](ContainerBytes& c) { c.GetHeader()->version = kVersion + 1; }},
+        {"page table past end", [](ContainerBytes& c) { c.GetHeader()->pageTableOffset = c.size - sizeof(Page); }},
+        {"page count overflow", [](ContainerBytes& c) { c.GetHeader()->pageCount = 0xffffffffu; }},
+        {"page table misaligned", [](ContainerBytes& c) { c.GetHeader()->pageTableOffset += 4; }},
+        {"region table past end", [](ContainerBytes& c) { c.GetHeader()->regionTableOffset = c.size; }},
+        {"region count overflow", [](ContainerBytes& c) { c.GetHeader()->regionCount = 0x7fffffffu; }},
+        {"region table misaligned", [](ContainerBytes& c) { c.GetHeader()->regionTableOffset += 2; }},
+        {"string table past end", [](ContainerBytes& c) { c.GetHeader()->stringTableSize = c.size; }},
+        {"string table offset wraps", [](ContainerBytes& c) { c.GetHeader()->stringTableOffset = ~0ull; }},
+        {"string table not terminated", [](ContainerBytes& c) { c.GetHeader()->stringTableSize -= 1; }},
+        {"atlas text past end", [](ContainerBytes& c) { c.GetHeader()->atlasTextSize = c.size; }},
+        {"page name past string table", [](ContainerBytes& c) { c.GetPages()[0].nameOffset = 1000; }},
+        {"page data past end", [](ContainerBytes& c) { c.GetPages()[1].dataSize += 1; }},
+        {"page data offset wraps", [](ContainerBytes& c) { c.GetPages()[0].dataOffset = ~0ull - 8; }},
+        {"page raw size mismatch", [](ContainerBytes& c) { c.GetPages()[1].rawSize += 4; }},
+        {"page size overflow", [](ContainerBytes& c) { c.GetPages()[0].width = 0x80000000u; }},
+        {"uncompressed size mismatch", [](ContainerBytes& c) { c.GetPages()[0].dataSize -= 4; }},
+        {"unknown compression", [](ContainerBytes& c) { c.GetPages()[0].compression = kCompressionLz4 + 1; }},
+        {"region name past string table", [](ContainerBytes& c) { c.GetRegions()[2].nameOffset = 1000; }},
+        {"region page out of range", [](ContainerBytes& c) { c.GetRegions()[1].pageIndex = 2; }},
+    };
+    for (const auto& testCase : cases) {
+        ContainerBytes container = BuildContainer(context->rng);
+        testCase.second(container);
+        Expect(context, Open(container) == nullptr, string("container rejected: ") + testCase.first);
+    }
+
+    // 截断到文件头以内
+    ContainerBytes truncated = BuildContainer(context->rng);
+    truncated.size = sizeof(Header) - 1;
+    Expect(context, Open(truncated) == nullptr, "container rejected: shorter than header");
+
+    // LZ4 页面数据损坏：容器能打开，解压失败时返回 nullptr
+    ContainerBytes corrupt = BuildContainer(context->rng);
+    corrupt.Data()[corrupt.GetPages()[1].dataOffset] = 0xff;
+    opened = Open(corrupt);
+    Expect(context, opened && opened->GetPagePixels(1) == nullptr, "corrupt LZ4 page returns nullptr");
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    uint32_t seed = 20261019;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            seed = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        } else {
+            std::fprintf(stderr, "usage: %s [--seed <n>]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    Context context;
+    context.rng.seed(seed);
+    TestLz4RoundTrip(&context);
+    TestLz4Corruption(&context);
+    TestContainer(&context);
+
+    std::printf("seed %u: %d checks, %d failures\n", seed, context.checks, context.failures);
+    return context.failures == 0 ? 0 : 1;
+}
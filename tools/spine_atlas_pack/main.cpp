@@ -0,0 +1,369 @@
+//
+// Created on 2026/10/19.
+//
+
+/**
+ * spine_atlas_pack - 离线生成图集容器（.satlas）
+ * 解析 .atlas 文本，解码其中引用的 PNG 页面，输出可 mmap 的 RGBA 页面容器。
+ *
+ * 用法：
+ *   spine_atlas_pack <input.atlas> <output.satlas> [--lz4] [--premultiply]
+ *
+ *   --lz4          页面使用 LZ4 压缩（默认原始 RGBA，加载时零拷贝）
+ *   --premultiply  打包时预乘 Alpha（对应加载选项 premultipliedAlpha）
+ */
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <png.h>
+#include "asset/SpineAtlasContainerFormat.h"
+#include "asset/SpineLz4.h"
+
+using namespace SpineAtlasContainerFormat;
+using std::string;
+using std::vector;
+
+namespace {
+
+struct AtlasPage {
+    string name;
+    int32_t width = 0;
+    int32_t height = 0;
+    bool pma = false;
+    vector<uint8_t> pixels;
+};
+
+struct AtlasRegion {
+    string name;
+    uint32_t pageIndex = 0;
+    int32_t x = 0;
+    int32_t y = 0;
+    int32_t width = 0;
+    int32_t height = 0;
+    float offsetX = 0.0f;
+    float offsetY = 0.0f;
+    int32_t originalWidth = -1;
+    int32_t originalHeight = -1;
+    int32_t degrees = 0;
+    int32_t index = -1;
+};
+
+string Trim(const string& s) {
+    size_t begin = s.find_first_not_of(" \t\r\n");
+    if (begin == string::npos) {
+        return "";
+    }
+    size_t end = s.find_last_not_of(" \t\r\n");
+    return s.substr(begin, end - begin + 1);
+}
+
+vector<string> SplitValues(const string& value) {
+    vector<string> values;
+    std::stringstream stream(value);
+    string item;
+    while (std::getline(stream, item, ',')) {
+        values.push_back(Trim(item));
+    }
+    return values;
+}
+
+bool ReadFile(const string& path, string* content) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        return false;
+    }
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    *content = buffer.str();
+    return true;
+}
+
+/**
+ * 解析 .atlas 文本（兼容 Spine 3.x 与 4.x 格式）
+ */
+bool ParseAtlas(const string& text, vector<AtlasPage>* pages, vector<AtlasRegion>* regions) {
+    std::stringstream stream(text);
+    string line;
+    AtlasPage* page = nullptr;
+    AtlasRegion* region = nullptr;
+
+    while (std::getline(stream, line)) {
+        string trimmed = Trim(line);
+        if (trimmed.empty()) {
+            // 空行结束当前页面
+            page = nullptr;
+            region = nullptr;
+            continue;
+        }
+
+        if (!page) {
+            pages->push_back(AtlasPage());
+            page = &pages->back();
+            page->name = trimmed;
+            continue;
+        }
+
+        size_t colon = trimmed.find(':');
+        if (colon == string::npos) {
+            regions->push_back(AtlasRegion());
+            region = &regions->back();
+            region->name = trimmed;
+            region->pageIndex = static_cast<uint32_t>(pages->size() - 1);
+            continue;
+        }
+
+        string key = Trim(trimmed.substr(0, colon));
+        vector<string> values = SplitValues(trimmed.substr(colon + 1));
+        if (values.empty()) {
+            continue;
+        }
+
+        if (!region) {
+            if (key == "size" && values.size() >= 2) {
+                page->width = std::atoi(values[0].c_str());
+                page->height = std::atoi(values[1].c_str());
+            } else if (key == "pma") {
+                page->pma = values[0] == "true";
+            }
+            continue;
+        }
+
+        if (key == "bounds" && values.size() >= 4) {
+            region->x = std::atoi(values[0].c_str());
+            region->y = std::atoi(values[1].c_str());
+            region->width = std::atoi(values[2].c_str());
+            region->height = std::atoi(values[3].c_str());
+        } else if (key == "offsets" && values.size() >= 4) {
+            region->offsetX = static_cast<float>(std::atof(values[0].c_str()));
+            region->offsetY = static_cast<float>(std::atof(values[1].c_str()));
+            region->originalWidth = std::atoi(values[2].c_str());
+            region->originalHeight = std::atoi(values[3].c_str());
+        } else if (key == "xy" && values.size() >= 2) {
+            region->x = std::atoi(values[0].c_str());
+            region->y = std::atoi(values[1].c_str());
+        } else if (key == "size" && values.size() >= 2) {
+            region->width = std::atoi(values[0].c_str());
+            region->height = std::atoi(values[1].c_str());
+        } else if (key == "orig" && values.size() >= 2) {
+            region->originalWidth = std::atoi(values[0].c_str());
+            region->originalHeight = std::atoi(values[1].c_str());
+        } else if (key == "offset" && values.size() >= 2) {
+            region->offsetX = static_cast<float>(std::atof(values[0].c_str()));
+            region->offsetY = static_cast<float>(std::atof(values[1].c_str()));
+        } else if (key == "rotate") {
+            if (values[0] == "true") {
+                region->degrees = 90;
+            } else if (values[0] != "false") {
+                region->degrees = std::atoi(values[0].c_str());
+            }
+        } else if (key == "index") {
+            region->index = std::atoi(values[0].c_str());
+        }
+    }
+
+    for (AtlasRegion& r : *regions) {
+        if (r.originalWidth < 0) {
+            r.originalWidth = r.width;
+            r.originalHeight = r.height;
+        }
+    }
+    return !pages->empty();
+}
+
+bool DecodePng(const string& path, AtlasPage* page) {
+    png_image image;
+    std::memset(&image, 0, sizeof(image));
+    image.version = PNG_IMAGE_VERSION;
+    if (!png_image_begin_read_from_file(&image, path.c_str())) {
+        std::fprintf(stderr, "failed to read %s: %s\n", path.c_str(), image.message);
+        return false;
+    }
+
+    image.format = PNG_FORMAT_RGBA;
+    page->pixels.resize(PNG_IMAGE_SIZE(image));
+    if (!png_image_finish_read(&image, nullptr, page->pixels.data(), 0, nullptr)) {
+        std::fprintf(stderr, "failed to decode %s: %s\n", path.c_str(), image.message);
+        png_image_free(&image);
+        return false;
+    }
+
+    if (page->width != 0 && (page->width != static_cast<int32_t>(image.width) ||
+                             page->height != static_cast<int32_t>(image.height))) {
+        std::fprintf(stderr, "warning: %s is %ux%u but the atlas declares %dx%d\n", path.c_str(),
+                     image.width, image.height, page->width, page->height);
+    }
+    page->width = static_cast<int32_t>(image.width);
+    page->height = static_cast<int32_t>(image.height);
+    return true;
+}
+
+void Premultiply(vector<uint8_t>* pixels) {
+    for (size_t i = 0; i + 3 < pixels->size(); i += 4) {
+        uint32_t a = (*pixels)[i + 3];
+        for (size_t c = 0; c < 3; ++c) {
+            (*pixels)[i + c] = static_cast<uint8_t>(((*pixels)[i + c] * a + 127) / 255);
+        }
+    }
+}
+
+uint64_t AlignUp(uint64_t value, uint64_t alignment) {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+uint32_t AddString(const string& s, string* table) {
+    uint32_t offset = static_cast<uint32_t>(table->size());
+    table->append(s);
+    table->push_back('\0');
+    return offset;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    if (argc < 3) {
+        std::fprintf(stderr, "usage: %s <input.atlas> <output.satlas> [--lz4] [--premultiply]\n", argv[0]);
+        return 1;
+    }
+
+    const string atlasPath = argv[1];
+    const string outputPath = argv[2];
+    bool useLz4 = false;
+    bool premultiply = false;
+    for (int i = 3; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--lz4") == 0) {
+            useLz4 = true;
+        } else if (std::strcmp(argv[i], "--premultiply") == 0) {
+            premultiply = true;
+        } else {
+            std::fprintf(stderr, "unknown option %s\n", argv[i]);
+            return 1;
+        }
+    }
+
+    string atlasText;
+    if (!ReadFile(atlasPath, &atlasText)) {
+        std::fprintf(stderr, "failed to read %s\n", atlasPath.c_str());
+        return 1;
+    }
+
+    vector<AtlasPage> pages;
+    vector<AtlasRegion> regions;
+    if (!ParseAtlas(atlasText, &pages, &regions)) {
+        std::fprintf(stderr, "no pages found in %s\n", atlasPath.c_str());
+        return 1;
+    }
+
+    // 解码页面，按需预乘；所有页面必须统一为预乘或非预乘
+    const size_t slash = atlasPath.find_last_of('/');
+    const string baseDir = slash == string::npos ? "" : atlasPath.substr(0, slash + 1);
+    bool premultiplied = true;
+    bool straight = true;
+    for (AtlasPage& page : pages) {
+        if (!DecodePng(baseDir + page.name, &page)) {
+            return 1;
+        }
+        if (premultiply && !page.pma) {
+            Premultiply(&page.pixels);
+            page.pma = true;
+        }
+        premultiplied = premultiplied && page.pma;
+        straight = straight && !page.pma;
+    }
+    if (!premultiplied && !straight) {
+        std::fprintf(stderr, "pages mix premultiplied and straight alpha, use --premultiply\n");
+        return 1;
+    }
+
+    // 布局：Header | 页面表 | 区域表 | 字符串表 | .atlas 文本 | 对齐的页面数据
+    string strings;
+    vector<Page> pageTable(pages.size());
+    vector<Region> regionTable(regions.size());
+    for (size_t i = 0; i < pages.size(); ++i) {
+        pageTable[i].nameOffset = AddString(pages[i].name, &strings);
+    }
+    for (size_t i = 0; i < regions.size(); ++i) {
+        const AtlasRegion& r = regions[i];
+        regionTable[i] = Region{AddString(r.name, &strings), r.pageIndex, r.x, r.y, r.width, r.height,
+                                r.offsetX, r.offsetY, r.originalWidth, r.originalHeight, r.degrees, r.index};
+    }
+
+    Header header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.version = kVersion;
+    header.flags = premultiplied ? static_cast<uint32_t>(kFlagPremultipliedAlpha) : 0u;
+    header.alignment = kPageAlignment;
+    header.pageCount = static_cast<uint32_t>(pages.size());
+    header.regionCount = static_cast<uint32_t>(regions.size());
+    header.pageTableOffset = sizeof(Header);
+    header.regionTableOffset = AlignUp(header.pageTableOffset + pageTable.size() * sizeof(Page), 8);
+    header.stringTableOffset = header.regionTableOffset + regionTable.size() * sizeof(Region);
+    header.stringTableSize = strings.size();
+    header.atlasTextOffset = header.stringTableOffset + header.stringTableSize;
+    header.atlasTextSize = atlasText.size();
+
+    vector<vector<uint8_t>> pageData(pages.size());
+    uint64_t offset = header.atlasTextOffset + header.atlasTextSize;
+    for (size_t i = 0; i < pages.size(); ++i) {
+        Page& entry = pageTable[i];
+        entry.width = static_cast<uint32_t>(pages[i].width);
+        entry.height = static_cast<uint32_t>(pages[i].height);
+        entry.rawSize = pages[i].pixels.size();
+        entry.compression = kCompressionNone;
+        pageData[i].swap(pages[i].pixels);
+
+        if (useLz4) {
+            vector<uint8_t> compressed;
+            SpineLz4::Compress(pageData[i].data(), pageData[i].size(), &compressed);
+            if (compressed.size() < pageData[i].size()) {
+                entry.compression = kCompressionLz4;
+                pageData[i].swap(compressed);
+            }
+        }
+
+        entry.dataSize = pageData[i].size();
+        entry.dataOffset = AlignUp(offset, kPageAlignment);
+        offset = entry.dataOffset + entry.dataSize;
+    }
+
+    std::ofstream out(outputPath, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        std::fprintf(stderr, "failed to open %s\n", outputPath.c_str());
+        return 1;
+    }
+
+    auto padTo = [&out](uint64_t position) {
+        static const char zeros[kPageAlignment] = {};
+        uint64_t current = static_cast<uint64_t>(out.tellp());
+        if (position > current) {
+            out.write(zeros, static_cast<std::streamsize>(position - current));
+        }
+    };
+
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char*>(pageTable.data()), pageTable.size() * sizeof(Page));
+    padTo(header.regionTableOffset);
+    out.write(reinterpret_cast<const char*>(regionTable.data()), regionTable.size() * sizeof(Region));
+    out.write(strings.data(), strings.size());
+    out.write(atlasText.data(), atlasText.size());
+    for (size_t i = 0; i < pages.size(); ++i) {
+        padTo(pageTable[i].dataOffset);
+        out.write(reinterpret_cast<const char*>(pageData[i].data()), pageData[i].size());
+    }
+
+    if (!out) {
+        std::fprintf(stderr, "failed to write %s\n", outputPath.c_str());
+        return 1;
+    }
+
+    std::printf("%s: %zu pages, %zu regions, %s, %s, %llu bytes\n", outputPath.c_str(), pages.size(),
+                regions.size(), useLz4 ? "lz4" : "raw", premultiplied ? "premultiplied" : "straight alpha",
+                static_cast<unsigned long long>(offset));
+    return 0;
+}
@@ -0,0 +1,391 @@
+//
+// Created on 2026/10/19.
+//
+
+/**
+ * spine_bench - 资源处理内核的基准（在开发机上运行，输出可对比的数字）
+ *
+ * 用法：
+ *   spine_bench quantize [--bones <n>] [--frames <n>] [--samples <n>]
+ *   spine_bench regions [--regions <n>] [--lookups <n>]
+ *   spine_bench premultiply [--size <n>] [--iterations <n>]
+ *
+ *   quantize   关键帧 16 位量化：按默认误差量化一份合成的动画数据（旋转、平移、缩放、颜色、
+ *              贝塞尔采样点和网格变形），输出节省的内存，以及浮点与量化两种存储下
+ *              单次采样（查找关键帧并插值）的耗时变化。
+ *              真实骨骼数据的内存对比见 spine_command_replay --quantize
+ *     --bones    骨骼数（默认 60，每根骨骼旋转、平移、缩放各一条时间轴，每 4 根一个插槽颜色和网格变形）
+ *     --frames   每条时间轴的关键帧数（默认 300）
+ *     --samples  采样次数（默认 2000000）
+ *
+ *   regions    大图集的区域名称索引：解析合成的多页图集文本并建立索引，对比加载时按名称查找区域
+ *              （哈希索引与 spine::Atlas::findRegion 的线性查找）的总耗时
+ *     --regions  区域数（默认 2500）
+ *     --lookups  每个区域的查找次数（默认 4，对应多个皮肤引用同一区域）
+ *
+ *   premultiply  纹理页预乘 alpha：在每个可用的指令集级别上处理一张纹理页，与标量结果逐字节对比后输出吞吐（GB/s）
+ *     --size        纹理页边长（默认 2048）
+ *     --iterations  每个级别的重复次数（默认 20）
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+#include "asset/SpineQuantizedTimeline.h"
+#include "asset/SpineRegionIndex.h"
+#include "common/common.h"
+#include "render/SpinePixelKernels.h"
+#include "render/SpineVertexKernels.h"
+
+using std::string;
+using std::vector;
+
+namespace {
+
+uint64_t NowNs() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+/**
+ * 解析 --name <n> 形式的整数选项，未出现时保留默认值
+ */
+bool ParseOptions(int argc, char** argv, int first, const vector<std::pair<const char*, int64_t*>>& options) {
+    for (int i = first; i < argc; ++i) {
+        bool matched = false;
+        for (const auto& option : options) {
+            if (std::strcmp(argv[i], option.first) == 0 && i + 1 < argc) {
+                *option.second = std::strtoll(argv[++i], nullptr, 10);
+                matched = *option.second > 0;
+                break;
+            }
+        }
+        if (!matched) {
+            std::fprintf(stderr, "invalid option: %s\n", argv[i]);
+            return false;
+        }
+    }
+    return true;
+}
+
+// ==================== quantize ====================
+
+/**
+ * 一条时间轴的关键帧（每行为时间加各通道值）及各列的允许误差
+ */
+struct TimelineData {
+    vector<float> values;
+    size_t stride = 0;
+    vector<float> tolerances;
+};
+
+/**
+ * 生成平滑变化的关键帧：时间按 frameRate 递增，各通道为随机游走
+ */
+TimelineData MakeTimeline(std::mt19937& rng, size_t frames, float frameRate, size_t channels, float range,
+                          float timeTolerance, float valueTolerance) {
+    std::normal_distribution<float> step(0.0f, range * 0.6f / frameRate);
+    std::uniform_real_distribution<float> start(-range * 0.5f, range * 0.5f);
+    TimelineData timeline;
+    timeline.stride = channels + 1;
+    timeline.values.reserve(frames * timeline.stride);
+    vector<float> current(channels);
+    for (float& value : current) {
+        value = start(rng);
+    }
+    for (size_t frame = 0; frame < frames; ++frame) {
+        timeline.values.push_back(static_cast<float>(frame) / frameRate);
+        for (float& value : current) {
+            value += step(rng);
+            timeline.values.push_back(value);
+        }
+    }
+    timeline.tolerances.assign(timeline.stride, valueTolerance);
+    timeline.tolerances[0] = timeTolerance;
+    return timeline;
+}
+
+/**
+ * 浮点存储的采样：二分查找时间列，读出两侧的行后插值（与量化采样读取相同的数据量）
+ */
+float SampleFloat(const TimelineData& timeline, float time, float* rowA, float* rowB) {
+    const size_t stride = timeline.stride;
+    const size_t rows = timeline.values.size() / stride;
+    const float* values = timeline.values.data();
+    size_t low = 0;
+    size_t high = rows;
+    while (low < high) {
+        size_t middle = (low + high) / 2;
+        if (values[middle * stride] <= time) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    const size_t row = low > 0 ? low - 1 : 0;
+    std::memcpy(rowA, values + row * stride, stride * sizeof(float));
+    if (row + 1 >= rows) {
+        return rowA[1];
+    }
+    std::memcpy(rowB, values + (row + 1) * stride, stride * sizeof(float));
+    const float alpha = (time - rowA[0]) / (rowB[0] - rowA[0]);
+    return rowA[1] + (rowB[1] - rowA[1]) * alpha;
+}
+
+/**
+ * 量化存储的采样：查找行，解码两侧的行后插值
+ */
+float SampleQuantized(const SpineQuantizedFrames& frames, float time, float* rowA, float* rowB) {
+    const size_t row = frames.SearchRow(time);
+    frames.DecodeRow(row, rowA);
+    if (row + 1 >= frames.GetRowCount()) {
+        return rowA[1];
+    }
+    frames.DecodeRow(row + 1, rowB);
+    const float alpha = (time - rowA[0]) / (rowB[0] - rowA[0]);
+    return rowA[1] + (rowB[1] - rowA[1]) * alpha;
+}
+
+int RunQuantize(int argc, char** argv) {
+    int64_t boneCount = 60;
+    int64_t frameCount = 300;
+    int64_t sampleCount = 2000000;
+    if (!ParseOptions(argc, argv, 2, {{"--bones", &boneCount}, {"--frames", &frameCount}, {"--samples", &sampleCount}})) {
+        return 2;
+    }
+
+    // 按默认误差生成与 Spine 时间轴布局一致的数组
+    const SpineQuantizeTolerance tolerance;
+    const size_t frames = static_cast<size_t>(frameCount);
+    std::mt19937 rng(20261019);
+    vector<TimelineData> timelines;
+    for (int64_t bone = 0; bone < boneCount; ++bone) {
+        timelines.push_back(MakeTimeline(rng, frames, 30.0f, 1, 360.0f, tolerance.time, tolerance.rotate));
+        timelines.push_back(MakeTimeline(rng, frames, 30.0f, 2, 200.0f, tolerance.time, tolerance.translate));
+        timelines.push_back(MakeTimeline(rng, frames, 30.0f, 2, 2.0f, tolerance.time, tolerance.scale));
+        // 每帧一段贝塞尔曲线，18 个采样点（时间、值）
+        timelines.push_back(MakeTimeline(rng, frames * 18, 30.0f * 18, 1, 360.0f, tolerance.time, tolerance.rotate));
+        if (bone % 4 == 0) {
+            timelines.push_back(MakeTimeline(rng, frames, 30.0f, 4, 1.0f, tolerance.time, tolerance.color));
+            timelines.push_back(MakeTimeline(rng, frames, 30.0f, 64, 20.0f, tolerance.time, tolerance.deform));
+        }
+    }
+
+    vector<SpineQuantizedFrames> quantized(timelines.size());
+    vector<bool> accepted(timelines.size());
+    size_t floatBytes = 0;
+    size_t quantizedBytes = 0;
+    size_t rejected = 0;
+    double maxErrorRatio = 0.0;
+    const uint64_t encodeStart = NowNs();
+    for (size_t i = 0; i < timelines.size(); ++i) {
+        const TimelineData& timeline = timelines[i];
+        accepted[i] = quantized[i].Encode(timeline.values.data(), timeline.values.size(), timeline.stride,
+                                          timeline.tolerances.data());
+        floatBytes += timeline.values.size() * sizeof(float);
+        if (!accepted[i]) {
+            rejected++;
+            quantizedBytes += timeline.values.size() * sizeof(float);
+            continue;
+        }
+        quantizedBytes += quantized[i].GetMemoryBytes();
+    }
+    const double encodeMs = static_cast<double>(NowNs() - encodeStart) / 1e6;
+
+    // 误差校验：每个值都在该列允许误差内
+    for (size_t i = 0; i < timelines.size(); ++i) {
+        if (!accepted[i]) {
+            continue;
+        }
+        const TimelineData& timeline = timelines[i];
+        for (size_t index = 0; index < timeline.values.size(); ++index) {
+            const size_t column = index % timeline.stride;
+            const double error = std::fabs(quantized[i].Get(index / timeline.stride, column) - timeline.values[index]);
+            maxErrorRatio = std::max(maxErrorRatio, error / timeline.tolerances[column]);
+        }
+    }
+
+    std::printf("timelines %zu (rejected %zu), frames %zu\n", timelines.size(), rejected, frames);
+    std::printf("float      %10.1f KB\n", floatBytes / 1024.0);
+    std::printf("quantized  %10.1f KB  (saved %.1f%%, encode %.2f ms, max error %.2f of tolerance)\n",
+                quantizedBytes / 1024.0, 100.0 * (1.0 - static_cast<double>(quantizedBytes) / floatBytes), encodeMs,
+                maxErrorRatio);
+
+    // 采样：随机时间轴、随机时间，两种存储使用相同的序列
+    vector<std::pair<uint32_t, float>> queries(4096);
+    std::uniform_int_distribution<uint32_t> pickTimeline(0, static_cast<uint32_t>(timelines.size() - 1));
+    std::uniform_real_distribution<float> pickTime(0.0f, static_cast<float>(frames) / 30.0f);
+    for (auto& query : queries) {
+        query = {pickTimeline(rng), pickTime(rng)};
+    }
+    size_t maxStride = 0;
+    for (const TimelineData& timeline : timelines) {
+        maxStride = std::max(maxStride, timeline.stride);
+    }
+    vector<float> rowA(maxStride);
+    vector<float> rowB(maxStride);
+
+    volatile float sink = 0.0f;
+    const size_t samples = static_cast<size_t>(sampleCount);
+    uint64_t start = NowNs();
+    for (size_t i = 0; i < samples; ++i) {
+        const auto& query = queries[i & (queries.size() - 1)];
+        sink = sink + SampleFloat(timelines[query.first], query.second, rowA.data(), rowB.data());
+    }
+    const double floatNs = static_cast<double>(NowNs() - start) / samples;
+    start = NowNs();
+    for (size_t i = 0; i < samples; ++i) {
+        const auto& query = queries[i & (queries.size() - 1)];
+        const uint32_t index = query.first;
+        sink = sink + (accepted[index] ? SampleQuantized(quantized[index], query.second, rowA.data(), rowB.data())
+                                       : SampleFloat(timelines[index], query.second, rowA.data(), rowB.data()));
+    }
+    const double quantizedNs = static_cast<double>(NowNs() - start) / samples;
+
+    std::printf("sample     float %.1f ns, quantized %.1f ns (%+.1f%%)\n", floatNs, quantizedNs,
+                100.0 * (quantizedNs - floatNs) / floatNs);
+    return maxErrorRatio <= 1.0 ? 0 : 1;
+}
+
+// ==================== regions ====================
+
+int RunRegions(int argc, char** argv) {
+    int64_t regionCount = 2500;
+    int64_t lookupCount = 4;
+    if (!ParseOptions(argc, argv, 2, {{"--regions", &regionCount}, {"--lookups", &lookupCount}})) {
+        return 2;
+    }
+
+    // 合成图集文本：每 1000 个区域一页，区域名称打乱顺序
+    string atlas;
+    vector<string> names;
+    for (int64_t i = 0; i < regionCount; ++i) {
+        if (i % 1000 == 0) {
+            atlas += "\npage" + std::to_string(i / 1000) + ".png\nsize: 2048,2048\nfilter: Linear,Linear\npma: true\n";
+        }
+        names.push_back("parts/region_" + std::to_string(i * 7919 % 1000003));
+        atlas += names.back() + "\n  bounds: 0, 0, 32, 32\n  rotate: 90\n";
+    }
+
+    uint64_t start = NowNs();
+    vector<string> parsed;
+    SpineRegionIndex::ParseAtlasRegionNames(atlas.data(), atlas.size(), &parsed);
+    const double parseUs = static_cast<double>(NowNs() - start) / 1e3;
+    if (parsed != names) {
+        std::fprintf(stderr, "parsed %zu region names, expected %zu\n", parsed.size(), names.size());
+        return 1;
+    }
+
+    vector<const char*> pointers;
+    for (const string& name : parsed) {
+        pointers.push_back(name.c_str());
+    }
+    start = NowNs();
+    std::shared_ptr<const SpineRegionIndex> index = SpineRegionIndex::Build(pointers);
+    const double buildUs = static_cast<double>(NowNs() - start) / 1e3;
+
+    int64_t checksum = 0;
+    start = NowNs();
+    for (int64_t round = 0; round < lookupCount; ++round) {
+        for (const string& name : names) {
+            checksum += index->Find(name);
+        }
+    }
+    const double hashedUs = static_cast<double>(NowNs() - start) / 1e3;
+    start = NowNs();
+    for (int64_t round = 0; round < lookupCount; ++round) {
+        for (const string& name : names) {
+            for (size_t i = 0; i < parsed.size(); ++i) {
+                if (parsed[i] == name) {
+                    checksum -= static_cast<int64_t>(i);
+                    break;
+                }
+            }
+        }
+    }
+    const double linearUs = static_cast<double>(NowNs() - start) / 1e3;
+    if (checksum != 0 || index->Find(string("parts/missing")) != -1) {
+        std::fprintf(stderr, "hashed and linear lookups disagree\n");
+        return 1;
+    }
+
+    std::printf("regions %zu, lookups %lld per region\n", names.size(), static_cast<long long>(lookupCount));
+    std::printf("parse names %10.1f us\n", parseUs);
+    std::printf("build index %10.1f us  (%.1f KB)\n", buildUs, index->GetMemoryBytes() / 1024.0);
+    std::printf("lookups     hashed %.1f us, linear %.1f us (%.1fx)\n", hashedUs, linearUs, linearUs / hashedUs);
+    return 0;
+}
+
+// ==================== premultiply ====================
+
+int RunPremultiply(int argc, char** argv) {
+    int64_t size = 2048;
+    int64_t iterations = 20;
+    if (!ParseOptions(argc, argv, 2, {{"--size", &size}, {"--iterations", &iterations}})) {
+        return 2;
+    }
+
+    const size_t pixelCount = static_cast<size_t>(size * size);
+    vector<uint8_t> page(pixelCount * 4);
+    for (size_t i = 0; i < page.size(); ++i) {
+        page[i] = static_cast<uint8_t>((i * 2654435761u) >> 24);
+    }
+    vector<uint8_t> expected(page.size());
+    SpinePixelKernels::PremultiplyRgbaScalar(page.data(), expected.data(), pixelCount);
+    vector<uint8_t> output(page.size());
+
+    using SpineVertexKernels::SimdLevel;
+    const SimdLevel detected = SpineVertexKernels::GetSimdLevel();
+    std::printf("page %lldx%lld, %lld iterations\n", static_cast<long long>(size), static_cast<long long>(size),
+                static_cast<long long>(iterations));
+    int result = 0;
+    for (SimdLevel level : {SimdLevel::kScalar, SimdLevel::kSse2, SimdLevel::kAvx2, SimdLevel::kNeon}) {
+        // 不支持的级别会回退到检测结果，跳过以免重复
+        if (SpineVertexKernels::SetSimdLevel(level) != level) {
+            continue;
+        }
+        std::fill(output.begin(), output.end(), 0);
+        SpinePixelKernels::PremultiplyRgba(page.data(), output.data(), pixelCount);
+        const bool match = output == expected;
+        const uint64_t start = NowNs();
+        for (int64_t i = 0; i < iterations; ++i) {
+            SpinePixelKernels::PremultiplyRgba(page.data(), output.data(), pixelCount);
+        }
+        const double seconds = static_cast<double>(NowNs() - start) / 1e9;
+        std::printf("%-8s %6.2f GB/s  (%.2f ms per page)%s\n", SpineVertexKernels::GetSimdLevelName(level),
+                    page.size() * iterations / seconds / 1e9, seconds * 1e3 / iterations,
+                    match ? "" : "  MISMATCH");
+        if (!match) {
+            result = 1;
+        }
+    }
+    SpineVertexKernels::SetSimdLevel(detected);
+    return result;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const string mode = argc > 1 ? argv[1] : "";
+    if (mode == "quantize") {
+        return RunQuantize(argc, argv);
+    }
+    if (mode == "regions") {
+        return RunRegions(argc, argv);
+    }
+    if (mode == "premultiply") {
+        return RunPremultiply(argc, argv);
+    }
+    std::fprintf(stderr,
+                 "usage: %s quantize [--bones <n>] [--frames <n>] [--samples <n>]\n"
+                 "       %s regions [--regions <n>] [--lookups <n>]\n"
+                 "       %s premultiply [--size <n>] [--iterations <n>]\n",
+                 argv[0], argv[0], argv[0]);
+    return 2;
+}
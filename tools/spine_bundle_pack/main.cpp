@@ -0,0 +1,133 @@
+//
+// Created on 2026/10/19.
+//
+
+/**
+ * spine_bundle_pack - 离线生成资源包（.sbundle）
+ * 把一个角色的骨骼数据（.skel 或 .json）和图集容器（.satlas，由 spine_atlas_pack 生成）
+ * 合并为单个可 mmap 的文件，运行时由 loadSpineBundle 加载。
+ *
+ * 用法：
+ *   spine_bundle_pack <skeleton.skel|skeleton.json> <atlas.satlas> <output.sbundle>
+ */
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "asset/SpineAtlasContainerFormat.h"
+#include "asset/SpineBundleFormat.h"
+
+using namespace SpineBundleFormat;
+using std::string;
+using std::vector;
+
+namespace {
+
+bool ReadFile(const string& path, string* content) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        return false;
+    }
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    *content = buffer.str();
+    return true;
+}
+
+bool EndsWith(const string& s, const char* suffix) {
+    const size_t length = std::strlen(suffix);
+    return s.size() >= length && s.compare(s.size() - length, length, suffix) == 0;
+}
+
+uint64_t AlignUp(uint64_t value, uint64_t alignment) {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    if (argc != 4) {
+        std::fprintf(stderr, "usage: %s <skeleton.skel|skeleton.json> <atlas.satlas> <output.sbundle>\n", argv[0]);
+        return 1;
+    }
+
+    const string skeletonPath = argv[1];
+    const string atlasPath = argv[2];
+    const string outputPath = argv[3];
+
+    string skeleton;
+    if (!ReadFile(skeletonPath, &skeleton)) {
+        std::fprintf(stderr, "failed to read %s\n", skeletonPath.c_str());
+        return 1;
+    }
+    const bool isJson = EndsWith(skeletonPath, ".json");
+
+    string atlas;
+    if (!ReadFile(atlasPath, &atlas)) {
+        std::fprintf(stderr, "failed to read %s\n", atlasPath.c_str());
+        return 1;
+    }
+    if (atlas.size() < sizeof(SpineAtlasContainerFormat::Header) ||
+        std::memcmp(atlas.data(), SpineAtlasContainerFormat::kMagic, sizeof(SpineAtlasContainerFormat::kMagic)) != 0) {
+        std::fprintf(stderr, "%s is not an atlas container, run spine_atlas_pack first\n", atlasPath.c_str());
+        return 1;
+    }
+
+    vector<Section> sections(2);
+    sections[0].type = isJson ? kSectionSkeletonJson : kSectionSkeletonBinary;
+    sections[0].reserved = 0;
+    sections[0].size = skeleton.size();
+    sections[1].type = kSectionAtlasContainer;
+    sections[1].reserved = 0;
+    sections[1].size = atlas.size();
+
+    Header header;
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.version = kVersion;
+    header.flags = 0;
+    header.sectionCount = static_cast<uint32_t>(sections.size());
+    header.sectionTableOffset = sizeof(Header);
+
+    // JSON 段后紧跟 '\0'
+    uint64_t offset = header.sectionTableOffset + sections.size() * sizeof(Section);
+    sections[0].offset = AlignUp(offset, kSectionAlignment);
+    offset = sections[0].offset + sections[0].size + (isJson ? 1 : 0);
+    sections[1].offset = AlignUp(offset, kSectionAlignment);
+    offset = sections[1].offset + sections[1].size;
+
+    std::ofstream out(outputPath, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        std::fprintf(stderr, "failed to open %s\n", outputPath.c_str());
+        return 1;
+    }
+
+    auto padTo = [&out](uint64_t position) {
+        static const char zeros[kSectionAlignment] = {};
+        uint64_t current = static_cast<uint64_t>(out.tellp());
+        if (position > current) {
+            out.write(zeros, static_cast<std::streamsize>(position - current));
+        }
+    };
+
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char*>(sections.data()), sections.size() * sizeof(Section));
+    padTo(sections[0].offset);
+    out.write(skeleton.data(), skeleton.size());
+    if (isJson) {
+        out.put('\0');
+    }
+    padTo(sections[1].offset);
+    out.write(atlas.data(), atlas.size());
+
+    if (!out) {
+        std::fprintf(stderr, "failed to write %s\n", outputPath.c_str());
+        return 1;
+    }
+
+    std::printf("%s: %s skeleton %zu bytes, atlas container %zu bytes, %llu bytes\n", outputPath.c_str(),
+                isJson ? "json" : "binary", skeleton.size(), atlas.size(), static_cast<unsigned long long>(offset));
+    return 0;
+}
@@ -0,0 +1,236 @@
+//
+// Created on 2026/10/19.
+//
+
+/**
+ * spine_bundle_test - 资源包文件头和段表校验测试（ctest）
+ * 写出一个最小的 JSON 骨骼和图集容器，用 spine_bundle_pack 打包为资源包，确认 SpineBundle::Open 能打开；
+ * 再逐处改动打包结果：段未对齐或越界、JSON 段缺少结尾的 '\0'、缺少图集或骨骼段、段表越界等，
+ * 要求 Open 返回 nullptr。
+ *
+ * 用法：
+ *   spine_bundle_test <spine_bundle_pack> <work-dir>
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <sstream>
+#include <string>
+#include <sys/stat.h>
+#include <vector>
+#include "asset/SpineAtlasContainer.h"
+#include "asset/SpineBundle.h"
+#include "asset/SpineBundleFormat.h"
+
+using std::string;
+using namespace SpineBundleFormat;
+
+namespace {
+
+const char kSkeletonJson[] = R"({"skeleton":{"spine":"4.2.00"},"bones":[{"name":"root"}],"animations":{}})";
+
+struct Context {
+    int failures = 0;
+    int checks = 0;
+};
+
+void Expect(Context* context, bool condition, const string& what) {
+    context->checks++;
+    if (!condition) {
+        context->failures++;
+        std::fprintf(stderr, "FAIL %s\n", what.c_str());
+    }
+}
+
+bool WriteFile(const string& path, const string& content) {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write(content.data(), static_cast<std::streamsize>(content.size()));
+    return static_cast<bool>(file);
+}
+
+bool ReadFile(const string& path, string* content) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        return false;
+    }
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    *content = buffer.str();
+    return true;
+}
+
+/**
+ * 最小的图集容器：一个 2x2 未压缩页面、一个区域
+ */
+string BuildAtlasContainer() {
+    namespace Format = SpineAtlasContainerFormat;
+    const string strings = string("page.png") + '\0' + "head" + '\0';
+    const string atlasText = "page.png\nsize: 2,2\nhead\n  bounds: 0, 0, 2, 2\n";
+
+    Format::Header header = {};
+    std::memcpy(header.magic, Format::kMagic, sizeof(Format::kMagic));
+    header.version = Format::kVersion;
+    header.alignment = Format::kPageAlignment;
+    header.pageCount = 1;
+    header.regionCount = 1;
+    header.pageTableOffset = sizeof(header);
+    header.regionTableOffset = header.pageTableOffset + sizeof(Format::Page);
+    header.stringTableOffset = header.regionTableOffset + sizeof(Format::Region);
+    header.stringTableSize = strings.size();
+    header.atlasTextOffset = header.stringTableOffset + strings.size();
+    header.atlasTextSize = atlasText.size();
+
+    Format::Page page = {0, 2, 2, Format::kCompressionNone, Format::kPageAlignment, 16, 16};
+    Format::Region region = {};
+    region.nameOffset = 9;
+    region.width = 2;
+    region.height = 2;
+    region.index = -1;
+
+    string container(Format::kPageAlignment + 16, '\0');
+    std::memcpy(&container[0], &header, sizeof(header));
+    std::memcpy(&container[header.pageTableOffset], &page, sizeof(page));
+    std::memcpy(&container[header.regionTableOffset], &region, sizeof(region));
+    std::memcpy(&container[header.stringTableOffset], strings.data(), strings.size());
+    std::memcpy(&container[header.atlasTextOffset], atlasText.data(), atlasText.size());
+    for (size_t i = 0; i < 16; ++i) {
+        container[Format::kPageAlignment + i] = static_cast<char>(i * 16);
+    }
+    return container;
+}
+
+/**
+ * 打包的资源包，改动通过文件头和段表指针进行
+ */
+struct BundleBytes {
+    string data;
+
+    Header* GetHeader() { return reinterpret_cast<Header*>(&data[0]); }
+    Section* GetSections() { return reinterpret_cast<Section*>(&data[GetHeader()->sectionTableOffset]); }
+    Section* FindSection(uint32_t type) {
+        for (uint32_t i = 0; i < 2; ++i) {
+            if (GetSections()[i].type == type) {
+                return &GetSections()[i];
+            }
+        }
+        return nullptr;
+    }
+};
+
+std::shared_ptr<SpineBundle> OpenBytes(const string& workDir, const string& name, const string& data) {
+    const string path = workDir + "/" + name + kFileExtension;
+    if (!WriteFile(path, data)) {
+        std::fprintf(stderr, "failed to write %s\n", path.c_str());
+        std::exit(2);
+    }
+    return SpineBundle::Open(path);
+}
+
+void TestValidBundles(Context* context, const string& workDir, const BundleBytes& json, const BundleBytes& binary) {
+    std::shared_ptr<SpineBundle> bundle = OpenBytes(workDir, "valid_json", json.data);
+    Expect(context, bundle != nullptr, "packed JSON bundle opens");
+    if (bundle) {
+        size_t size = 0;
+        const uint8_t* skeleton = bundle->GetSkeletonData(&size);
+        Expect(context, bundle->IsSkeletonJson() && size == std::strlen(kSkeletonJson) &&
+                        std::memcmp(skeleton, kSkeletonJson, size) == 0 && skeleton[size] == '\0',
+               "JSON section is the skeleton text followed by NUL");
+        const std::shared_ptr<SpineAtlasContainer>& atlas = bundle->GetAtlasContainer();
+        Expect(context, atlas && atlas->GetPageCount() == 1 && atlas->FindPage("page.png") == 0,
+               "atlas container section opens");
+        const uint8_t* pixels = atlas ? atlas->GetPagePixels(0) : nullptr;
+        Expect(context, pixels && pixels[15] == 240 && reinterpret_cast<uintptr_t>(pixels) % kSectionAlignment == 0,
+               "page pixels stay page-aligned inside the bundle");
+    }
+
+    bundle = OpenBytes(workDir, "valid_binary", binary.data);
+    Expect(context, bundle && !bundle->IsSkeletonJson(), "packed binary bundle opens");
+
+    // 未知段跳过（段表后的零填充读作类型 0 的空段）
+    BundleBytes extra = json;
+    extra.GetHeader()->sectionCount = 3;
+    Expect(context, OpenBytes(workDir, "unknown_section", extra.data) != nullptr, "unknown section skipped");
+}
+
+void TestRejected(Context* context, const string& workDir, const BundleBytes& json) {
+    const std::pair<const char*, std::function<void(BundleBytes&)>> cases[] = {
+        {"bad magic", [](BundleBytes& b) { b.GetHeader()->magic[3] = 'X'; }},
+        {"bad version", [](BundleBytes& b) { b.GetHeader()->version = kVersion + 1; }},
+        {"section table misaligned", [](BundleBytes& b) { b.GetHeader()->sectionTableOffset = 4; }},
+        {"section table past end", [](BundleBytes& b) { b.GetHeader()->sectionTableOffset = b.data.size() + 8; }},
+        {"section count past end", [](BundleBytes& b) { b.GetHeader()->sectionCount = 0x40000000u; }},
+        {"skeleton section misaligned", [](BundleBytes& b) { b.FindSection(kSectionSkeletonJson)->offset += 8; }},
+        {"atlas section misaligned", [](BundleBytes& b) { b.FindSection(kSectionAtlasContainer)->offset -= 16; }},
+        {"skeleton section oversized", [](BundleBytes& b) { b.FindSection(kSectionSkeletonJson)->size = b.data.size(); }},
+        {"atlas section oversized", [](BundleBytes& b) { b.FindSection(kSectionAtlasContainer)->size += 1; }},
+        {"section offset past end",
+         [](BundleBytes& b) { b.FindSection(kSectionAtlasContainer)->offset = b.data.size() + kSectionAlignment; }},
+        {"section end wraps",
+         [](BundleBytes& b) { b.FindSection(kSectionAtlasContainer)->offset = ~static_cast<uint64_t>(kSectionAlignment - 1); }},
+        {"JSON section without trailing NUL",
+         [](BundleBytes& b) {
+             const Section* section = b.FindSection(kSectionSkeletonJson);
+             b.data[section->offset + section->size] = '}';
+         }},
+        {"JSON section NUL past end",
+         [](BundleBytes& b) {
+             Section* section = b.FindSection(kSectionSkeletonJson);
+             section->size = b.data.size() - section->offset;
+         }},
+        {"missing atlas section", [](BundleBytes& b) { b.FindSection(kSectionAtlasContainer)->type = 99; }},
+        {"missing skeleton section", [](BundleBytes& b) { b.FindSection(kSectionSkeletonJson)->type = 99; }},
+        {"corrupt atlas container",
+         [](BundleBytes& b) { b.data[b.FindSection(kSectionAtlasContainer)->offset] = 'X'; }},
+        {"shorter than header", [](BundleBytes& b) { b.data.resize(sizeof(Header) - 1); }},
+        {"truncated atlas section", [](BundleBytes& b) { b.data.resize(b.data.size() - 1); }},
+    };
+    for (const auto& testCase : cases) {
+        BundleBytes bundle = json;
+        testCase.second(bundle);
+        Expect(context, OpenBytes(workDir, "rejected", bundle.data) == nullptr,
+               string("bundle rejected: ") + testCase.first);
+    }
+    Expect(context, SpineBundle::Open(workDir + "/missing" + kFileExtension) == nullptr, "missing file rejected");
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    if (argc != 3) {
+        std::fprintf(stderr, "usage: %s <spine_bundle_pack> <work-dir>\n", argv[0]);
+        return 2;
+    }
+    const string packTool = argv[1];
+    const string workDir = argv[2];
+    mkdir(workDir.c_str(), 0755);
+
+    // 用打包工具生成 JSON 和二进制骨骼的资源包
+    if (!WriteFile(workDir + "/skeleton.json", kSkeletonJson) ||
+        !WriteFile(workDir + "/skeleton.skel", string("\x01\x02\x03\x04", 4)) ||
+        !WriteFile(workDir + "/atlas.satlas", BuildAtlasContainer())) {
+        std::fprintf(stderr, "failed to write fixtures to %s\n", workDir.c_str());
+        return 2;
+    }
+    BundleBytes json;
+    BundleBytes binary;
+    for (const char* skeleton : {"skeleton.json", "skeleton.skel"}) {
+        const string output = workDir + "/" + skeleton + kFileExtension;
+        const string command = "\"" + packTool + "\" \"" + workDir + "/" + skeleton + "\" \"" + workDir +
+                               "/atlas.satlas\" \"" + output + "\"";
+        if (std::system(command.c_str()) != 0 ||
+            !ReadFile(output, skeleton == string("skeleton.json") ? &json.data : &binary.data)) {
+            std::fprintf(stderr, "failed to run %s\n", command.c_str());
+            return 2;
+        }
+    }
+
+    Context context;
+    TestValidBundles(&context, workDir, json, binary);
+    TestRejected(&context, workDir, json);
+
+    std::printf("%d checks, %d failures\n", context.checks, context.failures);
+    return context.failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,240 @@
+//
+// Created on 2026/10/19.
+//
+
+/**
+ * spine_command_replay - 重放 NAPI 层录制的命令流（startCommandRecording 生成）
+ * 按录制顺序把命令直接执行到 SpineManager，不经过 NAPI 和渲染表面，
+ * 输出各命令的耗时统计以及 update/render 的分位数，可作为可重复的性能基准。
+ *
+ * 用法：
+ *   spine_command_replay <commands.spcl> [--asset-dir <dir>] [--iterations <n>] [--quantize]
+ *
+ *   --asset-dir   把日志中的资源路径替换为该目录下的同名文件（设备沙箱路径在开发机上不存在）
+ *   --iterations  重复执行整个日志的次数（默认 1），统计合并输出
+ *   --quantize    以量化关键帧加载骨骼数据（默认误差），输出节省的内存；
+ *                 与不加该选项的结果对比 update 分位数即为采样开销的变化
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "asset/SpineQuantizedTimeline.h"
+#include "common/SpineCommandLog.h"
+#include "manager/SpineManager.h"
+
+using std::string;
+using std::vector;
+
+namespace {
+
+struct OpStats {
+    uint64_t count = 0;
+    uint64_t totalNs = 0;
+    uint64_t maxNs = 0;
+    vector<uint64_t> samples;  // 只为 update/render 保留，用于分位数
+};
+
+uint64_t NowNs() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+string RemapPath(const string& path, const string& assetDir) {
+    if (assetDir.empty() || path.empty()) {
+        return path;
+    }
+    const size_t slash = path.find_last_of('/');
+    const string fileName = slash == string::npos ? path : path.substr(slash + 1);
+    return assetDir + "/" + fileName;
+}
+
+SpineManager* GetOrCreate(std::unordered_map<int32_t, std::unique_ptr<SpineManager>>& managers, int32_t instanceId) {
+    auto it = managers.find(instanceId);
+    if (it == managers.end()) {
+        // 录制开始前已存在的实例在首次引用时创建
+        auto manager = std::make_unique<SpineManager>("", std::make_unique<SpineRenderContext>(""));
+        manager->SetInstanceId(instanceId);
+        it = managers.emplace(instanceId, std::move(manager)).first;
+    }
+    return it->second.get();
+}
+
+void Execute(const SpineCommand& command, const string& assetDir, bool quantize,
+             std::unordered_map<int32_t, std::unique_ptr<SpineManager>>& managers) {
+    if (command.op == SpineCommandOp::kDestroy) {
+        managers.erase(command.instanceId);
+        return;
+    }
+
+    SpineManager* manager = GetOrCreate(managers, command.instanceId);
+    switch (command.op) {
+        case SpineCommandOp::kLoadSpineData: {
+            SpineLoadOptions options;
+            options.scale = command.value;
+            options.premultipliedAlpha = command.loop;
+            options.quantizeTimelines = quantize;
+            manager->LoadSpineData(RemapPath(command.name, assetDir), RemapPath(command.name2, assetDir), options);
+            break;
+        }
+        case SpineCommandOp::kLoadSpineBundle: {
+            SpineLoadOptions options;
+            options.scale = command.value;
+            options.premultipliedAlpha = command.loop;
+            options.quantizeTimelines = quantize;
+            manager->LoadSpineBundle(RemapPath(command.name, assetDir), options);
+            break;
+        }
+        case SpineCommandOp::kSetAnimation:
+            manager->SetAnimation(command.trackIndex, command.name, command.loop);
+            break;
+        case SpineCommandOp::kAddAnimation:
+            manager->AddAnimation(command.trackIndex, command.name, command.loop, command.value);
+            break;
+        case SpineCommandOp::kSetSkin:
+            manager->SetSkin(command.name);
+            break;
+        case SpineCommandOp::kSetMix:
+            manager->SetMix(command.name, command.name2, command.value);
+            break;
+        case SpineCommandOp::kSetTimeScale:
+            manager->SetTimeScale(command.value);
+            break;
+        case SpineCommandOp::kSetScale:
+            manager->SetScale(command.value);
+            break;
+        case SpineCommandOp::kPause:
+            manager->Pause();
+            break;
+        case SpineCommandOp::kResume:
+            manager->Resume();
+            break;
+        case SpineCommandOp::kClearTracks:
+            manager->ClearTracks();
+            break;
+        case SpineCommandOp::kClearTrack:
+            manager->ClearTrack(command.trackIndex);
+            break;
+        case SpineCommandOp::kUpdateViewSize:
+            manager->UpdateViewSize(command.trackIndex, command.height);
+            break;
+        case SpineCommandOp::kUpdate:
+            manager->Update(command.value);
+            break;
+        case SpineCommandOp::kRender:
+            manager->Render();
+            break;
+        default:
+            break;
+    }
+}
+
+double Percentile(vector<uint64_t>& samples, double fraction) {
+    if (samples.empty()) {
+        return 0.0;
+    }
+    size_t index = static_cast<size_t>(fraction * static_cast<double>(samples.size() - 1) + 0.5);
+    std::nth_element(samples.begin(), samples.begin() + static_cast<std::ptrdiff_t>(index), samples.end());
+    return static_cast<double>(samples[index]) / 1000.0;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        std::fprintf(stderr, "usage: %s <commands.spcl> [--asset-dir <dir>] [--iterations <n>] [--quantize]\n",
+                     argv[0]);
+        return 1;
+    }
+
+    const string logPath = argv[1];
+    string assetDir;
+    int iterations = 1;
+    bool quantize = false;
+    for (int i = 2; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--asset-dir") == 0 && i + 1 < argc) {
+            assetDir = argv[++i];
+        } else if (std::strcmp(argv[i], "--iterations") == 0 && i + 1 < argc) {
+            iterations = std::max(1, std::atoi(argv[++i]));
+        } else if (std::strcmp(argv[i], "--quantize") == 0) {
+            quantize = true;
+        } else {
+            std::fprintf(stderr, "unknown option %s\n", argv[i]);
+            return 1;
+        }
+    }
+
+    SpineCommandLogReader reader;
+    if (!reader.Open(logPath)) {
+        std::fprintf(stderr, "failed to open %s (not a command log?)\n", logPath.c_str());
+        return 1;
+    }
+
+    std::map<SpineCommandOp, OpStats> stats;
+    uint64_t recordedUs = 0;
+    const uint64_t replayStartNs = NowNs();
+    for (int iteration = 0; iteration < iterations; ++iteration) {
+        std::unordered_map<int32_t, std::unique_ptr<SpineManager>> managers;
+        reader.Rewind();
+        SpineCommand command;
+        while (reader.Next(&command)) {
+            const uint64_t startNs = NowNs();
+            Execute(command, assetDir, quantize, managers);
+            const uint64_t elapsedNs = NowNs() - startNs;
+
+            OpStats& opStats = stats[command.op];
+            opStats.count++;
+            opStats.totalNs += elapsedNs;
+            opStats.maxNs = std::max(opStats.maxNs, elapsedNs);
+            if (command.op == SpineCommandOp::kUpdate || command.op == SpineCommandOp::kRender) {
+                opStats.samples.push_back(elapsedNs);
+            }
+            recordedUs = command.timeUs;
+        }
+        if (reader.IsTruncated()) {
+            std::fprintf(stderr, "warning: %s is truncated, replayed the readable prefix\n", logPath.c_str());
+        }
+    }
+    const double replayMs = static_cast<double>(NowNs() - replayStartNs) / 1e6;
+
+    std::printf("log: %s, iterations: %d\n", logPath.c_str(), iterations);
+    std::printf("recorded session: %.1f ms, replay: %.1f ms\n\n", static_cast<double>(recordedUs) / 1000.0, replayMs);
+    std::printf("%-16s %10s %12s %10s %10s\n", "command", "count", "total(ms)", "avg(us)", "max(us)");
+    for (auto& entry : stats) {
+        const OpStats& opStats = entry.second;
+        std::printf("%-16s %10llu %12.3f %10.2f %10.2f\n", GetSpineCommandOpName(entry.first),
+                    static_cast<unsigned long long>(opStats.count), static_cast<double>(opStats.totalNs) / 1e6,
+                    static_cast<double>(opStats.totalNs) / 1000.0 / static_cast<double>(opStats.count),
+                    static_cast<double>(opStats.maxNs) / 1000.0);
+    }
+
+    for (SpineCommandOp op : {SpineCommandOp::kUpdate, SpineCommandOp::kRender}) {
+        auto it = stats.find(op);
+        if (it == stats.end()) {
+            continue;
+        }
+        vector<uint64_t>& samples = it->second.samples;
+        std::printf("\n%s p50 %.2f us, p95 %.2f us, p99 %.2f us\n", GetSpineCommandOpName(op),
+                    Percentile(samples, 0.50), Percentile(samples, 0.95), Percentile(samples, 0.99));
+    }
+
+    if (quantize) {
+        // 每次迭代重新加载，统计按迭代次数平均
+        const SpineQuantizeStats quantizeStats = SpineQuantizedFrames::GetStats();
+        const double floatKb = static_cast<double>(quantizeStats.floatBytes) / 1024.0 / iterations;
+        const double quantizedKb = static_cast<double>(quantizeStats.quantizedBytes) / 1024.0 / iterations;
+        std::printf("\nquantized keyframes: %llu arrays, %llu kept as float (tolerance exceeded)\n",
+                    static_cast<unsigned long long>(quantizeStats.arrays / iterations),
+                    static_cast<unsigned long long>(quantizeStats.rejected / iterations));
+        std::printf("keyframe memory: %.1f KB -> %.1f KB (saved %.1f%%)\n", floatKb, quantizedKb,
+                    floatKb > 0.0 ? (floatKb - quantizedKb) / floatKb * 100.0 : 0.0);
+    }
+    return 0;
+}
@@ -0,0 +1,176 @@
+//
+// Created on 2026/10/19.
+//
+
+/**
+ * spine_event_buffer_test - 事件过滤与合并投递测试（ctest）
+ * 经 SpineManager::TriggerEvent 驱动事件：开启合并投递时事件只写入缓冲，缓冲写满后只计入丢弃数，
+ * 不回退到逐个回调；关闭时逐个回调。同时检查名称驻留、重新开启后字符串表重发、过滤统计，
+ * 以及实例重置后不再持有事件缓冲。
+ *
+ * 用法：
+ *   spine_event_buffer_test
+ */
+
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+#include "common/SpineEventBuffer.h"
+#include "manager/SpineManager.h"
+
+using std::string;
+using std::vector;
+
+namespace {
+
+// 与 SpineEventBuffer::kMaxPendingRecords 一致
+const size_t kBufferCapacity = 1 << 14;
+const int32_t kInstanceId = 7;
+
+struct Context {
+    int failures = 0;
+    int checks = 0;
+};
+
+void Expect(Context* context, bool condition, const char* what) {
+    context->checks++;
+    if (!condition) {
+        context->failures++;
+        std::fprintf(stderr, "FAIL %s\n", what);
+    }
+}
+
+/**
+ * 回调收到的事件（eventData 只在回调期间有效，复制需要的字段）
+ */
+struct ReceivedEvent {
+    SpineEventType type;
+    string eventName;
+    string stringValue;
+};
+vector<ReceivedEvent> callbackEvents;
+
+void OnEvent(const SpineAnimationEvent& event) {
+    ReceivedEvent received{event.type, "", ""};
+    if (event.eventData) {
+        received.eventName = event.eventData->name;
+        received.stringValue = event.eventData->stringValue;
+    }
+    callbackEvents.push_back(received);
+}
+
+std::unique_ptr<SpineManager> NewManager() {
+    auto manager = std::make_unique<SpineManager>("", std::make_unique<SpineRenderContext>(""));
+    manager->SetInstanceId(kInstanceId);
+    return manager;
+}
+
+/**
+ * 交替触发轨道开始事件和用户事件
+ */
+void TriggerEvents(SpineManager* manager, size_t count) {
+    SpineEventDataView footstep;
+    footstep.name = "footstep";
+    footstep.intValue = 3;
+    footstep.floatValue = 0.5f;
+    footstep.stringValue = "left";
+    for (size_t i = 0; i < count; ++i) {
+        if (i % 2 == 0) {
+            manager->TriggerEvent(SpineEventType::kStart, 0, "walk", nullptr);
+        } else {
+            manager->TriggerEvent(SpineEventType::kEvent, 1, "walk", &footstep);
+        }
+    }
+}
+
+void TestBatchOverflow(Context* context) {
+    callbackEvents.clear();
+    auto buffer = std::make_shared<SpineEventBuffer>();
+    buffer->SetEnabled(true);
+    std::unique_ptr<SpineManager> manager = NewManager();
+    manager->SetEventCallback(OnEvent);
+    manager->SetEventBuffer(buffer);
+
+    // 写满后再触发 5 个：全部留在批次路径上
+    TriggerEvents(manager.get(), kBufferCapacity + 5);
+    Expect(context, callbackEvents.empty(), "batched events never reach the per-event callback");
+
+    SpineEventBatch batch;
+    Expect(context, buffer->Drain(&batch) == kBufferCapacity, "full buffer drains its capacity");
+    Expect(context, batch.dropped == 5, "overflow counted as dropped");
+    Expect(context, batch.newStrings == vector<string>({"walk", "footstep", "left"}), "names interned once");
+    const SpineEventRecord& start = batch.records[0];
+    const SpineEventRecord& event = batch.records[1];
+    Expect(context, start.instanceId == kInstanceId && start.type == static_cast<int32_t>(SpineEventType::kStart) &&
+                    start.trackIndex == 0 && start.animationId == 0 && start.eventId == -1 && start.stringValueId == -1,
+           "start record");
+    Expect(context, event.type == static_cast<int32_t>(SpineEventType::kEvent) && event.trackIndex == 1 &&
+                    event.animationId == 0 && event.eventId == 1 && event.intValue == 3 && event.floatValue == 0.5f &&
+                    event.stringValueId == 2,
+           "user event record");
+    SpineEventStats stats = manager->GetEventStats();
+    Expect(context, stats.delivered == kBufferCapacity && stats.filtered == 0, "dropped events are not delivered");
+
+    // 取出后继续写入，已下发的字符串不再重复
+    TriggerEvents(manager.get(), 2);
+    Expect(context, buffer->Drain(&batch) == 2 && batch.dropped == 0 && batch.newStrings.empty(),
+           "buffer accepts events again after drain");
+
+    // 关闭合并投递后逐个回调
+    buffer->SetEnabled(false);
+    TriggerEvents(manager.get(), 3);
+    Expect(context, callbackEvents.size() == 3 && buffer->Drain(&batch) == 0, "disabled buffer falls back to callbacks");
+    Expect(context, callbackEvents.size() == 3 && callbackEvents[1].eventName == "footstep" &&
+                    callbackEvents[1].stringValue == "left",
+           "callback event data");
+
+    // 重新开启：新的接收方从头收到字符串表
+    buffer->SetEnabled(true);
+    TriggerEvents(manager.get(), 1);
+    Expect(context, buffer->Drain(&batch) == 1 && batch.newStrings.size() == 3, "strings resent after re-enable");
+
+    // 放回实例池前重置：不再持有上一个环境的缓冲
+    Expect(context, buffer.use_count() == 2, "manager holds the buffer while registered");
+    manager->Reset();
+    Expect(context, buffer.use_count() == 1, "reset releases the event buffer");
+}
+
+void TestFilterStats(Context* context) {
+    callbackEvents.clear();
+    std::unique_ptr<SpineManager> manager = NewManager();
+
+    // 没有回调：既不投递也不计为过滤
+    TriggerEvents(manager.get(), 10);
+    SpineEventStats stats = manager->GetEventStats();
+    Expect(context, stats.delivered == 0 && stats.filtered == 0, "events without a callback are not counted");
+
+    // 只订阅完成事件和名为 hit 的用户事件
+    manager->SetEventCallback(OnEvent);
+    manager->SetEventFilter(SpineEventTypeBit(SpineEventType::kComplete) | SpineEventTypeBit(SpineEventType::kEvent),
+                            {"hit"});
+    SpineEventDataView hit;
+    hit.name = "hit";
+    SpineEventDataView footstep;
+    footstep.name = "footstep";
+    manager->TriggerEvent(SpineEventType::kStart, 0, "walk", nullptr);
+    manager->TriggerEvent(SpineEventType::kEvent, 0, "walk", &footstep);
+    manager->TriggerEvent(SpineEventType::kEvent, 0, "walk", &hit);
+    manager->TriggerEvent(SpineEventType::kComplete, 0, "walk", nullptr);
+    stats = manager->GetEventStats();
+    Expect(context, stats.delivered == 2 && stats.filtered == 2, "mask and name rejections counted as filtered");
+    Expect(context, callbackEvents.size() == 2 && callbackEvents[0].type == SpineEventType::kEvent &&
+                    callbackEvents[1].type == SpineEventType::kComplete,
+           "subscribed events delivered in order");
+}
+
+} // namespace
+
+int main() {
+    Context context;
+    TestBatchOverflow(&context);
+    TestFilterStats(&context);
+
+    std::printf("%d checks, %d failures\n", context.checks, context.failures);
+    return context.failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,414 @@
+//
+// Created on 2026/10/19.
+//
+
+/**
+ * spine_timeline_batch_test - 时间轴批量采样一致性测试（ctest）
+ * 以随机关键帧和曲线对比运行时的求值规则（测试内按 spine::CurveTimeline 的 setBezier / getBezierValue 和
+ * 线性、阶梯规则实现的参考），要求逐位一致：
+ * - SpineCurveLut 与 getBezierValue（含落在采样点上的时间和段的两端）
+ * - SpineFrameCursor 与线性扫描（顺序播放、跳转、循环回绕、倒放、多条目交替，超过槽位数的条目）
+ * - SpineTimelineGroup::Sample 与逐通道参考，在每个指令集级别上运行
+ * - LerpRow 与 LerpRowScalar，在每个指令集级别上运行，不越界写入
+ * CPU 不支持的级别跳过。
+ *
+ * 用法：
+ *   spine_timeline_batch_test [--seed <n>]
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+#include "asset/SpineTimelineBatch.h"
+#include "render/SpineVertexKernels.h"
+
+using std::vector;
+using namespace SpineVertexKernels;
+
+namespace {
+
+// 与 spine::CurveTimeline 一致
+const int kCurveLinear = 0;
+const int kCurveStepped = 1;
+const int kCurveBezier = 2;
+const size_t kBezierSize = 18;
+
+const size_t kCursorLookups = 100000;
+const float kSentinel = -12345.0f;
+
+struct Context {
+    std::mt19937 rng;
+    int failures = 0;
+    int checks = 0;
+};
+
+bool SameBits(float a, float b) {
+    return std::memcmp(&a, &b, sizeof(float)) == 0;
+}
+
+float RandomFloat(std::mt19937& rng, float low, float high) {
+    std::uniform_real_distribution<float> dist(low, high);
+    return dist(rng);
+}
+
+/**
+ * 运行时 CurveTimeline 的参考实现：frames 每帧为时间加 valueCount 个值，
+ * curves 前 frameCount 个为曲线类型，之后每个贝塞尔段 18 个采样点
+ */
+struct ReferenceTimeline {
+    size_t valueCount = 0;
+    size_t frameCount = 0;
+    vector<float> frames;
+    vector<float> curves;
+
+    size_t FrameEntries() const { return valueCount + 1; }
+
+    // CurveTimeline::setBezier
+    void SetBezier(size_t bezier, size_t frame, size_t value, float time1, float value1, float cx1, float cy1,
+                   float cx2, float cy2, float time2, float value2) {
+        size_t i = frameCount + bezier * kBezierSize;
+        if (value == 0) {
+            curves[frame] = static_cast<float>(kCurveBezier + i);
+        }
+        float tmpx = (time1 - cx1 * 2 + cx2) * 0.03f, tmpy = (value1 - cy1 * 2 + cy2) * 0.03f;
+        float dddx = ((cx1 - cx2) * 3 - time1 + time2) * 0.006f, dddy = ((cy1 - cy2) * 3 - value1 + value2) * 0.006f;
+        float ddx = tmpx * 2 + dddx, ddy = tmpy * 2 + dddy;
+        float dx = (cx1 - time1) * 0.3f + tmpx + dddx * 0.16666667f;
+        float dy = (cy1 - value1) * 0.3f + tmpy + dddy * 0.16666667f;
+        float x = time1 + dx, y = value1 + dy;
+        for (size_t n = i + kBezierSize; i < n; i += 2) {
+            curves[i] = x;
+            curves[i + 1] = y;
+            dx += ddx;
+            dy += ddy;
+            ddx += dddx;
+            ddy += dddy;
+            x += dx;
+            y += dy;
+        }
+    }
+
+    // CurveTimeline::getBezierValue
+    float GetBezierValue(float time, size_t frameIndex, size_t valueOffset, size_t i) const {
+        if (curves[i] > time) {
+            float x = frames[frameIndex], y = frames[frameIndex + valueOffset];
+            return y + (time - x) / (curves[i] - x) * (curves[i + 1] - y);
+        }
+        size_t n = i + kBezierSize;
+        for (i += 2; i < n; i += 2) {
+            if (curves[i] >= time) {
+                float x = curves[i - 2], y = curves[i - 1];
+                return y + (time - x) / (curves[i] - x) * (curves[i + 1] - y);
+            }
+        }
+        frameIndex += FrameEntries();
+        float x = curves[n - 2], y = curves[n - 1];
+        return y + (time - x) / (frames[frameIndex] - x) * (frames[frameIndex + valueOffset] - y);
+    }
+
+    // CurveTimeline1/2::getCurveValue 的单通道规则（time 不早于首帧）
+    float GetCurveValue(float time, size_t value) const {
+        const size_t entries = FrameEntries();
+        size_t frame = 0;
+        while (frame + 1 < frameCount && frames[(frame + 1) * entries] <= time) {
+            ++frame;
+        }
+        const size_t i = frame * entries;
+        const size_t valueOffset = value + 1;
+        if (frame + 1 == frameCount) {
+            return frames[i + valueOffset];
+        }
+        const int curveType = static_cast<int>(curves[frame]);
+        if (curveType == kCurveLinear) {
+            float before = frames[i], current = frames[i + valueOffset];
+            return current + (time - before) / (frames[i + entries] - before) *
+                                 (frames[i + entries + valueOffset] - current);
+        }
+        if (curveType == kCurveStepped) {
+            return frames[i + valueOffset];
+        }
+        return GetBezierValue(time, i, valueOffset, curveType - kCurveBezier + value * kBezierSize);
+    }
+};
+
+vector<float> RandomTimes(std::mt19937& rng, size_t frameCount) {
+    vector<float> times(frameCount);
+    float time = RandomFloat(rng, 0.0f, 0.2f);
+    for (float& value : times) {
+        value = time;
+        time += RandomFloat(rng, 0.01f, 0.5f);
+    }
+    return times;
+}
+
+/**
+ * 在给定关键帧时间上生成随机曲线的时间轴，curveTypes 为各帧的曲线类型
+ */
+ReferenceTimeline RandomTimeline(std::mt19937& rng, const vector<float>& times, size_t valueCount,
+                                 const vector<int>& curveTypes) {
+    ReferenceTimeline timeline;
+    timeline.valueCount = valueCount;
+    timeline.frameCount = times.size();
+    timeline.frames.resize(times.size() * timeline.FrameEntries());
+    for (size_t frame = 0; frame < times.size(); ++frame) {
+        timeline.frames[frame * timeline.FrameEntries()] = times[frame];
+        for (size_t value = 0; value < valueCount; ++value) {
+            timeline.frames[frame * timeline.FrameEntries() + 1 + value] = RandomFloat(rng, -400.0f, 400.0f);
+        }
+    }
+
+    size_t bezierCount = 0;
+    for (size_t frame = 0; frame + 1 < times.size(); ++frame) {
+        bezierCount += curveTypes[frame] == kCurveBezier ? valueCount : 0;
+    }
+    timeline.curves.assign(times.size() + bezierCount * kBezierSize, static_cast<float>(kCurveLinear));
+    timeline.curves[times.size() - 1] = static_cast<float>(kCurveStepped);
+    size_t bezier = 0;
+    for (size_t frame = 0; frame + 1 < times.size(); ++frame) {
+        if (curveTypes[frame] != kCurveBezier) {
+            timeline.curves[frame] = static_cast<float>(curveTypes[frame]);
+            continue;
+        }
+        const float time1 = times[frame];
+        const float time2 = times[frame + 1];
+        for (size_t value = 0; value < valueCount; ++value) {
+            const float value1 = timeline.frames[frame * timeline.FrameEntries() + 1 + value];
+            const float value2 = timeline.frames[(frame + 1) * timeline.FrameEntries() + 1 + value];
+            // 控制点的时间在段内（编辑器保证曲线在时间上单调），值可以越过两端
+            const float cx1 = RandomFloat(rng, time1, time2);
+            const float cx2 = RandomFloat(rng, cx1, time2);
+            const float cy1 = RandomFloat(rng, -600.0f, 600.0f);
+            const float cy2 = RandomFloat(rng, -600.0f, 600.0f);
+            timeline.SetBezier(bezier++, frame, value, time1, value1, cx1, cy1, cx2, cy2, time2, value2);
+        }
+    }
+    return timeline;
+}
+
+/**
+ * 段内的采样时间：随机时间、段的两端、恰好落在各采样点上的时间
+ */
+vector<float> SegmentTimes(std::mt19937& rng, float time0, float time1, const float* points) {
+    vector<float> times = {time0, time1};
+    for (size_t i = 0; i < kBezierSize / 2; ++i) {
+        times.push_back(points[i * 2]);
+    }
+    for (int i = 0; i < 64; ++i) {
+        times.push_back(RandomFloat(rng, time0, time1));
+    }
+    return times;
+}
+
+void TestCurveLut(Context* context) {
+    int failuresBefore = context->failures;
+    for (int iteration = 0; iteration < 2000; ++iteration) {
+        const vector<float> times = RandomTimes(context->rng, 2);
+        const ReferenceTimeline timeline = RandomTimeline(context->rng, times, 1, {kCurveBezier, kCurveStepped});
+        const float* points = timeline.curves.data() + timeline.frameCount;
+
+        SpineCurveLut lut;
+        lut.Bake(times[0], timeline.frames[1], points, times[1], timeline.frames[3]);
+        for (float time : SegmentTimes(context->rng, times[0], times[1], points)) {
+            const float percent = (time - times[0]) / (times[1] - times[0]);
+            const float expected = timeline.GetBezierValue(time, 0, 1, timeline.frameCount);
+            const float actual = lut.Evaluate(time, percent);
+            context->checks++;
+            if (!SameBits(expected, actual)) {
+                context->failures++;
+                std::fprintf(stderr, "FAIL SpineCurveLut time %.9g: %.9g != %.9g\n", time, actual, expected);
+                return;
+            }
+        }
+    }
+    std::printf("SpineCurveLut %s\n", context->failures == failuresBefore ? "ok" : "FAILED");
+}
+
+size_t LinearSearch(const vector<float>& times, float time) {
+    size_t frame = 0;
+    while (frame + 1 < times.size() && times[frame + 1] <= time) {
+        ++frame;
+    }
+    return frame;
+}
+
+void TestFrameCursor(Context* context) {
+    const int failuresBefore = context->failures;
+    for (size_t frameCount : {1, 2, 3, 7, 40, 300}) {
+        const vector<float> times = RandomTimes(context->rng, frameCount);
+        const float duration = times.back() + 0.3f;
+        SpineFrameCursor cursor;
+
+        // 多个条目交替播放（条目数超过槽位数时会互相挤出）
+        vector<float> entries(SpineFrameCursor::kSlots + 2, 0.0f);
+        std::uniform_int_distribution<size_t> pickEntry(0, entries.size() - 1);
+        std::uniform_int_distribution<int> pickMove(0, 99);
+        for (size_t lookup = 0; lookup < kCursorLookups / 6; ++lookup) {
+            // 多数时间只有前两个条目在播放
+            float& entry = entries[pickMove(context->rng) < 90 ? lookup % 2 : pickEntry(context->rng)];
+            const float lastTime = entry;
+            const int move = pickMove(context->rng);
+            float time;
+            if (move < 70) {
+                time = lastTime + RandomFloat(context->rng, 0.0f, 0.05f);   // 顺序播放
+            } else if (move < 80) {
+                time = lastTime + RandomFloat(context->rng, 0.5f, 5.0f);    // 跳转
+            } else if (move < 88) {
+                time = lastTime - RandomFloat(context->rng, 0.0f, 0.1f);    // 倒放
+            } else if (move < 94) {
+                time = times[context->rng() % frameCount];                  // 恰好在关键帧上
+            } else {
+                time = RandomFloat(context->rng, -0.2f, 0.0f);              // 首帧之前
+            }
+            if (time > duration) {
+                time -= duration;                                           // 循环回绕
+            }
+
+            const size_t expected = LinearSearch(times, time);
+            const size_t actual = cursor.Search(times.data(), frameCount, lastTime, time);
+            const size_t binary = SpineFrameCursor::BinarySearch(times.data(), frameCount, time);
+            context->checks++;
+            if (actual != expected || binary != expected) {
+                context->failures++;
+                std::fprintf(stderr, "FAIL SpineFrameCursor frames=%zu last=%.9g time=%.9g: %zu / %zu != %zu\n",
+                             frameCount, lastTime, time, actual, binary, expected);
+                return;
+            }
+            entry = time;
+        }
+    }
+    std::printf("SpineFrameCursor %s\n", context->failures == failuresBefore ? "ok" : "FAILED");
+}
+
+void TestLerpRow(Context* context, SimdLevel level) {
+    for (size_t count = 0; count <= 41; ++count) {
+        vector<float> before(count);
+        vector<float> after(count);
+        for (size_t i = 0; i < count; ++i) {
+            before[i] = RandomFloat(context->rng, -1000.0f, 1000.0f);
+            after[i] = RandomFloat(context->rng, -1000.0f, 1000.0f);
+        }
+        const float percent = RandomFloat(context->rng, 0.0f, 1.0f);
+        vector<float> expected(count + 1, kSentinel);
+        vector<float> actual(count + 1, kSentinel);
+        SpineTimelineGroup::LerpRowScalar(before.data(), after.data(), percent, count, expected.data());
+        SetSimdLevel(level);
+        SpineTimelineGroup::LerpRow(before.data(), after.data(), percent, count, actual.data());
+        context->checks++;
+        if (std::memcmp(expected.data(), actual.data(), expected.size() * sizeof(float)) != 0) {
+            context->failures++;
+            std::fprintf(stderr, "FAIL LerpRow %s count=%zu\n", GetSimdLevelName(level), count);
+            return;
+        }
+    }
+}
+
+/**
+ * 旋转（1 个值）、平移（2 个值）、缩放（2 个值）时间轴合为一组，逐通道与参考对比
+ */
+void TestGroup(Context* context, SimdLevel level) {
+    std::uniform_int_distribution<int> pickCurve(kCurveLinear, kCurveBezier);
+    for (size_t frameCount : {1, 2, 5, 30}) {
+        const vector<float> times = RandomTimes(context->rng, frameCount);
+        const size_t valueCounts[] = {1, 2, 2};
+        vector<ReferenceTimeline> timelines;
+        size_t channelCount = 0;
+        for (size_t valueCount : valueCounts) {
+            vector<int> curveTypes(frameCount);
+            for (int& type : curveTypes) {
+                type = pickCurve(context->rng);
+            }
+            timelines.push_back(RandomTimeline(context->rng, times, valueCount, curveTypes));
+            channelCount += valueCount;
+        }
+
+        SpineTimelineGroup group(timelines[0].frames.data(), timelines[0].FrameEntries(), frameCount, channelCount);
+        size_t channel = 0;
+        for (const ReferenceTimeline& timeline : timelines) {
+            if (!group.HasSameTimes(timeline.frames.data(), timeline.FrameEntries(), frameCount)) {
+                context->failures++;
+                std::fprintf(stderr, "FAIL HasSameTimes\n");
+                return;
+            }
+            for (size_t value = 0; value < timeline.valueCount; ++value) {
+                group.SetChannel(channel++, timeline.frames.data(), timeline.FrameEntries(), value + 1,
+                                 timeline.curves.data(), value * kBezierSize);
+            }
+        }
+
+        SetSimdLevel(level);
+        vector<float> out(channelCount + 1, kSentinel);
+        context->checks++;
+        if (group.Sample(0.0f, times[0] - 0.01f, out.data()) || out[0] != kSentinel) {
+            context->failures++;
+            std::fprintf(stderr, "FAIL Sample before the first frame %s\n", GetSimdLevelName(level));
+            return;
+        }
+
+        float lastTime = times[0];
+        for (int i = 0; i < 2000; ++i) {
+            float time = i % 3 == 0 ? lastTime + RandomFloat(context->rng, 0.0f, 0.05f)
+                                    : RandomFloat(context->rng, times[0], times.back() + 0.2f);
+            if (i % 17 == 0) {
+                time = times[context->rng() % frameCount];
+            }
+            group.Sample(lastTime, time, out.data());
+            lastTime = time;
+
+            channel = 0;
+            for (const ReferenceTimeline& timeline : timelines) {
+                for (size_t value = 0; value < timeline.valueCount; ++value, ++channel) {
+                    const float expected = timeline.GetCurveValue(time, value);
+                    context->checks++;
+                    if (!SameBits(expected, out[channel])) {
+                        context->failures++;
+                        std::fprintf(stderr, "FAIL Sample %s frames=%zu time=%.9g channel %zu: %.9g != %.9g\n",
+                                     GetSimdLevelName(level), frameCount, time, channel, out[channel], expected);
+                        return;
+                    }
+                }
+            }
+            if (out[channelCount] != kSentinel) {
+                context->failures++;
+                std::fprintf(stderr, "FAIL Sample wrote past the last channel\n");
+                return;
+            }
+        }
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    uint32_t seed = 20261019;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            seed = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        } else {
+            std::fprintf(stderr, "usage: %s [--seed <n>]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    Context context;
+    context.rng.seed(seed);
+    TestCurveLut(&context);
+    TestFrameCursor(&context);
+
+    const SimdLevel levels[] = {SimdLevel::kScalar, SimdLevel::kSse2, SimdLevel::kAvx2, SimdLevel::kNeon};
+    for (SimdLevel level : levels) {
+        if (SetSimdLevel(level) != level) {
+            std::printf("skip %s (not supported on this CPU)\n", GetSimdLevelName(level));
+            continue;
+        }
+        const int failuresBefore = context.failures;
+        TestLerpRow(&context, level);
+        TestGroup(&context, level);
+        std::printf("%s %s\n", GetSimdLevelName(level), context.failures == failuresBefore ? "ok" : "FAILED");
+    }
+    SetSimdLevel(DetectSimdLevel());
+
+    std::printf("seed %u: %d checks, %d failures\n", seed, context.checks, context.failures);
+    return context.failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,168 @@
+//
+// Created on 2026/10/19.
+//
+
+/**
+ * spine_vertex_kernels_test - 顶点内核一致性测试（ctest）
+ * 以随机输入分别运行标量、SSE2、AVX2（ARM 上为 NEON）实现，要求输出与标量逐位一致。
+ * 顶点数覆盖 0 到 SIMD 宽度的若干倍以及不能整除宽度的尾部，输出间隔覆盖紧密排列和带颜色的交错布局。
+ * CPU 不支持的级别跳过。
+ *
+ * 用法：
+ *   spine_vertex_kernels_test [--seed <n>]
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+#include "render/SpineVertexKernels.h"
+
+using std::vector;
+using namespace SpineVertexKernels;
+
+namespace {
+
+const size_t kCounts[] = {0, 1, 2, 3, 4, 5, 7, 8, 9, 11, 15, 16, 17, 23, 31, 32, 33, 63, 64, 65, 1000, 1001, 1003, 1007};
+const size_t kStrides[] = {2, 5, 8};
+const size_t kBoneCount = 32;
+
+// 输出中不属于顶点坐标的位置填充哨兵，检查内核没有越界写入
+const float kSentinel = -12345.0f;
+
+struct Context {
+    std::mt19937 rng;
+    int failures = 0;
+    int checks = 0;
+};
+
+float RandomFloat(std::mt19937& rng, float range) {
+    std::uniform_real_distribution<float> dist(-range, range);
+    return dist(rng);
+}
+
+vector<BoneTransform> RandomBones(std::mt19937& rng) {
+    vector<BoneTransform> bones(kBoneCount);
+    for (BoneTransform& bone : bones) {
+        bone = BoneTransform{RandomFloat(rng, 2.0f), RandomFloat(rng, 2.0f), RandomFloat(rng, 2.0f),
+                             RandomFloat(rng, 2.0f), RandomFloat(rng, 500.0f), RandomFloat(rng, 500.0f)};
+    }
+    return bones;
+}
+
+/**
+ * 生成 Spine 变长加权格式的随机网格（每个顶点 1 到 4 个影响）并打包
+ */
+vector<SkinnedVertex4> RandomSkinnedVertices(std::mt19937& rng, size_t count, size_t* influenceCount) {
+    std::uniform_int_distribution<int32_t> influences(1, 4);
+    std::uniform_int_distribution<int32_t> boneIndex(0, static_cast<int32_t>(kBoneCount) - 1);
+    std::uniform_real_distribution<float> weight(0.0f, 1.0f);
+
+    vector<int32_t> boneData;
+    vector<float> vertexData;
+    for (size_t i = 0; i < count; ++i) {
+        const int32_t n = influences(rng);
+        boneData.push_back(n);
+        for (int32_t k = 0; k < n; ++k) {
+            boneData.push_back(boneIndex(rng));
+            vertexData.push_back(RandomFloat(rng, 200.0f));
+            vertexData.push_back(RandomFloat(rng, 200.0f));
+            vertexData.push_back(weight(rng));
+        }
+    }
+    *influenceCount = vertexData.size() / 3;
+
+    vector<SkinnedVertex4> packed;
+    if (!PackWeightedVertices(boneData.data(), boneData.size(), vertexData.data(), vertexData.size(), &packed)) {
+        std::fprintf(stderr, "PackWeightedVertices failed for %zu vertices\n", count);
+        std::exit(1);
+    }
+    return packed;
+}
+
+void Check(Context* context, const char* kernel, SimdLevel level, size_t count, size_t stride,
+           const vector<float>& expected, const vector<float>& actual) {
+    context->checks++;
+    if (std::memcmp(expected.data(), actual.data(), expected.size() * sizeof(float)) == 0) {
+        return;
+    }
+    context->failures++;
+    for (size_t i = 0; i < expected.size(); ++i) {
+        if (std::memcmp(&expected[i], &actual[i], sizeof(float)) != 0) {
+            std::fprintf(stderr, "FAIL %s %s count=%zu stride=%zu: vertex %zu component %zu: %.9g != %.9g\n", kernel,
+                         GetSimdLevelName(level), count, stride, i / stride, i % stride, actual[i], expected[i]);
+            return;
+        }
+    }
+}
+
+void TestLevel(Context* context, SimdLevel level) {
+    for (size_t count : kCounts) {
+        for (size_t stride : kStrides) {
+            const vector<BoneTransform> bones = RandomBones(context->rng);
+
+            // 非加权顶点变换
+            vector<float> local(count * 2);
+            for (float& value : local) {
+                value = RandomFloat(context->rng, 300.0f);
+            }
+            vector<float> expected(count * stride + 1, kSentinel);
+            vector<float> actual(count * stride + 1, kSentinel);
+            TransformVerticesScalar(bones[0], local.data(), count, expected.data(), stride);
+            SetSimdLevel(level);
+            TransformVertices(bones[0], local.data(), count, actual.data(), stride);
+            Check(context, "TransformVertices", level, count, stride, expected, actual);
+
+            // 加权蒙皮（分别测试无变形和有变形）
+            size_t influenceCount = 0;
+            const vector<SkinnedVertex4> vertices = RandomSkinnedVertices(context->rng, count, &influenceCount);
+            vector<float> deform(influenceCount * 2);
+            for (float& value : deform) {
+                value = RandomFloat(context->rng, 20.0f);
+            }
+            const float* deformInputs[] = {nullptr, deform.data()};
+            for (const float* deformData : deformInputs) {
+                std::fill(expected.begin(), expected.end(), kSentinel);
+                std::fill(actual.begin(), actual.end(), kSentinel);
+                SkinVertices4Scalar(bones.data(), vertices.data(), count, deformData, expected.data(), stride);
+                SetSimdLevel(level);
+                SkinVertices4(bones.data(), vertices.data(), count, deformData, actual.data(), stride);
+                Check(context, deformData ? "SkinVertices4+deform" : "SkinVertices4", level, count, stride, expected,
+                      actual);
+            }
+        }
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    uint32_t seed = 20261019;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            seed = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        } else {
+            std::fprintf(stderr, "usage: %s [--seed <n>]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    Context context;
+    context.rng.seed(seed);
+
+    const SimdLevel levels[] = {SimdLevel::kScalar, SimdLevel::kSse2, SimdLevel::kAvx2, SimdLevel::kNeon};
+    for (SimdLevel level : levels) {
+        if (SetSimdLevel(level) != level) {
+            std::printf("skip %s (not supported on this CPU)\n", GetSimdLevelName(level));
+            continue;
+        }
+        const int failuresBefore = context.failures;
+        TestLevel(&context, level);
+        std::printf("%s %s\n", GetSimdLevelName(level), context.failures == failuresBefore ? "ok" : "FAILED");
+    }
+    SetSimdLevel(DetectSimdLevel());
+
+    std::printf("seed %u: %d checks, %d failures\n", seed, context.checks, context.failures);
+    return context.failures == 0 ? 0 : 1;
+}